@@ -11,14 +11,22 @@
 #endif
 
 #include <iterator>
+#include <ios>
+#include <string>
 #include <vector>
+#include <list>
 #include <algorithm>
 
 #include <boost/config.hpp>
+#include <boost/assert.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
 
 #include <boost/spirit/home/karma/generator.hpp>
+#include <boost/spirit/home/support/attributes_fwd.hpp>
 #include <boost/spirit/home/support/iterators/ostream_iterator.hpp>
 #include <boost/spirit/home/support/unused.hpp>
 
@@ -26,6 +34,187 @@
 #include <boost/spirit/home/support/char_encoding/unicode.hpp>
 #endif
 
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  Customization point for writing a range of characters to an output 
+    //  iterator at once. The default writes them one at a time, the 
+    //  specializations below append them to the end of a std::basic_string 
+    //  or std::vector and write them to the stream buffer of an ostream.
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename OutputIterator, typename Char>
+        void write_each(OutputIterator& sink, Char const* first, std::size_t n)
+        {
+            for (Char const* last = first + n; first != last; ++first)
+            {
+                *sink = *first;
+                ++sink;
+            }
+        }
+    }
+
+    template <typename OutputIterator, typename Enable/* = void*/>
+    struct sink_write
+    {
+        template <typename Char>
+        static void call(OutputIterator& sink, Char const* first
+          , std::size_t n)
+        {
+            detail::write_each(sink, first, n);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Customization point for announcing the number of characters about to
+    //  be written to an output iterator. This is a hint only, the default 
+    //  does nothing.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Enable/* = void*/>
+    struct sink_reserve
+    {
+        static void call(OutputIterator&, std::size_t) {}
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct sink_write<T*>
+    {
+        template <typename Char>
+        static void call(T*& sink, Char const* first, std::size_t n)
+        {
+            sink = std::copy(first, first + n, sink);
+        }
+    };
+
+    namespace detail
+    {
+        // std::back_insert_iterator doesn't expose its container
+        template <typename Container>
+        struct back_insert_container : std::back_insert_iterator<Container>
+        {
+            static Container& get(std::back_insert_iterator<Container>& it)
+            {
+                return *(it.*(&back_insert_container::container));
+            }
+        };
+
+        // grow geometrically even if there are many small hints
+        template <typename Container>
+        void reserve_container(Container& c, std::size_t n)
+        {
+            if (c.capacity() - c.size() < n)
+                c.reserve((std::max)(c.size() + n, 2 * c.capacity()));
+        }
+    }
+
+    template <typename Char, typename Traits, typename Allocator>
+    struct sink_write<
+        std::back_insert_iterator<std::basic_string<Char, Traits, Allocator> > >
+    {
+        typedef std::basic_string<Char, Traits, Allocator> container_type;
+
+        template <typename Char_>
+        static void call(std::back_insert_iterator<container_type>& sink
+          , Char_ const* first, std::size_t n)
+        {
+            detail::back_insert_container<container_type>::get(sink).append(
+                first, first + n);
+        }
+    };
+
+    template <typename Char, typename Traits, typename Allocator>
+    struct sink_reserve<
+        std::back_insert_iterator<std::basic_string<Char, Traits, Allocator> > >
+    {
+        typedef std::basic_string<Char, Traits, Allocator> container_type;
+
+        static void call(std::back_insert_iterator<container_type>& sink
+          , std::size_t n)
+        {
+            detail::reserve_container(
+                detail::back_insert_container<container_type>::get(sink), n);
+        }
+    };
+
+    template <typename T, typename Allocator>
+    struct sink_write<std::back_insert_iterator<std::vector<T, Allocator> > >
+    {
+        typedef std::vector<T, Allocator> container_type;
+
+        template <typename Char>
+        static void call(std::back_insert_iterator<container_type>& sink
+          , Char const* first, std::size_t n)
+        {
+            container_type& c = 
+                detail::back_insert_container<container_type>::get(sink);
+            c.insert(c.end(), first, first + n);
+        }
+    };
+
+    template <typename T, typename Allocator>
+    struct sink_reserve<std::back_insert_iterator<std::vector<T, Allocator> > >
+    {
+        typedef std::vector<T, Allocator> container_type;
+
+        static void call(std::back_insert_iterator<container_type>& sink
+          , std::size_t n)
+        {
+            detail::reserve_container(
+                detail::back_insert_container<container_type>::get(sink), n);
+        }
+    };
+
+    //  Characters of the stream's own type are written to its stream buffer 
+    //  directly, unless the stream would format them (a field width is set) 
+    //  or a delimiter has to be inserted in between.
+    template <typename Elem, typename Traits>
+    struct sink_write<karma::ostream_iterator<Elem, Elem, Traits> >
+    {
+        typedef karma::ostream_iterator<Elem, Elem, Traits> iterator_type;
+
+        template <typename Char>
+        static void call(iterator_type& sink, Char const* first
+          , std::size_t n)
+        {
+            detail::write_each(sink, first, n);
+        }
+
+        static void call(iterator_type& sink, Elem const* first
+          , std::size_t n)
+        {
+            typename iterator_type::ostream_type& os = sink.get_ostream();
+            if (sink.has_delimiter() || 0 != os.width())
+            {
+                detail::write_each(sink, first, n);
+                return;
+            }
+
+            typename iterator_type::ostream_type::sentry ok(os);
+            if (ok && std::streamsize(n) != 
+                    os.rdbuf()->sputn(first, std::streamsize(n)))
+            {
+                os.setstate(std::ios_base::badbit);
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Char>
+    inline void write_to_sink(OutputIterator& sink, Char const* first
+      , std::size_t n)
+    {
+        sink_write<OutputIterator>::call(sink, first, n);
+    }
+
+    template <typename OutputIterator>
+    inline void reserve_sink(OutputIterator& sink, std::size_t n)
+    {
+        sink_reserve<OutputIterator>::call(sink, n);
+    }
+}}}
+
 namespace boost { namespace spirit { namespace karma { namespace detail 
 {
     ///////////////////////////////////////////////////////////////////////////
@@ -49,6 +238,13 @@ namespace boost { namespace spirit { namespace karma { namespace detail
                 ++column;
             }
         }
+        template <typename Char>
+        void output(Char const* first, std::size_t n)
+        {
+            for (Char const* last = first + n; first != last; ++first)
+                output(*first);
+        }
+
         std::size_t get_count() const { return count; }
         std::size_t get_line() const { return line; }
         std::size_t get_column() const { return column; }
@@ -73,6 +269,12 @@ namespace boost { namespace spirit { namespace karma { namespace detail
             track_position_data.output(value);
         }
 
+        template <typename Char>
+        void output(Char const* first, std::size_t n)
+        {
+            track_position_data.output(first, n);
+        }
+
         // return the current count in the output
         std::size_t get_out_count() const
         {
@@ -102,6 +304,9 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 
         template <typename T>
         void output(T const& /*value*/) {}
+
+        template <typename Char>
+        void output(Char const* /*first*/, std::size_t /*n*/) {}
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -129,6 +334,10 @@ namespace boost { namespace spirit { namespace karma { namespace detail
         {
             ++count; 
         }
+        void output(std::size_t n) 
+        {
+            count += n; 
+        }
         std::size_t get_count() const { return count; }
 
         // propagate count from embedded counters
@@ -169,6 +378,13 @@ namespace boost { namespace spirit { namespace karma { namespace detail
                 count->output();
         }
 
+        template <typename Char>
+        void output(Char const* /*first*/, std::size_t n) 
+        {
+            if (NULL != count)
+                count->output(n);
+        }
+
     private:
         counting_sink<OutputIterator>* count;      // for counting
     };
@@ -180,26 +396,125 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 
         template <typename T>
         void output(T const& /*value*/) {}
+
+        template <typename Char>
+        void output(Char const* /*first*/, std::size_t /*n*/) {}
     };
 
     ///////////////////////////////////////////////////////////////////////////
     //  The following classes are used to intercept the output into a buffer
     //  allowing to do things like alignment, character escaping etc.
     ///////////////////////////////////////////////////////////////////////////
-    class buffer_sink : boost::noncopyable
-    {
-       // wchar_t is only 16-bits on Windows. If BOOST_SPIRIT_UNICODE is
-       // defined, the character type is 32-bits wide so we need to make
-       // sure the buffer is at least that wide.
+
+    // wchar_t is only 16-bits on Windows. If BOOST_SPIRIT_UNICODE is
+    // defined, the character type is 32-bits wide so we need to make
+    // sure the buffer is at least that wide.
 #if (defined(_WIN32) || defined(__CYGWIN__)) && defined(BOOST_SPIRIT_UNICODE)
-       typedef spirit::char_encoding::unicode::char_type buffer_char_type;
+    typedef spirit::char_encoding::unicode::char_type default_buffer_char_type;
 #else
-       typedef wchar_t buffer_char_type;
+    typedef wchar_t default_buffer_char_type;
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  The buffers store the output as the type the wrapped output iterator
+    //  converts it to anyway, i.e. char for a std::string, falling back to
+    //  the widest character type for output iterators we don't know about.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator>
+    struct buffer_char
+    {
+        typedef default_buffer_char_type type;
+    };
+
+    template <typename T>
+    struct buffer_char<T*>
+    {
+        typedef T type;
+    };
+
+    template <typename Container>
+    struct buffer_char<std::back_insert_iterator<Container> >
+    {
+        typedef typename Container::value_type type;
+    };
+
+    template <typename T, typename Elem, typename Traits>
+    struct buffer_char<karma::ostream_iterator<T, Elem, Traits> >
+    {
+        typedef T type;
+    };
+
+    template <typename T, typename Elem, typename Traits>
+    struct buffer_char<std::ostream_iterator<T, Elem, Traits> >
+    {
+        typedef T type;
+    };
+
+    template <typename Elem, typename Traits>
+    struct buffer_char<std::ostreambuf_iterator<Elem, Traits> >
+    {
+        typedef Elem type;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The buffers used during one generator invocation. As buffering is
+    //  always scoped (see enable_buffering) the buffers form a stack, the
+    //  memory of which is reused by any buffering happening later on, e.g.
+    //  by the next branch of an alternative.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    class buffer_pool : boost::noncopyable
+    {
+    public:
+        typedef std::vector<Char> buffer_type;
+
+        buffer_pool() : depth(0) {}
+
+        buffer_type& acquire()
+        {
+            return at(depth++);
+        }
+
+        void release()
+        {
+            BOOST_ASSERT(depth != 0);
+            at(--depth).clear();
+        }
+
+    private:
+        enum { inline_buffers = 4 };
+
+        buffer_type& at(std::size_t level)
+        {
+            if (level < inline_buffers)
+                return buffers[level];
+
+            // deeper nesting is rare, a list doesn't move the buffers which
+            // are in use when growing
+            level -= inline_buffers;
+            if (level == more.size())
+                more.push_back(buffer_type());
+
+            typename std::list<buffer_type>::iterator it = more.begin();
+            std::advance(it, level);
+            return *it;
+        }
+
+        buffer_type buffers[inline_buffers];
+        std::list<buffer_type> more;
+        std::size_t depth;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    class buffer_sink : boost::noncopyable
+    {
     public:
-        buffer_sink()
-          : width(0) {}
+        typedef Char buffer_char_type;
+        typedef typename buffer_pool<Char>::buffer_type buffer_type;
+
+        explicit buffer_sink(buffer_type& buffer_)
+          : width(0), buffer(buffer_) {}
 
         ~buffer_sink() 
         {
@@ -219,13 +534,30 @@ namespace boost { namespace spirit { namespace karma { namespace detail
             width = 0; 
         }
 
+#if defined(BOOST_MSVC)
+// 'argument' : conversion from '...' to '...', possible loss of data
+#pragma warning (push)
+#pragma warning (disable: 4244)
+#endif
         template <typename T>
         void output(T const& value)
         {
-            BOOST_STATIC_ASSERT(sizeof(T) <= sizeof(buffer_char_type));
+            BOOST_STATIC_ASSERT(sizeof(T) <= sizeof(buffer_char_type) ||
+                !(is_same<buffer_char_type, default_buffer_char_type>::value));
             buffer.push_back(value);
         }
 
+        template <typename Char_>
+        void output(Char_ const* first, std::size_t n)
+        {
+            BOOST_STATIC_ASSERT(sizeof(Char_) <= sizeof(buffer_char_type) ||
+                !(is_same<buffer_char_type, default_buffer_char_type>::value));
+            buffer.insert(buffer.end(), first, first + n);
+        }
+#if defined(BOOST_MSVC)
+#pragma warning (pop)
+#endif
+
         template <typename OutputIterator_>
         bool copy(OutputIterator_& sink, std::size_t maxwidth) const 
         {
@@ -233,13 +565,13 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 #pragma warning(push)
 #pragma warning(disable: 4267)
 #endif
-            typename std::basic_string<buffer_char_type>::const_iterator end = 
-                buffer.begin() + (std::min)(buffer.size(), maxwidth);
+            std::size_t const n = (std::min)(buffer.size(), maxwidth);
 
 #if defined(BOOST_MSVC)
 #pragma warning(pop)
 #endif
-            std::copy(buffer.begin(), end, sink);
+            if (0 != n)
+                traits::write_to_sink(sink, &buffer[0], n);
             return true;
         }
         template <typename RestIterator>
@@ -249,13 +581,18 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 #pragma warning(push)
 #pragma warning(disable: 4267)
 #endif
-            typename std::basic_string<buffer_char_type>::const_iterator begin = 
-                buffer.begin() + (std::min)(buffer.size(), start_at);
+            std::size_t const start = (std::min)(buffer.size(), start_at);
 
 #if defined(BOOST_MSVC)
 #pragma warning(pop)
 #endif
-            std::copy(begin, buffer.end(), sink);
+            // the given iterator itself is left alone
+            typename remove_const<RestIterator>::type out = sink;
+            if (start != buffer.size())
+            {
+                traits::write_to_sink(out, &buffer[0] + start
+                  , buffer.size() - start);
+            }
             return true;
         }
 
@@ -266,24 +603,33 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 
     private:
         std::size_t width;
-        std::basic_string<buffer_char_type> buffer;
+        buffer_type& buffer;
     };
 
     ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
     struct buffering_policy
     {
     public:
+        typedef buffer_sink<Char> buffer_sink_type;
+        typedef typename buffer_sink_type::buffer_type buffer_type;
+
         buffering_policy() : buffer(NULL) {}
+
+        // copies don't share the buffer pool, they are short lived anyway
         buffering_policy(buffering_policy const& rhs) : buffer(rhs.buffer) {}
 
         // functions related to buffering
-        buffer_sink* chain_buffering(buffer_sink* buffer_data)
+        buffer_sink_type* chain_buffering(buffer_sink_type* buffer_data)
         {
-            buffer_sink* prev_buffer = buffer;
+            buffer_sink_type* prev_buffer = buffer;
             buffer = buffer_data;
             return prev_buffer;
         }
 
+        buffer_type& acquire_buffer() { return pool.acquire(); }
+        void release_buffer() { pool.release(); }
+
         template <typename T>
         bool output(T const& value) 
         { 
@@ -295,10 +641,21 @@ namespace boost { namespace spirit { namespace karma { namespace detail
             return true;
         }
 
+        template <typename Char_>
+        bool output(Char_ const* first, std::size_t n) 
+        { 
+            if (NULL != buffer) {
+                buffer->output(first, n);
+                return false;
+            }
+            return true;
+        }
+
         bool has_buffer() const { return NULL != buffer; }
 
     private:
-        buffer_sink* buffer;
+        buffer_sink_type* buffer;
+        buffer_pool<Char> pool;
     };
 
     struct no_buffering_policy
@@ -312,6 +669,12 @@ namespace boost { namespace spirit { namespace karma { namespace detail
             return true;
         }
 
+        template <typename Char>
+        bool output(Char const* /*first*/, std::size_t /*n*/) 
+        {
+            return true;
+        }
+
         bool has_buffer() const { return false; }
     };
 
@@ -344,6 +707,14 @@ namespace boost { namespace spirit { namespace karma { namespace detail
             this->tracking_policy::output(value);
             return this->buffering_policy::output(value);
         }
+
+        template <typename Char>
+        bool output(Char const* first, std::size_t n) 
+        { 
+            this->counting_policy::output(first, n);
+            this->tracking_policy::output(first, n);
+            return this->buffering_policy::output(first, n);
+        }
     };
 
     template <typename Buffering, typename Counting, typename Tracking>
@@ -370,6 +741,17 @@ namespace boost { namespace spirit { namespace karma { namespace detail
             return this->buffering_policy::output(value);
         }
 
+        template <typename Char>
+        bool output(Char const* first, std::size_t n) 
+        { 
+            if (!do_output) 
+                return false;
+
+            this->counting_policy::output(first, n);
+            this->tracking_policy::output(first, n);
+            return this->buffering_policy::output(first, n);
+        }
+
         bool do_output;
     };
 
@@ -392,7 +774,8 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 
         typedef typename mpl::if_c<
             (properties & generator_properties::buffering) ? true : false
-          , buffering_policy, no_buffering_policy
+          , buffering_policy<typename buffer_char<OutputIterator>::type>
+          , no_buffering_policy
         >::type buffering_type;
 
         typedef typename mpl::if_c<
@@ -474,6 +857,21 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 #pragma warning (pop)
 #endif
 
+        // output n characters at once
+        template <typename Char>
+        void write(Char const* first, std::size_t n)
+        {
+            if (this->base_iterator::output(first, n))
+                traits::write_to_sink(*sink, first, n);
+        }
+
+        // hint that about n more characters are going to be generated
+        void reserve(std::size_t n)
+        {
+            if (!this->base_iterator::has_buffer())
+                traits::reserve_sink(*sink, n);
+        }
+
         // plain output iterators are considered to be good all the time
         bool good() const { return true; }
 
@@ -546,9 +944,15 @@ namespace boost { namespace spirit { namespace karma { namespace detail
     template <typename OutputIterator>
     struct enable_buffering
     {
+    private:
+        typedef typename OutputIterator::buffering_policy::buffer_sink_type
+            buffer_sink_type;
+
+    public:
         enable_buffering(OutputIterator& sink_
               , std::size_t width = std::size_t(-1))
-          : sink(sink_), prev_buffer(NULL), enabled(false)
+          : sink(sink_), buffer_data(sink_.acquire_buffer())
+          , prev_buffer(NULL), enabled(false)
         {
             buffer_data.enable(width);
             prev_buffer = sink.chain_buffering(&buffer_data);
@@ -557,6 +961,7 @@ namespace boost { namespace spirit { namespace karma { namespace detail
         ~enable_buffering()
         {
             disable();
+            sink.release_buffer();
         }
 
         // reset buffer chain to initial state
@@ -600,8 +1005,8 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 
     private:
         OutputIterator& sink;
-        buffer_sink buffer_data;    // for buffering
-        buffer_sink* prev_buffer;   // previous buffer in chain
+        buffer_sink_type buffer_data;       // for buffering
+        buffer_sink_type* prev_buffer;      // previous buffer in chain
         bool enabled;
     };
 
@@ -640,5 +1045,36 @@ namespace boost { namespace spirit { namespace karma { namespace detail
 
 }}}}
 
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  Our own output iterators pass the characters through their policies
+    //  and write them to the wrapped output iterator at once, if appropriate.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Properties, typename Derived>
+    struct sink_write<
+        karma::detail::output_iterator<OutputIterator, Properties, Derived> >
+    {
+        template <typename Char>
+        static void call(karma::detail::output_iterator<
+                OutputIterator, Properties, Derived>& sink
+          , Char const* first, std::size_t n)
+        {
+            sink.write(first, n);
+        }
+    };
+
+    template <typename OutputIterator, typename Properties, typename Derived>
+    struct sink_reserve<
+        karma::detail::output_iterator<OutputIterator, Properties, Derived> >
+    {
+        static void call(karma::detail::output_iterator<
+                OutputIterator, Properties, Derived>& sink, std::size_t n)
+        {
+            sink.reserve(n);
+        }
+    };
+}}}
+
 #endif 
 
@@ -68,6 +68,30 @@ namespace boost { namespace spirit { namespace karma { namespace detail
         return detail::sink_is_good(sink);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  strings which don't need to be transformed are written at once
+    template <typename OutputIterator, typename Char>
+    inline bool string_generate(OutputIterator& sink, Char const* str
+      , pass_through_filter)
+    {
+        Char const* last = str;
+        while (*last != 0)
+            ++last;
+
+        traits::write_to_sink(sink, str, std::size_t(last - str));
+        return detail::sink_is_good(sink);
+    }
+
+    template <typename OutputIterator, typename Char, typename Traits
+      , typename Allocator>
+    inline bool string_generate(OutputIterator& sink
+      , std::basic_string<Char, Traits, Allocator> const& str
+      , pass_through_filter)
+    {
+        traits::write_to_sink(sink, str.data(), str.size());
+        return detail::sink_is_good(sink);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     //  generate a string without any transformation
     template <typename OutputIterator, typename Char>
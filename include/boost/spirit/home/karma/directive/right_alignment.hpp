@@ -107,6 +107,10 @@ namespace boost { namespace spirit { namespace karma
 
             buffering.disable();    // do not perform buffering any more
 
+            // the whole field is known now, let the sink prepare for it
+            traits::reserve_sink(sink
+              , (std::max)(std::size_t(width), buffering.buffer_size()));
+
             // generate the left padding
             detail::enable_counting<OutputIterator> counting(sink, buffering.buffer_size());
             while(r && counting.count() < width) 
@@ -12,10 +12,15 @@
 
 #include <boost/config.hpp>
 #include <boost/config/no_tr1/cmath.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/limits.hpp>
 
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/int.hpp>
 #include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
 #include <boost/spirit/home/support/char_class.hpp>
 #include <boost/spirit/home/support/unused.hpp>
 #include <boost/spirit/home/support/numeric_traits.hpp>
@@ -562,6 +567,41 @@ namespace boost { namespace spirit { namespace traits
 
 namespace boost { namespace spirit { namespace karma
 {
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        //  The decimal digits of all numbers from 0 to 99: "00010203...99"
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Dummy = void>
+        struct digit_pairs
+        {
+            static char const data[201];
+        };
+
+        template <typename Dummy>
+        char const digit_pairs<Dummy>::data[201] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+        ///////////////////////////////////////////////////////////////////////
+        //  Built-in integral types are converted to radix 10 and 16 using
+        //  the fast path of the int_inserter
+        ///////////////////////////////////////////////////////////////////////
+        template <unsigned Radix, typename T>
+        struct use_fast_int_inserter
+          : mpl::bool_<(10 == Radix || 16 == Radix) &&
+                is_integral<T>::value && !is_same<T, bool>::value>
+        {};
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     //
     //  The int_inserter template takes care of the integer to string
@@ -572,6 +612,10 @@ namespace boost { namespace spirit { namespace karma
     //      string length (complete unrolling).
     //      If not specified, this value defaults to 6.
     //
+    //  Built-in integral types are converted to radix 10 and 16 without
+    //  this loop, the digits are written right to left into a local buffer
+    //  (two decimal digits per division) and emitted from there at once.
+    //
     ///////////////////////////////////////////////////////////////////////////
 #define BOOST_KARMA_NUMERICS_INNER_LOOP_PREFIX(z, x, data)                    \
         if (!traits::test_zero(n)) {                                          \
@@ -623,10 +667,98 @@ namespace boost { namespace spirit { namespace karma
         static bool
         call(OutputIterator& sink, T n)
         {
-            return call(sink, n, n, 0);
+            return call_fast(sink, n
+              , detail::use_fast_int_inserter<Radix, T>());
         }
 
     private:
+        template <typename OutputIterator, typename T>
+        static bool
+        call_fast(OutputIterator& sink, T n, mpl::false_)
+        {
+            return call(sink, n, n, 0);
+        }
+
+        template <typename OutputIterator, typename T>
+        static bool
+        call_fast(OutputIterator& sink, T n, mpl::true_)
+        {
+            typedef typename make_unsigned<T>::type unsigned_type;
+
+            // large enough for the decimal and hexadecimal digits
+            char buffer[sizeof(unsigned_type) * 3];
+            char* end = buffer + sizeof(buffer);
+            char* first = digits(end, static_cast<unsigned_type>(n)
+              , mpl::int_<Radix>());
+
+            traits::write_to_sink(sink, first, std::size_t(end - first));
+            return true;
+        }
+
+        // write the digits of n right to left, ending at last
+        template <typename T>
+        static char* digits(char* last, T n, mpl::int_<10>)
+        {
+            return decimal_digits(last, n
+              , mpl::bool_<(sizeof(T) > sizeof(boost::uint32_t))>());
+        }
+
+        template <typename T>
+        static char* decimal_digits(char* last, T n, mpl::true_)
+        {
+            // split off 8 digits at a time until 32 bit arithmetics will do
+            while (n > T(0xffffffffu))
+            {
+                boost::uint32_t low = static_cast<boost::uint32_t>(n % 100000000u);
+                n /= 100000000u;
+                for (int j = 0; j != 4; ++j)
+                {
+                    unsigned const i = (low % 100) * 2;
+                    low /= 100;
+                    *--last = detail::digit_pairs<>::data[i + 1];
+                    *--last = detail::digit_pairs<>::data[i];
+                }
+            }
+            return decimal_digits(last, static_cast<boost::uint32_t>(n)
+              , mpl::false_());
+        }
+
+        template <typename T>
+        static char* decimal_digits(char* last, T n_, mpl::false_)
+        {
+            char const* pairs = detail::digit_pairs<>::data;
+            boost::uint32_t n = n_;
+            while (n >= 100)
+            {
+                unsigned const i = (n % 100) * 2;
+                n /= 100;
+                *--last = pairs[i + 1];
+                *--last = pairs[i];
+            }
+
+            if (n >= 10)
+            {
+                unsigned const i = n * 2;
+                *--last = pairs[i + 1];
+                *--last = pairs[i];
+            }
+            else
+            {
+                *--last = char('0' + n);
+            }
+            return last;
+        }
+
+        template <typename T>
+        static char* digits(char* last, T n, mpl::int_<16>)
+        {
+            do {
+                *--last = char(radix_type::call(static_cast<unsigned>(n & 0xf)));
+                n >>= 4;
+            } while (0 != n);
+            return last;
+        }
+
         // helper function returning the biggest number representable either in
         // a boost::long_long_type (if this does exist) or in a plain long
         // otherwise
@@ -653,7 +785,7 @@ namespace boost { namespace spirit { namespace karma
             if (std::fabs(n) < max_long())
             {
                 biggest_long_type l((biggest_long_type)n);
-                return call(sink, l, l, 0);
+                return call(sink, l);
             }
             return call(sink, n, n, 0);
         }
@@ -664,7 +796,7 @@ namespace boost { namespace spirit { namespace karma
             if (std::fabs(n) < max_long())
             {
                 biggest_long_type l((biggest_long_type)n);
-                return call(sink, l, l, 0);
+                return call(sink, l);
             }
             return call(sink, n, n, 0);
         }
@@ -675,7 +807,7 @@ namespace boost { namespace spirit { namespace karma
             if (std::fabs(n) < max_long())
             {
                 biggest_long_type l((biggest_long_type)n);
-                return call(sink, l, l, 0);
+                return call(sink, l);
             }
             return call(sink, n, n, 0);
         }
@@ -703,8 +835,7 @@ namespace boost { namespace spirit { namespace karma
         call(OutputIterator& sink, T const& n)
         {
             typedef typename traits::absolute_value<T>::type type;
-            type un = type(n);
-            return base_type::call(sink, un, un, 0);
+            return base_type::call(sink, type(n));
         }
     };
 
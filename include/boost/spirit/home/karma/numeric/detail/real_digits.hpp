@@ -0,0 +1,764 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_KARMA_REAL_DIGITS_OCT_17_2026_1030AM)
+#define BOOST_SPIRIT_KARMA_REAL_DIGITS_OCT_17_2026_1030AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cstring>
+
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/config/no_tr1/cmath.hpp>
+
+namespace boost { namespace spirit { namespace karma { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  Exact decimal digit generation for float and double.
+    //
+    //  shortest_digits() generates the shortest digit sequence which reads
+    //  back as the same value (the one closest to the value if there are
+    //  several), round_digits() the value correctly rounded to a given number
+    //  of digits.
+    //
+    //  The shortest digits are generated by the Grisu3 algorithm (Florian
+    //  Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with
+    //  Integers", 2010) using 64 bit integers only. In the rare cases Grisu3
+    //  can't decide, and for rounding, big integers are used (Steele & White,
+    //  Burger & Dybvig).
+    //
+    ///////////////////////////////////////////////////////////////////////////
+
+    // The digits of a value: 0.digits[0]...digits[length-1] * 10^point,
+    // no digits at all for zero
+    struct real_digits
+    {
+        char digits[32];
+        int length;
+        int point;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct ieee_format : mpl::false_ {};
+
+    template <>
+    struct ieee_format<double>
+      : mpl::bool_<std::numeric_limits<double>::is_iec559 &&
+            std::numeric_limits<double>::digits == 53>
+    {
+        typedef boost::uint64_t bits_type;
+        static int const significand_bits = 52;
+        static int const exponent_bits = 11;
+    };
+
+    template <>
+    struct ieee_format<float>
+      : mpl::bool_<std::numeric_limits<float>::is_iec559 &&
+            std::numeric_limits<float>::digits == 24>
+    {
+        typedef boost::uint32_t bits_type;
+        static int const significand_bits = 23;
+        static int const exponent_bits = 8;
+    };
+
+    // splits the positive value n into f * 2^e, lower_closer is true if the
+    // next smaller value is closer than the next larger one
+    template <typename T>
+    inline void decompose(T n, boost::uint64_t& f, int& e, bool& lower_closer)
+    {
+        typedef ieee_format<T> format;
+
+        typename format::bits_type bits;
+        std::memcpy(&bits, &n, sizeof(bits));
+
+        boost::uint64_t const hidden = 
+            boost::uint64_t(1) << format::significand_bits;
+        int const bias = 
+            (1 << (format::exponent_bits - 1)) - 1 + format::significand_bits;
+        int const biased_exponent = 
+            static_cast<int>(bits >> format::significand_bits) & 
+                ((1 << format::exponent_bits) - 1);
+
+        f = bits & (hidden - 1);
+        if (0 == biased_exponent)
+        {
+            e = 1 - bias;               // subnormal
+            lower_closer = false;
+        }
+        else
+        {
+            lower_closer = 0 == f && biased_exponent > 1;
+            f |= hidden;
+            e = biased_exponent - bias;
+        }
+    }
+
+    // an estimate of the decimal exponent k of f * 2^e, such that
+    // 10^(k-1) <= f * 2^e < 10^k, it may be one too small
+    inline int estimate_power(boost::uint64_t f, int e)
+    {
+        int bits = 0;
+        for (/**/; f != 0; f >>= 1)
+            ++bits;
+
+        using namespace std;
+        return static_cast<int>(
+            ceil((e + bits - 1) * 0.30102999566398114 - 1e-10));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  A floating point number with a 64 bit significand: f * 2^e
+    ///////////////////////////////////////////////////////////////////////////
+    struct diy_fp
+    {
+        diy_fp() : f(0), e(0) {}
+        diy_fp(boost::uint64_t f_, int e_) : f(f_), e(e_) {}
+
+        diy_fp normalized() const
+        {
+            boost::uint64_t g = f;
+            int x = e;
+            while (0 == (g & UINT64_C(0xffc0000000000000)))
+            {
+                g <<= 10;
+                x -= 10;
+            }
+            while (0 == (g & (boost::uint64_t(1) << 63)))
+            {
+                g <<= 1;
+                --x;
+            }
+            return diy_fp(g, x);
+        }
+
+        // the product, rounded to 64 bits
+        friend diy_fp operator*(diy_fp const& lhs, diy_fp const& rhs)
+        {
+            boost::uint64_t const mask = UINT64_C(0xffffffff);
+            boost::uint64_t const a = lhs.f >> 32, b = lhs.f & mask;
+            boost::uint64_t const c = rhs.f >> 32, d = rhs.f & mask;
+            boost::uint64_t const ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+            boost::uint64_t const middle = 
+                (bd >> 32) + (ad & mask) + (bc & mask) + (UINT64_C(1) << 31);
+            return diy_fp(ac + (ad >> 32) + (bc >> 32) + (middle >> 32)
+              , lhs.e + rhs.e + 64);
+        }
+
+        boost::uint64_t f;
+        int e;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Normalized 64 bit approximations (rounded to nearest) of the powers of
+    //  ten 10^k, for k = first + n * distance.
+    ///////////////////////////////////////////////////////////////////////////
+    struct cached_power_entry
+    {
+        boost::uint64_t significand;
+        short binary_exponent;
+    };
+
+    template <typename Dummy = void>
+    struct cached_power
+    {
+        static int const first = -348;
+        static int const distance = 8;
+
+        static cached_power_entry const table[87];
+
+        // returns a power of ten 10^k such that its product with a value
+        // having the binary exponent e has a binary exponent in [-60, -32]
+        static diy_fp get(int e, int& k)
+        {
+            using namespace std;
+            int const estimate = static_cast<int>(
+                ceil((-60 - (e + 64) + 63) * 0.30102999566398114));
+            int const index = (-first + estimate - 1) / distance + 1;
+            BOOST_ASSERT(index >= 0 && index < 87);
+
+            k = first + index * distance;
+            return diy_fp(table[index].significand
+              , table[index].binary_exponent);
+        }
+    };
+
+    template <typename Dummy>
+    int const cached_power<Dummy>::first;
+
+    template <typename Dummy>
+    int const cached_power<Dummy>::distance;
+
+    template <typename Dummy>
+    cached_power_entry const cached_power<Dummy>::table[87] =
+    {
+        { UINT64_C(0xfa8fd5a0081c0288), -1220 }, // 10^-348
+        { UINT64_C(0xbaaee17fa23ebf76), -1193 }, // 10^-340
+        { UINT64_C(0x8b16fb203055ac76), -1166 }, // 10^-332
+        { UINT64_C(0xcf42894a5dce35ea), -1140 }, // 10^-324
+        { UINT64_C(0x9a6bb0aa55653b2d), -1113 }, // 10^-316
+        { UINT64_C(0xe61acf033d1a45df), -1087 }, // 10^-308
+        { UINT64_C(0xab70fe17c79ac6ca), -1060 }, // 10^-300
+        { UINT64_C(0xff77b1fcbebcdc4f), -1034 }, // 10^-292
+        { UINT64_C(0xbe5691ef416bd60c), -1007 }, // 10^-284
+        { UINT64_C(0x8dd01fad907ffc3c),  -980 }, // 10^-276
+        { UINT64_C(0xd3515c2831559a83),  -954 }, // 10^-268
+        { UINT64_C(0x9d71ac8fada6c9b5),  -927 }, // 10^-260
+        { UINT64_C(0xea9c227723ee8bcb),  -901 }, // 10^-252
+        { UINT64_C(0xaecc49914078536d),  -874 }, // 10^-244
+        { UINT64_C(0x823c12795db6ce57),  -847 }, // 10^-236
+        { UINT64_C(0xc21094364dfb5637),  -821 }, // 10^-228
+        { UINT64_C(0x9096ea6f3848984f),  -794 }, // 10^-220
+        { UINT64_C(0xd77485cb25823ac7),  -768 }, // 10^-212
+        { UINT64_C(0xa086cfcd97bf97f4),  -741 }, // 10^-204
+        { UINT64_C(0xef340a98172aace5),  -715 }, // 10^-196
+        { UINT64_C(0xb23867fb2a35b28e),  -688 }, // 10^-188
+        { UINT64_C(0x84c8d4dfd2c63f3b),  -661 }, // 10^-180
+        { UINT64_C(0xc5dd44271ad3cdba),  -635 }, // 10^-172
+        { UINT64_C(0x936b9fcebb25c996),  -608 }, // 10^-164
+        { UINT64_C(0xdbac6c247d62a584),  -582 }, // 10^-156
+        { UINT64_C(0xa3ab66580d5fdaf6),  -555 }, // 10^-148
+        { UINT64_C(0xf3e2f893dec3f126),  -529 }, // 10^-140
+        { UINT64_C(0xb5b5ada8aaff80b8),  -502 }, // 10^-132
+        { UINT64_C(0x87625f056c7c4a8b),  -475 }, // 10^-124
+        { UINT64_C(0xc9bcff6034c13053),  -449 }, // 10^-116
+        { UINT64_C(0x964e858c91ba2655),  -422 }, // 10^-108
+        { UINT64_C(0xdff9772470297ebd),  -396 }, // 10^-100
+        { UINT64_C(0xa6dfbd9fb8e5b88f),  -369 }, // 10^-92
+        { UINT64_C(0xf8a95fcf88747d94),  -343 }, // 10^-84
+        { UINT64_C(0xb94470938fa89bcf),  -316 }, // 10^-76
+        { UINT64_C(0x8a08f0f8bf0f156b),  -289 }, // 10^-68
+        { UINT64_C(0xcdb02555653131b6),  -263 }, // 10^-60
+        { UINT64_C(0x993fe2c6d07b7fac),  -236 }, // 10^-52
+        { UINT64_C(0xe45c10c42a2b3b06),  -210 }, // 10^-44
+        { UINT64_C(0xaa242499697392d3),  -183 }, // 10^-36
+        { UINT64_C(0xfd87b5f28300ca0e),  -157 }, // 10^-28
+        { UINT64_C(0xbce5086492111aeb),  -130 }, // 10^-20
+        { UINT64_C(0x8cbccc096f5088cc),  -103 }, // 10^-12
+        { UINT64_C(0xd1b71758e219652c),   -77 }, // 10^-4
+        { UINT64_C(0x9c40000000000000),   -50 }, // 10^4
+        { UINT64_C(0xe8d4a51000000000),   -24 }, // 10^12
+        { UINT64_C(0xad78ebc5ac620000),     3 }, // 10^20
+        { UINT64_C(0x813f3978f8940984),    30 }, // 10^28
+        { UINT64_C(0xc097ce7bc90715b3),    56 }, // 10^36
+        { UINT64_C(0x8f7e32ce7bea5c70),    83 }, // 10^44
+        { UINT64_C(0xd5d238a4abe98068),   109 }, // 10^52
+        { UINT64_C(0x9f4f2726179a2245),   136 }, // 10^60
+        { UINT64_C(0xed63a231d4c4fb27),   162 }, // 10^68
+        { UINT64_C(0xb0de65388cc8ada8),   189 }, // 10^76
+        { UINT64_C(0x83c7088e1aab65db),   216 }, // 10^84
+        { UINT64_C(0xc45d1df942711d9a),   242 }, // 10^92
+        { UINT64_C(0x924d692ca61be758),   269 }, // 10^100
+        { UINT64_C(0xda01ee641a708dea),   295 }, // 10^108
+        { UINT64_C(0xa26da3999aef774a),   322 }, // 10^116
+        { UINT64_C(0xf209787bb47d6b85),   348 }, // 10^124
+        { UINT64_C(0xb454e4a179dd1877),   375 }, // 10^132
+        { UINT64_C(0x865b86925b9bc5c2),   402 }, // 10^140
+        { UINT64_C(0xc83553c5c8965d3d),   428 }, // 10^148
+        { UINT64_C(0x952ab45cfa97a0b3),   455 }, // 10^156
+        { UINT64_C(0xde469fbd99a05fe3),   481 }, // 10^164
+        { UINT64_C(0xa59bc234db398c25),   508 }, // 10^172
+        { UINT64_C(0xf6c69a72a3989f5c),   534 }, // 10^180
+        { UINT64_C(0xb7dcbf5354e9bece),   561 }, // 10^188
+        { UINT64_C(0x88fcf317f22241e2),   588 }, // 10^196
+        { UINT64_C(0xcc20ce9bd35c78a5),   614 }, // 10^204
+        { UINT64_C(0x98165af37b2153df),   641 }, // 10^212
+        { UINT64_C(0xe2a0b5dc971f303a),   667 }, // 10^220
+        { UINT64_C(0xa8d9d1535ce3b396),   694 }, // 10^228
+        { UINT64_C(0xfb9b7cd9a4a7443c),   720 }, // 10^236
+        { UINT64_C(0xbb764c4ca7a44410),   747 }, // 10^244
+        { UINT64_C(0x8bab8eefb6409c1a),   774 }, // 10^252
+        { UINT64_C(0xd01fef10a657842c),   800 }, // 10^260
+        { UINT64_C(0x9b10a4e5e9913129),   827 }, // 10^268
+        { UINT64_C(0xe7109bfba19c0c9d),   853 }, // 10^276
+        { UINT64_C(0xac2820d9623bf429),   880 }, // 10^284
+        { UINT64_C(0x80444b5e7aa7cf85),   907 }, // 10^292
+        { UINT64_C(0xbf21e44003acdd2d),   933 }, // 10^300
+        { UINT64_C(0x8e679c2f5e44ff8f),   960 }, // 10^308
+        { UINT64_C(0xd433179d9c8cb841),   986 }, // 10^316
+        { UINT64_C(0x9e19db92b4e31ba9),  1013 }, // 10^324
+        { UINT64_C(0xeb96bf6ebadf77d9),  1039 }, // 10^332
+        { UINT64_C(0xaf87023b9bf0ee6b),  1066 }  // 10^340
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Grisu3
+    ///////////////////////////////////////////////////////////////////////////
+
+    // the largest power of ten not larger than the (non-zero) number
+    inline void biggest_power_ten(boost::uint32_t number
+      , boost::uint32_t& power, int& exponent_plus_one)
+    {
+        power = 1;
+        exponent_plus_one = 1;
+        while (boost::uint64_t(power) * 10 <= number)
+        {
+            power *= 10;
+            ++exponent_plus_one;
+        }
+    }
+
+    // moves the last generated digit towards w as long as that is known to
+    // be closer, fails if it can't be decided whether the digits are the
+    // closest ones or inside the interval at all
+    inline bool round_weed(char* digits, int length
+      , boost::uint64_t distance_too_high_w, boost::uint64_t unsafe_interval
+      , boost::uint64_t rest, boost::uint64_t ten_kappa, boost::uint64_t unit)
+    {
+        boost::uint64_t const small_distance = distance_too_high_w - unit;
+        boost::uint64_t const big_distance = distance_too_high_w + unit;
+
+        while (rest < small_distance &&
+               unsafe_interval - rest >= ten_kappa &&
+               (rest + ten_kappa < small_distance ||
+                small_distance - rest >= rest + ten_kappa - small_distance))
+        {
+            --digits[length - 1];
+            rest += ten_kappa;
+        }
+
+        if (rest < big_distance &&
+            unsafe_interval - rest >= ten_kappa &&
+            (rest + ten_kappa < big_distance ||
+             big_distance - rest > rest + ten_kappa - big_distance))
+        {
+            return false;
+        }
+
+        return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+    }
+
+    // generates the digits of high, as few as needed to be inside the
+    // interval (low, high), the scaled values have an error of 1 ulp at most
+    inline bool digit_gen(diy_fp const& low, diy_fp const& w
+      , diy_fp const& high, char* digits, int& length, int& kappa)
+    {
+        boost::uint64_t unit = 1;
+        diy_fp const too_low(low.f - unit, low.e);
+        diy_fp const too_high(high.f + unit, high.e);
+        boost::uint64_t unsafe_interval = too_high.f - too_low.f;
+
+        int const shift = -w.e;
+        boost::uint64_t const one = boost::uint64_t(1) << shift;
+        boost::uint32_t integrals = static_cast<boost::uint32_t>(
+            too_high.f >> shift);
+        boost::uint64_t fractionals = too_high.f & (one - 1);
+
+        boost::uint32_t divisor;
+        biggest_power_ten(integrals, divisor, kappa);
+        length = 0;
+
+        while (kappa > 0)
+        {
+            digits[length++] = static_cast<char>('0' + integrals / divisor);
+            integrals %= divisor;
+            --kappa;
+
+            boost::uint64_t const rest = 
+                (boost::uint64_t(integrals) << shift) + fractionals;
+            if (rest < unsafe_interval)
+            {
+                return round_weed(digits, length, too_high.f - w.f
+                  , unsafe_interval, rest, boost::uint64_t(divisor) << shift
+                  , unit);
+            }
+            divisor /= 10;
+        }
+
+        for (;;)
+        {
+            fractionals *= 10;
+            unit *= 10;
+            unsafe_interval *= 10;
+
+            digits[length++] = static_cast<char>('0' + (fractionals >> shift));
+            fractionals &= one - 1;
+            --kappa;
+
+            if (fractionals < unsafe_interval)
+            {
+                return round_weed(digits, length, (too_high.f - w.f) * unit
+                  , unsafe_interval, fractionals, one, unit);
+            }
+        }
+    }
+
+    inline bool grisu3(boost::uint64_t f, int e, bool lower_closer
+      , real_digits& result)
+    {
+        diy_fp const w = diy_fp(f, e).normalized();
+
+        // the boundaries halfway to the neighbouring values
+        diy_fp const high = diy_fp((f << 1) + 1, e - 1).normalized();
+        diy_fp low = lower_closer ? 
+            diy_fp((f << 2) - 1, e - 2) : diy_fp((f << 1) - 1, e - 1);
+        low.f <<= low.e - high.e;
+        low.e = high.e;
+
+        int k = 0;
+        diy_fp const power = cached_power<>::get(w.e, k);
+        BOOST_ASSERT(w.e + power.e + 64 >= -60 && w.e + power.e + 64 <= -32);
+
+        int kappa = 0;
+        if (!digit_gen(low * power, w * power, high * power
+              , result.digits, result.length, kappa))
+        {
+            return false;
+        }
+
+        result.point = result.length + kappa - k;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Unsigned big integers, just large enough for the values used below
+    ///////////////////////////////////////////////////////////////////////////
+    class bignum
+    {
+    public:
+        bignum() : size(0) {}
+
+        explicit bignum(boost::uint64_t value)
+        {
+            assign(value);
+        }
+
+        void assign(boost::uint64_t value)
+        {
+            for (size = 0; value != 0; value >>= 32)
+                limbs[size++] = static_cast<boost::uint32_t>(value);
+        }
+
+        void multiply(boost::uint32_t factor)
+        {
+            boost::uint64_t carry = 0;
+            for (int i = 0; i != size; ++i)
+            {
+                carry += boost::uint64_t(limbs[i]) * factor;
+                limbs[i] = static_cast<boost::uint32_t>(carry);
+                carry >>= 32;
+            }
+            if (carry != 0)
+                push_back(static_cast<boost::uint32_t>(carry));
+        }
+
+        void multiply_pow10(int exponent)
+        {
+            static boost::uint32_t const powers[] = {
+                1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000
+            };
+
+            for (/**/; exponent >= 9; exponent -= 9)
+                multiply(1000000000);
+            multiply(powers[exponent]);
+        }
+
+        void shift_left(int bits)
+        {
+            if (0 == size)
+                return;
+
+            int const words = bits / 32;
+            bits %= 32;
+
+            if (bits != 0)
+            {
+                boost::uint32_t carry = 0;
+                for (int i = 0; i != size; ++i)
+                {
+                    boost::uint32_t const limb = limbs[i];
+                    limbs[i] = (limb << bits) | carry;
+                    carry = limb >> (32 - bits);
+                }
+                if (carry != 0)
+                    push_back(carry);
+            }
+
+            if (words != 0)
+            {
+                BOOST_ASSERT(size + words <= max_limbs);
+                for (int i = size - 1; i >= 0; --i)
+                    limbs[i + words] = limbs[i];
+                for (int i = 0; i != words; ++i)
+                    limbs[i] = 0;
+                size += words;
+            }
+        }
+
+        void add(bignum const& rhs)
+        {
+            int const n = (std::max)(size, rhs.size);
+            boost::uint64_t carry = 0;
+            for (int i = 0; i != n; ++i)
+            {
+                carry += boost::uint64_t(i < size ? limbs[i] : 0) + 
+                    (i < rhs.size ? rhs.limbs[i] : 0);
+                limbs[i] = static_cast<boost::uint32_t>(carry);
+                carry >>= 32;
+            }
+            size = n;
+            if (carry != 0)
+                push_back(static_cast<boost::uint32_t>(carry));
+        }
+
+        // rhs must not be larger than *this
+        void subtract(bignum const& rhs)
+        {
+            boost::uint64_t borrow = 0;
+            for (int i = 0; i != size; ++i)
+            {
+                boost::uint64_t const sub = borrow + 
+                    (i < rhs.size ? rhs.limbs[i] : 0);
+                borrow = limbs[i] < sub;
+                limbs[i] = static_cast<boost::uint32_t>(limbs[i] - sub);
+            }
+            BOOST_ASSERT(0 == borrow);
+            while (size != 0 && 0 == limbs[size - 1])
+                --size;
+        }
+
+        // divides by a divisor not more than 9 times smaller, leaving the 
+        // remainder
+        unsigned divide(bignum const& divisor)
+        {
+            unsigned quotient = 0;
+            while (compare(*this, divisor) >= 0)
+            {
+                subtract(divisor);
+                ++quotient;
+            }
+            return quotient;
+        }
+
+        friend int compare(bignum const& lhs, bignum const& rhs)
+        {
+            if (lhs.size != rhs.size)
+                return lhs.size < rhs.size ? -1 : 1;
+
+            for (int i = lhs.size - 1; i >= 0; --i)
+            {
+                if (lhs.limbs[i] != rhs.limbs[i])
+                    return lhs.limbs[i] < rhs.limbs[i] ? -1 : 1;
+            }
+            return 0;
+        }
+
+        // compares lhs1 + lhs2 to rhs
+        friend int compare(bignum const& lhs1, bignum const& lhs2
+          , bignum const& rhs)
+        {
+            bignum sum(lhs1);
+            sum.add(lhs2);
+            return compare(sum, rhs);
+        }
+
+    private:
+        // enough for 2^1100, the largest values are about 10 * 2^1076
+        static int const max_limbs = 36;
+
+        void push_back(boost::uint32_t limb)
+        {
+            BOOST_ASSERT(size < max_limbs);
+            limbs[size++] = limb;
+        }
+
+        boost::uint32_t limbs[max_limbs];
+        int size;
+    };
+
+    // the shortest digits of f * 2^e inside the rounding interval, the
+    // interval boundaries belong to the interval if f is even
+    inline void shortest_digits_exact(boost::uint64_t f, int e
+      , bool lower_closer, real_digits& result)
+    {
+        // f * 2^e = r / s, the interval is (r - m_minus, r + m_plus) / s
+        bignum r(f), s, m_plus, m_minus;
+        int const extra = lower_closer ? 2 : 1;
+        if (e >= 0)
+        {
+            r.shift_left(e + extra);
+            s.assign(boost::uint64_t(1) << extra);
+            m_plus.assign(boost::uint64_t(1) << (extra - 1));
+            m_plus.shift_left(e);
+            m_minus.assign(1);
+            m_minus.shift_left(e);
+        }
+        else
+        {
+            r.shift_left(extra);
+            s.assign(1);
+            s.shift_left(extra - e);
+            m_plus.assign(boost::uint64_t(1) << (extra - 1));
+            m_minus.assign(1);
+        }
+
+        // scale to r / s < 1
+        int k = estimate_power(f, e);
+        if (k >= 0)
+        {
+            s.multiply_pow10(k);
+        }
+        else
+        {
+            r.multiply_pow10(-k);
+            m_plus.multiply_pow10(-k);
+            m_minus.multiply_pow10(-k);
+        }
+
+        bool const even = 0 == (f & 1);
+        while (compare(r, m_plus, s) >= (even ? 0 : 1))
+        {
+            s.multiply(10);
+            ++k;
+        }
+
+        result.length = 0;
+        result.point = k;
+        for (;;)
+        {
+            r.multiply(10);
+            m_plus.multiply(10);
+            m_minus.multiply(10);
+
+            unsigned digit = r.divide(s);
+            bool const low = compare(r, m_minus) < (even ? 1 : 0);
+            bool const high = compare(r, m_plus, s) >= (even ? 0 : 1);
+
+            if (low && high)
+            {
+                // both digit and digit + 1 are inside, take the closer one
+                bignum twice(r);
+                twice.shift_left(1);
+                int const c = compare(twice, s);
+                if (c > 0 || (0 == c && (digit & 1)))
+                    ++digit;
+            }
+            else if (high)
+            {
+                ++digit;
+            }
+
+            BOOST_ASSERT(digit <= 9);
+            result.digits[result.length++] = static_cast<char>('0' + digit);
+            if (low || high)
+                break;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The shortest digits of the positive value n.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline void shortest_digits(T n, real_digits& result)
+    {
+        if (0 == n)
+        {
+            result.length = 0;
+            result.point = 1;
+            return;
+        }
+
+        boost::uint64_t f = 0;
+        int e = 0;
+        bool lower_closer = false;
+        decompose(n, f, e, lower_closer);
+
+        if (!grisu3(f, e, lower_closer, result))
+            shortest_digits_exact(f, e, lower_closer, result);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The positive value n correctly rounded (ties to even) to the given 
+    //  number of fractional digits in fixed notation, or to precision + 1 
+    //  significant digits in scientific notation. Trailing zeros are 
+    //  generated as well, no digits at all if the value rounds to zero.
+    //  This is for less than 17 significant digits only.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline void round_digits(T n, bool fixed, int precision
+      , real_digits& result)
+    {
+        result.length = 0;
+        result.point = 1;
+        if (0 == n)
+            return;
+
+        boost::uint64_t f = 0;
+        int e = 0;
+        bool lower_closer = false;
+        decompose(n, f, e, lower_closer);
+
+        // scale to 0.1 <= r / s < 1
+        bignum r(f), s(1);
+        if (e >= 0)
+            r.shift_left(e);
+        else
+            s.shift_left(-e);
+
+        int k = estimate_power(f, e);
+        if (k >= 0)
+            s.multiply_pow10(k);
+        else
+            r.multiply_pow10(-k);
+
+        while (compare(r, s) >= 0)
+        {
+            s.multiply(10);
+            ++k;
+        }
+
+        int const count = fixed ? k + precision : precision + 1;
+        BOOST_ASSERT(count < static_cast<int>(sizeof(result.digits)));
+        if (count < 0)
+            return;
+
+        for (int i = 0; i != count; ++i)
+        {
+            r.multiply(10);
+            result.digits[i] = static_cast<char>('0' + r.divide(s));
+        }
+        result.length = count;
+        result.point = k;
+
+        // round the remainder
+        r.shift_left(1);
+        int const c = compare(r, s);
+        bool const odd = count != 0 && ((result.digits[count - 1] - '0') & 1);
+        if (c < 0 || (0 == c && !odd))
+        {
+            if (0 == count)
+                result.point = 1;
+            return;
+        }
+
+        int i = count;
+        while (i != 0 && '9' == result.digits[i - 1])
+            result.digits[--i] = '0';
+
+        if (0 == i)
+        {
+            // all nines (or no digits at all) round up to a power of ten,
+            // which has one more digit in fixed notation
+            if (fixed)
+                result.digits[count] = '0';
+            result.digits[0] = '1';
+            result.length = fixed ? count + 1 : (std::max)(count, 1);
+            ++result.point;
+        }
+        else
+        {
+            ++result.digits[i - 1];
+        }
+    }
+}}}}
+
+#endif
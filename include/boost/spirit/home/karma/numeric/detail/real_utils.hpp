@@ -14,6 +14,7 @@
 #include <boost/config/no_tr1/cmath.hpp>
 #include <boost/detail/workaround.hpp>
 #include <boost/limits.hpp>
+#include <boost/mpl/bool.hpp>
 
 #include <boost/spirit/home/support/char_class.hpp>
 #include <boost/spirit/home/support/unused.hpp>
@@ -22,6 +23,7 @@
 #include <boost/spirit/home/karma/detail/generate_to.hpp>
 #include <boost/spirit/home/karma/detail/string_generate.hpp>
 #include <boost/spirit/home/karma/numeric/detail/numeric_utils.hpp>
+#include <boost/spirit/home/karma/numeric/detail/real_digits.hpp>
 
 namespace boost { namespace spirit { namespace karma 
 { 
@@ -182,6 +184,136 @@ namespace boost { namespace spirit { namespace karma
             return r;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        //  Generates the shortest digit sequence reading back as the same
+        //  value (rounded correctly to the precision returned by the
+        //  policies, if that is shorter). The digits are computed exactly
+        //  from the binary representation, so this is available for IEEE
+        //  float and double only, all other types use call_n() instead.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename OutputIterator, typename U>
+        static bool
+        call_shortest (OutputIterator& sink, U n, Policies const& p)
+        {
+            return call_shortest(sink, n, p, detail::ieee_format<U>());
+        }
+
+        template <typename OutputIterator, typename U>
+        static bool
+        call_shortest (OutputIterator& sink, U n, Policies const& p
+          , mpl::false_)
+        {
+            return call_n(sink, n, p);
+        }
+
+        template <typename OutputIterator, typename U>
+        static bool
+        call_shortest (OutputIterator& sink, U n, Policies const& p
+          , mpl::true_)
+        {
+        // prepare sign and get output format
+            bool force_sign = p.force_sign(n);
+            bool sign_val = false;
+            int flags = p.floatfield(n);
+            if (traits::test_negative(n))
+            {
+                n = -n;
+                sign_val = true;
+            }
+
+            bool const fixed = 0 != (Policies::fmtflags::fixed & flags);
+            unsigned precision = p.precision(n);
+
+        // compute the digits, round them only if there are more fractional
+        // digits than requested
+            detail::real_digits digits;
+            detail::shortest_digits(n, digits);
+
+            int frac_digits = digits.length - (fixed ? digits.point : 1);
+            if (frac_digits > 0 && unsigned(frac_digits) > precision)
+            {
+                detail::round_digits(n, fixed, int(precision), digits);
+                while (0 != digits.length &&
+                       '0' == digits.digits[digits.length - 1])
+                {
+                    --digits.length;
+                }
+            }
+
+            if (0 == digits.length)
+            {
+                // the result is zero, no sign please
+                digits.point = 1;
+                sign_val = false;
+                force_sign = false;
+            }
+
+        // the number of digits in front of and after the dot
+            int point = fixed ? digits.point : 1;
+            frac_digits = (std::max)(digits.length - point, 0);
+
+            unsigned prec = unsigned(frac_digits);
+            if (p.trailing_zeros(n))
+            {
+                // pad with zeros up to the precision, limited as in call_n()
+                unsigned max_prec = precision;
+                if (std::numeric_limits<U>::digits10)
+                {
+                    max_prec = (std::min)(max_prec,
+                        (unsigned)std::numeric_limits<U>::digits10 + 1);
+                }
+                prec = (std::max)(prec, max_prec);
+            }
+
+        // generate integer part
+            bool r = sign_inserter::call(sink, point <= 0 || 0 == digits.length
+                , sign_val, force_sign, force_sign);
+
+            if (point <= 0)
+            {
+                r = r && char_inserter<>::call(sink, '0');
+            }
+            else
+            {
+                int const n = (std::min)(point, digits.length);
+                traits::write_to_sink(sink, digits.digits, std::size_t(n));
+                for (int i = n; r && i != point; ++i)
+                    r = char_inserter<>::call(sink, '0');
+            }
+
+        // generate decimal point
+            U frac_part = 0;
+            for (int i = (std::max)(point, 0); i < digits.length; ++i)
+                frac_part = frac_part * 10 + (digits.digits[i] - '0');
+            r = r && p.dot(sink, frac_part, precision);
+
+        // generate fractional part, at least one digit if precision allows
+            if (0 == prec && 0 != precision)
+                prec = 1;
+
+            int const leading_zeros = (std::min)(-point, int(prec));
+            int i = 0;
+            for (/**/; r && i < leading_zeros; ++i)
+                r = char_inserter<>::call(sink, '0');
+
+            int const first = point + i;
+            if (r && unsigned(i) < prec && first < digits.length)
+            {
+                int const n = (std::min)(digits.length - first, int(prec) - i);
+                traits::write_to_sink(sink, digits.digits + first
+                  , std::size_t(n));
+                i += n;
+            }
+            for (/**/; r && unsigned(i) < prec; ++i)
+                r = char_inserter<>::call(sink, '0');
+
+            if (r && !fixed) {
+                return p.template exponent<CharEncoding, Tag>(sink,
+                    long(digits.point - 1));
+            }
+            return r;
+        }
+
 #if BOOST_WORKAROUND(BOOST_MSVC, >= 1400)
 # pragma warning(pop)
 #endif 
@@ -329,6 +329,43 @@ namespace boost { namespace spirit { namespace karma
                    string_inserter<CharEncoding, Tag>::call(sink, "inf");
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  shortest_real_policies generate the shortest digit sequence reading 
+    //  back as the same floating point number (for float and double, all 
+    //  other types are generated as by real_policies). The digits are 
+    //  computed exactly, if precision() is overloaded to return a smaller 
+    //  number of fractional digits the output is correctly rounded to it.
+    //  The digits are emitted directly, integer_part() and fraction_part() 
+    //  are not used.
+    //
+    //      typedef 
+    //          karma::real_generator<double, karma::shortest_real_policies<double> > 
+    //      shortest_type;
+    //
+    //      karma::generate(sink, shortest_type(), 0.1 + 0.2); 
+    //      // will output: 0.30000000000000004
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct shortest_real_policies : real_policies<T>
+    {
+        template <typename Inserter, typename OutputIterator, typename Policies>
+        static bool
+        call (OutputIterator& sink, T n, Policies const& p)
+        {
+            return Inserter::call_shortest(sink, n, p);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  By default the number of fractional digits is not limited.
+        ///////////////////////////////////////////////////////////////////////
+        static unsigned precision(T)
+        {
+            return (std::numeric_limits<unsigned>::max)();
+        }
+    };
 }}}
 
 #endif // defined(BOOST_SPIRIT_KARMA_REAL_POLICIES_MAR_02_2007_0936AM)
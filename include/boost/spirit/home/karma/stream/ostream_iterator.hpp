@@ -59,6 +59,9 @@ namespace boost { namespace spirit { namespace karma
         // expose good bit of underlying stream object
         bool good() const { return get_ostream().good(); }
 
+        // whether a delimiter is inserted after each value
+        bool has_delimiter() const { return 0 != delim; }
+
     protected:
         ostream_type *os;
         Elem const* delim;
@@ -24,6 +24,8 @@
 #include <boost/fusion/include/vector.hpp>
 #include <boost/mpl/assert.hpp>
 #include <boost/range/iterator_range.hpp>
+#include <boost/type_traits/is_class.hpp>
+#include <boost/utility/enable_if.hpp>
 #include <string>
 
 namespace boost { namespace spirit { namespace lex
@@ -341,7 +343,9 @@ namespace boost { namespace spirit { namespace lex
         {
             match_default = 0,          // no flags
             match_not_dot_newline = 1,  // the regex '.' doesn't match newlines
-            match_icase = 2             // all matching operations are case insensitive
+            match_icase = 2,            // all matching operations are case insensitive
+            match_lazy_dfa = 4,         // build the DFA states as they are reached
+            match_utf8 = 8              // regexes over code points, matching UTF-8 input
         };
     };
 
@@ -383,6 +387,18 @@ namespace boost { namespace spirit { namespace lex
           , self(this_(), lexer_type::initial_state()) 
         {}
 
+        //  construct the Lexer from previously saved tables (for instance
+        //  a lexertl::binary_state_machine)
+        template <typename Tables>
+        explicit lexer(Tables const& tables
+            , unsigned int flags = match_flags::match_default
+            , id_type first_id = id_type(min_token_id)
+            , typename enable_if<is_class<Tables> >::type* = 0)
+          : lexer_type(flags, tables)
+          , next_token_id(first_id)
+          , self(this_(), lexer_type::initial_state())
+        {}
+
         // access iterator interface
         template <typename Iterator>
         iterator_type begin(Iterator& first, Iterator const& last
@@ -0,0 +1,95 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXER_BATCH_TOKENIZER_OCT_16_2026_1145PM)
+#define BOOST_SPIRIT_LEX_LEXER_BATCH_TOKENIZER_OCT_16_2026_1145PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <cstddef>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  batch_tokenizer exposes the tokens recognized by a lexertl based dfa
+    //  (lexer) without going through a multi_pass iterator: every call to
+    //  next() fills a caller provided array of tokens. No tokens are
+    //  buffered and the tokenizer is not reference counted. The underlying
+    //  character iterator passed on construction is advanced past the
+    //  matched tokens.
+    //
+    //  The template parameter has the same semantics as described for the
+    //  functor (see lex/lexer/lexertl/functor.hpp).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Functor>
+    class batch_tokenizer
+    {
+    public:
+        typedef typename Functor::shared shared_functor_type;
+
+        typedef typename Functor::iterator_type base_iterator_type;
+        typedef typename Functor::result_type token_type;
+
+    private:
+        typedef typename Functor::char_type char_type;
+
+    public:
+        // create a new tokenizer encapsulating the lexer object to be used
+        // for tokenization
+        template <typename IteratorData>
+        batch_tokenizer(IteratorData const& iterdata_
+              , base_iterator_type& first, base_iterator_type const& last
+              , char_type const* state = 0)
+          : data_(iterdata_, first, last)
+        {
+            set_state(map_state(state));
+        }
+
+        //  Store the next (at most) count tokens in tokens, returning the
+        //  number of tokens stored. Fewer tokens are stored at the end of
+        //  the input only, or if the input doesn't match any token
+        //  definition, in which case the last token stored is invalid (see
+        //  token_is_valid()).
+        std::size_t next(token_type* tokens, std::size_t count)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                token_type& t = Functor::get_next(data_, tokens[i], ftor_.eof);
+                if (!token_is_valid(t))
+                    return (t == ftor_.eof) ? i : i + 1;
+            }
+            return count;
+        }
+
+        // set the new required state for the underlying lexer object
+        std::size_t set_state(std::size_t state)
+        {
+            std::size_t oldstate = data_.get_state();
+            data_.set_state(state);
+            return oldstate;
+        }
+
+        // get the curent state for the underlying lexer object
+        std::size_t get_state()
+        {
+            return data_.get_state();
+        }
+
+        // map the given state name to a corresponding state id as understood
+        // by the underlying lexer object
+        std::size_t map_state(char_type const* statename)
+        {
+            return (0 != statename) ? data_.get_state_id(statename) : 0;
+        }
+
+    private:
+        Functor ftor_;
+        shared_functor_type data_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,306 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_BINARY_STATE_MACHINE_OCT_17_2016_0845PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_BINARY_STATE_MACHINE_OCT_17_2016_0845PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/compact_state_machine.hpp>
+#include <boost/cstdint.hpp>
+#include <ostream>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  A binary_state_machine refers to the tables of a lexer's state machine
+    //  as written by save_binary(), e.g. a file mapped into memory. The
+    //  tables are used in place, so the memory has to be aligned to 8 bytes
+    //  and has to outlive all lexers using it.
+    //
+    //  The format is the compact tables (see compact_state_machine.hpp) with
+    //  a header:
+    //
+    //    header:   magic "SLXB", version, endianness tag, sizeof(size_t),
+    //              table entry size (2 or 4), character size, BOL/EOL flags,
+    //              the fingerprint of the rules, the number of DFAs, and the
+    //              total size
+    //    DFAs:     for each DFA (lexer state) the number of states, row
+    //              width, lookup size, and the offset and size of its tables
+    //    tables:   the tables of each DFA, 8 byte aligned
+    //
+    //  The header is checked when loading: a blob written on a platform with
+    //  a different endianness or size_t, for another character type, or from
+    //  different token definitions is not used. The tables themselves are
+    //  trusted.
+    ///////////////////////////////////////////////////////////////////////////
+    struct binary_state_machine
+    {
+        binary_state_machine() : data(0), size(0) {}
+        binary_state_machine(void const* data, std::size_t size)
+          : data(data), size(size) {}
+
+        void const* data;
+        std::size_t size;
+    };
+
+    namespace binary
+    {
+        boost::uint32_t const magic = 0x42584c53;   // "SLXB" little endian
+        boost::uint32_t const version = 1;
+        boost::uint32_t const endian = 0x01020304;
+        std::size_t const alignment = 8;
+
+        enum { bol_flag = 1, eol_flag = 2 };
+
+        struct header
+        {
+            boost::uint32_t magic;
+            boost::uint32_t version;
+            boost::uint32_t endian;
+            boost::uint8_t size_t_size;
+            boost::uint8_t index_size;
+            boost::uint8_t char_size;
+            boost::uint8_t flags;
+            boost::uint64_t fingerprint;
+            boost::uint64_t dfas;
+            boost::uint64_t size;
+        };
+
+        struct dfa_header
+        {
+            boost::uint64_t states;
+            boost::uint64_t width;
+            boost::uint64_t lookups;
+            boost::uint64_t offset;
+            boost::uint64_t size;
+        };
+
+        inline std::size_t align(std::size_t offset)
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  The fingerprint (FNV-1a) of everything the state machine is built
+        //  from.
+        ///////////////////////////////////////////////////////////////////////
+        class fingerprint_type
+        {
+        public:
+            fingerprint_type() : hash_(0xcbf29ce484222325ULL) {}
+
+            void add(boost::uint64_t value)
+            {
+                for (int i = 0; i != 8; ++i, value >>= 8)
+                {
+                    hash_ ^= value & 0xff;
+                    hash_ *= 0x100000001b3ULL;
+                }
+            }
+
+            template <typename Char>
+            void add(std::basic_string<Char> const& str)
+            {
+                add(str.size());
+                for (std::size_t i = 0; i != str.size(); ++i)
+                    add(static_cast<boost::uint64_t>(str[i]));
+            }
+
+            template <typename Sequence>
+            void add_each(Sequence const& seq)
+            {
+                add(seq.size());
+                for (typename Sequence::const_iterator it = seq.begin();
+                     it != seq.end(); ++it)
+                {
+                    add(*it);
+                }
+            }
+
+            boost::uint64_t value() const { return hash_; }
+
+        private:
+            boost::uint64_t hash_;
+        };
+
+        template <typename Char>
+        boost::uint64_t fingerprint(boost::lexer::basic_rules<Char> const& rules)
+        {
+            typedef boost::lexer::basic_rules<Char> rules_type;
+
+            fingerprint_type fp;
+            fp.add(static_cast<boost::uint64_t>(rules.flags()));
+
+            typename rules_type::string_size_t_map const& statemap =
+                rules.statemap();
+            fp.add(statemap.size());
+            for (typename rules_type::string_size_t_map::const_iterator it =
+                     statemap.begin(); it != statemap.end(); ++it)
+            {
+                fp.add(it->first);
+                fp.add(it->second);
+            }
+
+            typename rules_type::string_pair_deque const& macros =
+                rules.macrodeque();
+            fp.add(macros.size());
+            for (typename rules_type::string_pair_deque::const_iterator it =
+                     macros.begin(); it != macros.end(); ++it)
+            {
+                fp.add(it->first);
+                fp.add(it->second);
+            }
+
+            std::size_t const states = rules.regexes().size();
+            fp.add(states);
+            for (std::size_t i = 0; i != states; ++i)
+            {
+                typename rules_type::string_deque const& regexes =
+                    rules.regexes()[i];
+                fp.add(regexes.size());
+                for (std::size_t j = 0; j != regexes.size(); ++j)
+                    fp.add(regexes[j]);
+
+                fp.add_each(rules.ids()[i]);
+                fp.add_each(rules.unique_ids()[i]);
+                fp.add_each(rules.states()[i]);
+            }
+            return fp.value();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Write the given state machine, built from rules with the given
+    //  fingerprint.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    bool write_state_machine(std::ostream& os
+      , basic_compact_state_machine<Char> const& sm
+      , boost::uint64_t fingerprint)
+    {
+        std::size_t const dfas = sm.size();
+        std::size_t offset = binary::align(sizeof(binary::header)
+            + dfas * sizeof(binary::dfa_header));
+
+        std::vector<binary::dfa_header> descriptors(dfas);
+        for (std::size_t i = 0; i != dfas; ++i)
+        {
+            descriptors[i].states = sm[i].states();
+            descriptors[i].width = sm[i].width();
+            descriptors[i].lookups = sm[i].lookups();
+            descriptors[i].offset = offset;
+            descriptors[i].size = sm[i].size();
+            offset = binary::align(offset + sm[i].size());
+        }
+
+        binary::header header = binary::header();
+        header.magic = binary::magic;
+        header.version = binary::version;
+        header.endian = binary::endian;
+        header.size_t_size = sizeof(std::size_t);
+        header.index_size = sm.wide() ? 4 : 2;
+        header.char_size = sizeof(Char);
+        header.flags = (sm.seen_BOL_assertion() ? binary::bol_flag : 0)
+          | (sm.seen_EOL_assertion() ? binary::eol_flag : 0);
+        header.fingerprint = fingerprint;
+        header.dfas = dfas;
+        header.size = offset;
+
+        char const padding[binary::alignment] = { 0 };
+
+        os.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        if (dfas != 0)
+        {
+            os.write(reinterpret_cast<char const*>(&descriptors.front())
+              , dfas * sizeof(binary::dfa_header));
+        }
+        std::size_t written = sizeof(header) + dfas * sizeof(binary::dfa_header);
+        for (std::size_t i = 0; i != dfas; ++i)
+        {
+            os.write(padding, descriptors[i].offset - written);
+            os.write(reinterpret_cast<char const*>(sm[i].data()), sm[i].size());
+            written = descriptors[i].offset + sm[i].size();
+        }
+        os.write(padding, offset - written);
+        return os.good();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Make the given state machine use the tables of the blob, if they were
+    //  written on a compatible platform from rules with the given
+    //  fingerprint. Nothing is copied: only the per lexer state descriptors
+    //  are allocated.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    bool read_state_machine(binary_state_machine const& blob
+      , basic_compact_state_machine<Char>& sm, boost::uint64_t fingerprint)
+    {
+        char const* base = static_cast<char const*>(blob.data);
+        if (!base || blob.size < sizeof(binary::header) ||
+            reinterpret_cast<boost::uintptr_t>(base) % binary::alignment != 0)
+        {
+            return false;
+        }
+
+        binary::header const& header =
+            *reinterpret_cast<binary::header const*>(base);
+        if (header.magic != binary::magic ||
+            header.version != binary::version ||
+            header.endian != binary::endian ||
+            header.size_t_size != sizeof(std::size_t) ||
+            header.char_size != sizeof(Char) ||
+            (header.index_size != 2 && header.index_size != 4) ||
+            header.fingerprint != fingerprint ||
+            header.size > blob.size ||
+            header.dfas > (header.size - sizeof(binary::header))
+                / sizeof(binary::dfa_header))
+        {
+            return false;
+        }
+
+        std::size_t const dfas = static_cast<std::size_t>(header.dfas);
+        std::size_t const tables = sizeof(binary::header)
+            + dfas * sizeof(binary::dfa_header);
+        binary::dfa_header const* descriptors =
+            reinterpret_cast<binary::dfa_header const*>(
+                base + sizeof(binary::header));
+        bool const wide = header.index_size == 4;
+
+        std::vector<compact_dfa> result(dfas);
+        for (std::size_t i = 0; i != dfas; ++i)
+        {
+            binary::dfa_header const& d = descriptors[i];
+            if (d.offset < tables || d.offset % binary::alignment != 0 ||
+                d.offset > header.size || d.size > header.size - d.offset)
+            {
+                return false;
+            }
+
+            std::size_t const* data = reinterpret_cast<std::size_t const*>(
+                base + static_cast<std::size_t>(d.offset));
+            std::size_t const states = static_cast<std::size_t>(d.states);
+            std::size_t const width = static_cast<std::size_t>(d.width);
+            std::size_t const lookups = static_cast<std::size_t>(d.lookups);
+            if (wide)
+                result[i].template borrow<boost::uint32_t>(data, states, width, lookups);
+            else
+                result[i].template borrow<boost::uint16_t>(data, states, width, lookups);
+
+            if (result[i].size() != d.size || width < compact::row_offset)
+                return false;
+        }
+
+        sm.assign(result, wide, (header.flags & binary::bol_flag) != 0
+          , (header.flags & binary::eol_flag) != 0);
+        return true;
+    }
+}}}}
+
+#endif
@@ -0,0 +1,325 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_COMPACT_STATE_MACHINE_OCT_16_2016_1030PM)
+#define BOOST_SPIRIT_LEX_LEXERTL_COMPACT_STATE_MACHINE_OCT_16_2016_1030PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/support/detail/lexer/consts.hpp>
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+#include <boost/cstdint.hpp>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  The compact_dfa holds the tables of one lexer state's DFA as matched
+    //  against the input, in a single allocation:
+    //
+    //    accept: 3 std::size_t per DFA state (token id, unique id, and the
+    //            lexer state to switch to), read only on accepting states
+    //    lookup: the row column of every character (its equivalence class)
+    //    rows:   one row per DFA state: the end state flag, the BOL and EOL
+    //            transitions, a column which is always 0 (the dead state,
+    //            for the characters not used by any rule), and the
+    //            transitions on each equivalence class
+    //
+    //  The lookup and rows entries are 16 bit unless the DFA (or any other
+    //  DFA of the same state machine) has too many states or columns, in
+    //  which case they are 32 bit.
+    //
+    //  The tables are either owned, or borrowed from memory holding them
+    //  in this layout (see binary_state_machine.hpp).
+    //
+    //  Owned tables come with the literal chains of the DFA (see
+    //  boost/spirit/home/support/detail/lexer/literals.hpp), which let the
+    //  tokenizer match a run of states each left by a single character at
+    //  once. Borrowed tables don't have them.
+    ///////////////////////////////////////////////////////////////////////////
+    namespace compact
+    {
+        enum { end_state_index, bol_index, eol_index, dead_state_index
+          , row_offset };
+
+        enum { id_index, unique_id_index, state_index, accept_size };
+
+        // number of columns the lexertl tables have that the compact rows
+        // don't
+        std::size_t const column_shift =
+            boost::lexer::dfa_offset - row_offset;
+    }
+
+    class compact_dfa
+    {
+    public:
+        compact_dfa()
+          : borrowed_(0), size_(0), states_(0), width_(0), lookups_(0)
+          , lookup_offset_(0), rows_offset_(0) {}
+
+        std::size_t states() const { return states_; }
+        std::size_t width() const { return width_; }
+        std::size_t lookups() const { return lookups_; }
+
+        // all the tables, and their size in bytes
+        std::size_t const* data() const
+        {
+            return borrowed_ ? borrowed_ : &data_.front();
+        }
+        std::size_t size() const { return size_; }
+
+        // the byte offsets of the lookup and rows tables in data()
+        std::size_t lookup_offset() const { return lookup_offset_; }
+        std::size_t rows_offset() const { return rows_offset_; }
+
+        std::size_t const* accept() const { return data(); }
+
+        // the literal chains, or 0 if there are none
+        std::size_t const* literals() const
+        {
+            return literals_.empty() ? 0 : &literals_.front();
+        }
+
+        void assign_literals(std::vector<std::size_t> const& literals)
+        {
+            literals_ = literals;
+        }
+
+        template <typename Index>
+        Index const* lookup() const
+        {
+            return reinterpret_cast<Index const*>(
+                reinterpret_cast<char const*>(data()) + lookup_offset_);
+        }
+
+        template <typename Index>
+        Index const* rows() const
+        {
+            return reinterpret_cast<Index const*>(
+                reinterpret_cast<char const*>(data()) + rows_offset_);
+        }
+
+        // the size in bytes of the tables of a DFA of the given dimensions
+        template <typename Index>
+        static void layout(std::size_t states, std::size_t width
+          , std::size_t lookups, std::size_t& lookup_offset
+          , std::size_t& rows_offset, std::size_t& size)
+        {
+            lookup_offset = states * compact::accept_size * sizeof(std::size_t);
+            rows_offset = lookup_offset + lookups * sizeof(Index);
+            size = rows_offset + states * width * sizeof(Index);
+        }
+
+        // use the tables at data (which has to be aligned for std::size_t
+        // and outlive this object) without copying them
+        template <typename Index>
+        void borrow(std::size_t const* data, std::size_t states
+          , std::size_t width, std::size_t lookups)
+        {
+            std::vector<std::size_t>().swap(data_);
+            std::vector<std::size_t>().swap(literals_);
+            borrowed_ = data;
+            states_ = states;
+            width_ = width;
+            lookups_ = lookups;
+            layout<Index>(states, width, lookups, lookup_offset_, rows_offset_
+              , size_);
+        }
+
+        // does a DFA with this many states and columns need 32 bit entries
+        static bool needs_wide(std::size_t states, std::size_t width)
+        {
+            return states > 0xffff || width > 0xffff;
+        }
+
+        // convert the tables of the given lexertl DFA
+        template <typename Index>
+        void assign(std::size_t const* lookup, std::size_t lookups
+          , std::size_t const* dfa, std::size_t alphabet, std::size_t states)
+        {
+            using namespace boost::lexer;
+
+            borrowed_ = 0;
+            literals_.clear();
+            states_ = states;
+            lookups_ = lookups;
+            width_ = alphabet - compact::column_shift;
+
+            layout<Index>(states_, width_, lookups_, lookup_offset_
+              , rows_offset_, size_);
+            data_.assign((size_ + sizeof(std::size_t) - 1)
+                / sizeof(std::size_t), 0);
+
+            std::size_t* accept_ = &data_.front();
+            Index* lookup_ = const_cast<Index*>(this->lookup<Index>());
+            Index* rows_ = const_cast<Index*>(this->rows<Index>());
+
+            for (std::size_t i = 0; i != lookups; ++i)
+                lookup_[i] = static_cast<Index>(lookup[i] - compact::column_shift);
+
+            for (std::size_t s = 0; s != states; ++s)
+            {
+                std::size_t const* from = dfa + s * alphabet;
+                std::size_t* acc = accept_ + s * compact::accept_size;
+                Index* row = rows_ + s * width_;
+
+                acc[compact::id_index] = from[id_index];
+                acc[compact::unique_id_index] = from[unique_id_index];
+                acc[compact::state_index] = from[state_index];
+
+                row[compact::end_state_index] = from[end_state_index] != 0;
+                row[compact::bol_index] = static_cast<Index>(from[bol_index]);
+                row[compact::eol_index] = static_cast<Index>(from[eol_index]);
+                for (std::size_t c = dead_state_index; c != alphabet; ++c)
+                {
+                    row[c - compact::column_shift] =
+                        static_cast<Index>(from[c]);
+                }
+            }
+        }
+
+        void swap(compact_dfa& rhs)
+        {
+            data_.swap(rhs.data_);
+            literals_.swap(rhs.literals_);
+            std::swap(borrowed_, rhs.borrowed_);
+            std::swap(size_, rhs.size_);
+            std::swap(states_, rhs.states_);
+            std::swap(width_, rhs.width_);
+            std::swap(lookups_, rhs.lookups_);
+            std::swap(lookup_offset_, rhs.lookup_offset_);
+            std::swap(rows_offset_, rhs.rows_offset_);
+        }
+
+    private:
+        std::vector<std::size_t> data_;
+        std::vector<std::size_t> literals_;
+        std::size_t const* borrowed_;   // if not 0, used instead of data_
+        std::size_t size_;              // in bytes
+        std::size_t states_;
+        std::size_t width_;
+        std::size_t lookups_;
+        std::size_t lookup_offset_;     // in bytes
+        std::size_t rows_offset_;       // in bytes
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The compact_state_machine holds the compact_dfa of every lexer state
+    //  of a lexertl state machine.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    class basic_compact_state_machine
+    {
+    public:
+        basic_compact_state_machine()
+          : wide_(false), seen_BOL_assertion_(false)
+          , seen_EOL_assertion_(false) {}
+
+        explicit basic_compact_state_machine(
+                boost::lexer::basic_state_machine<Char> const& sm)
+          : wide_(false), seen_BOL_assertion_(false)
+          , seen_EOL_assertion_(false)
+        {
+            assign(sm);
+        }
+
+        void assign(boost::lexer::basic_state_machine<Char> const& sm)
+        {
+            boost::lexer::detail::internals const& internals = sm.data();
+            std::size_t const dfas = internals._dfa->size();
+
+            wide_ = false;
+            for (std::size_t i = 0; i != dfas; ++i)
+            {
+                std::size_t const alphabet = internals._dfa_alphabet[i];
+                if (alphabet != 0 && compact_dfa::needs_wide(
+                        internals._dfa[i]->size() / alphabet
+                      , alphabet - compact::column_shift))
+                {
+                    wide_ = true;
+                }
+            }
+
+            dfas_.clear();
+            dfas_.resize(dfas);
+            // the DFA of lexer states without any token definitions, which
+            // don't match anything
+            static std::size_t const no_match[2 * boost::lexer::dfa_offset] =
+                { 0 };
+
+            for (std::size_t i = 0; i != dfas; ++i)
+            {
+                std::size_t alphabet = internals._dfa_alphabet[i];
+                std::size_t const* lookup = &internals._lookup[i]->front();
+                std::size_t const lookups = internals._lookup[i]->size();
+                std::size_t const* dfa = no_match;
+                std::size_t states = 2;
+                if (alphabet == 0)
+                {
+                    alphabet = boost::lexer::dfa_offset;
+                }
+                else
+                {
+                    dfa = &internals._dfa[i]->front();
+                    states = internals._dfa[i]->size() / alphabet;
+                }
+
+                if (wide_)
+                {
+                    dfas_[i].template assign<boost::uint32_t>(
+                        lookup, lookups, dfa, alphabet, states);
+                }
+                else
+                {
+                    dfas_[i].template assign<boost::uint16_t>(
+                        lookup, lookups, dfa, alphabet, states);
+                }
+
+                if (dfa != no_match && i < internals._literals->size())
+                    dfas_[i].assign_literals(*internals._literals[i]);
+            }
+
+            seen_BOL_assertion_ = internals._seen_BOL_assertion;
+            seen_EOL_assertion_ = internals._seen_EOL_assertion;
+        }
+
+        // take over the given DFAs (see read_state_machine)
+        void assign(std::vector<compact_dfa>& dfas, bool wide
+          , bool seen_BOL_assertion, bool seen_EOL_assertion)
+        {
+            dfas_.swap(dfas);
+            wide_ = wide;
+            seen_BOL_assertion_ = seen_BOL_assertion;
+            seen_EOL_assertion_ = seen_EOL_assertion;
+        }
+
+        void clear()
+        {
+            dfas_.clear();
+            wide_ = seen_BOL_assertion_ = seen_EOL_assertion_ = false;
+        }
+
+        bool empty() const { return dfas_.empty(); }
+        std::size_t size() const { return dfas_.size(); }
+        compact_dfa const& operator[](std::size_t i) const { return dfas_[i]; }
+
+        // are the lookup and rows entries 32 bit (or 16 bit)
+        bool wide() const { return wide_; }
+
+        bool seen_BOL_assertion() const { return seen_BOL_assertion_; }
+        bool seen_EOL_assertion() const { return seen_EOL_assertion_; }
+
+    private:
+        std::vector<compact_dfa> dfas_;
+        bool wide_;
+        bool seen_BOL_assertion_;
+        bool seen_EOL_assertion_;
+    };
+}}}}
+
+#endif
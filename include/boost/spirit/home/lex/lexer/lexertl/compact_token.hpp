@@ -0,0 +1,429 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_COMPACT_TOKEN_OCT_17_2026_0010AM)
+#define BOOST_SPIRIT_LEX_COMPACT_TOKEN_OCT_17_2026_0010AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/spirit/home/qi/detail/assign_to.hpp>
+#include <boost/spirit/home/support/attributes.hpp>
+#include <boost/spirit/home/support/detail/lexer/consts.hpp>
+#include <boost/spirit/home/support/detail/lexer/runtime_error.hpp>
+#include <boost/spirit/home/support/utree/utree_traits_fwd.hpp>
+#include <boost/fusion/include/vector.hpp>
+#include <boost/detail/iterator.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <iterator>
+
+#if defined(BOOST_SPIRIT_DEBUG)
+#include <iosfwd>
+#endif
+
+#if !defined(BOOST_NO_CXX11_THREAD_LOCAL)
+#define BOOST_SPIRIT_COMPACT_TOKEN_THREAD_LOCAL thread_local
+#else
+#define BOOST_SPIRIT_COMPACT_TOKEN_THREAD_LOCAL
+#endif
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  compact_token_buffer marks the start of the input buffer the
+    //  compact_token instances created and accessed during its lifetime
+    //  refer to. It has to be created before the tokenization starts and
+    //  has to outlive any use of the token values:
+    //
+    //      lex::lexertl::compact_token_buffer<char const*> buffer(first);
+    //      iterator_type it = lexer.begin(first, last);
+    //
+    //  The buffer is per thread if the compiler supports thread_local,
+    //  otherwise only one thread at a time may use compact tokens of the
+    //  same iterator type. Nested buffers restore the outer one when they
+    //  are destroyed.
+    //
+    //  Tokens don't store the buffer they refer to: the value of a token
+    //  has to be accessed on the thread that created it, while the same
+    //  buffer is current. Accessing it on a thread without a buffer
+    //  throws boost::lexer::runtime_error; accessing it on a thread using
+    //  another buffer yields a range into that buffer.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    class compact_token_buffer
+    {
+    public:
+        explicit compact_token_buffer(Iterator const& base)
+          : outer_(current())
+        {
+            current() = base;
+            ++depth();
+        }
+
+        ~compact_token_buffer()
+        {
+            --depth();
+            current() = outer_;
+        }
+
+        // the start of the current input buffer
+        static Iterator const& base()
+        {
+            return current();
+        }
+
+        // whether there is a current input buffer (on this thread)
+        static bool active()
+        {
+            return depth() != 0;
+        }
+
+    private:
+        static Iterator& current()
+        {
+            static BOOST_SPIRIT_COMPACT_TOKEN_THREAD_LOCAL Iterator base_ =
+                Iterator();
+            return base_;
+        }
+
+        static std::size_t& depth()
+        {
+            static BOOST_SPIRIT_COMPACT_TOKEN_THREAD_LOCAL std::size_t depth_ = 0;
+            return depth_;
+        }
+
+        Iterator outer_;
+
+        // silence MSVC warning C4512: assignment operator could not be generated
+        compact_token_buffer(compact_token_buffer const&);
+        compact_token_buffer& operator= (compact_token_buffer const&);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  The compact_token is a token type storing the token id and the matched
+    //  input sequence as 32 bit values only: the offset of the sequence from
+    //  the start of the input buffer (see compact_token_buffer above) and its
+    //  length. The token value is not stored, it is converted from the
+    //  matched input sequence whenever it is accessed. A compact_token takes
+    //  16 bytes (12 bytes if it doesn't support lexer states), which keeps
+    //  the tokens buffered by the multi_pass iterator small.
+    //
+    //    template parameters:
+    //        Iterator        The type of the iterator used to access the
+    //                        underlying character stream, this has to be a
+    //                        random access iterator. The input buffer may
+    //                        not be larger than 4GB: constructing a token
+    //                        for a sequence starting or ending farther
+    //                        from the start of the buffer throws a
+    //                        boost::lexer::runtime_error.
+    //        HasState        A mpl::bool_ indicating, whether this token type
+    //                        should support lexer states.
+    //
+    //  Any token_def<> type may be used with this token type, no list of
+    //  attribute types is needed.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator = char const*
+      , typename HasState = mpl::true_>
+    struct compact_token;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  This specialization of the token type doesn't support working with
+    //  lexer states.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    struct compact_token<Iterator, mpl::false_>
+    {
+    private: // precondition assertions
+        BOOST_STATIC_ASSERT((is_convertible<
+            typename boost::detail::iterator_traits<Iterator>::iterator_category
+          , std::random_access_iterator_tag>::value));
+
+    protected:
+        typedef iterator_range<Iterator> iterpair_type;
+
+    public:
+        typedef Iterator iterator_type;
+        typedef mpl::false_ has_state;
+        typedef boost::uint32_t id_type;
+        typedef iterpair_type token_value_type;
+
+        //  default constructed tokens correspond to EOI tokens
+        compact_token()
+          : id_(id_type(boost::lexer::npos)), offset_(0), length_(0) {}
+
+        //  construct an invalid token
+        explicit compact_token(int)
+          : id_(id_type(0)), offset_(0), length_(0) {}
+
+        compact_token(id_type id, std::size_t)
+          : id_(id), offset_(0), length_(0) {}
+
+        compact_token(id_type id, std::size_t, token_value_type const& value)
+          : id_(id)
+        {
+            assign(value.begin(), value.end());
+        }
+
+        compact_token(id_type id, std::size_t, Iterator const& first
+              , Iterator const& last)
+          : id_(id)
+        {
+            assign(first, last);
+        }
+
+        //  this default conversion operator is needed to allow the direct
+        //  usage of tokens in conjunction with the primitive parsers defined
+        //  in Qi
+        operator id_type() const { return id_; }
+
+        //  Retrieve or set the token id of this token instance.
+        id_type id() const { return id_; }
+        void id(id_type newid) { id_ = newid; }
+
+        std::size_t state() const { return 0; }   // always '0' (INITIAL state)
+
+        bool is_valid() const
+        {
+            return 0 != id_ && id_type(boost::lexer::npos) != id_;
+        }
+
+        //  The matched input sequence, relative to the current
+        //  compact_token_buffer.
+        token_value_type value() const
+        {
+            // there is no compact_token_buffer on this thread: the token is
+            // accessed after its buffer is gone, or on another thread
+            if (!compact_token_buffer<Iterator>::active())
+            {
+                boost::throw_exception(boost::lexer::runtime_error(
+                    "compact_token: value accessed without a "
+                    "compact_token_buffer"));
+            }
+
+            Iterator first = compact_token_buffer<Iterator>::base() + offset_;
+            return token_value_type(first, first + length_);
+        }
+        token_value_type matched() const { return value(); }
+
+        std::size_t offset() const { return offset_; }
+        std::size_t length() const { return length_; }
+
+    private:
+        void assign(Iterator const& first, Iterator const& last)
+        {
+            std::ptrdiff_t offset =
+                first - compact_token_buffer<Iterator>::base();
+            std::ptrdiff_t length = last - first;
+
+            // the input buffer is too large for compact tokens (or the
+            // matched sequence is not in the current buffer)
+            if (offset < 0 || length < 0 ||
+                boost::uint64_t(offset) + boost::uint64_t(length) >
+                    0xffffffffULL)
+            {
+                boost::throw_exception(boost::lexer::runtime_error(
+                    "compact_token: matched input outside of the first 4GB "
+                    "of the compact_token_buffer"));
+            }
+
+            offset_ = static_cast<boost::uint32_t>(offset);
+            length_ = static_cast<boost::uint32_t>(length);
+        }
+
+    protected:
+        id_type id_;                // token id, 0 if nothing has been matched
+        boost::uint32_t offset_;    // start of the matched input sequence
+        boost::uint32_t length_;    // length of the matched input sequence
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  This specialization of the token type supports working with lexer
+    //  states.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    struct compact_token<Iterator, mpl::true_>
+      : compact_token<Iterator, mpl::false_>
+    {
+    private:
+        typedef compact_token<Iterator, mpl::false_> base_type;
+
+    public:
+        typedef typename base_type::id_type id_type;
+        typedef typename base_type::token_value_type token_value_type;
+        typedef Iterator iterator_type;
+        typedef mpl::true_ has_state;
+
+        //  default constructed tokens correspond to EOI tokens
+        compact_token() : state_(boost::uint32_t(boost::lexer::npos)) {}
+
+        //  construct an invalid token
+        explicit compact_token(int)
+          : base_type(0), state_(boost::uint32_t(boost::lexer::npos)) {}
+
+        compact_token(id_type id, std::size_t state)
+          : base_type(id, boost::lexer::npos)
+          , state_(boost::uint32_t(state)) {}
+
+        compact_token(id_type id, std::size_t state
+              , token_value_type const& value)
+          : base_type(id, boost::lexer::npos, value)
+          , state_(boost::uint32_t(state)) {}
+
+        compact_token(id_type id, std::size_t state
+              , Iterator const& first, Iterator const& last)
+          : base_type(id, boost::lexer::npos, first, last)
+          , state_(boost::uint32_t(state)) {}
+
+        std::size_t state() const
+        {
+            return state_ == boost::uint32_t(boost::lexer::npos) ?
+                boost::lexer::npos : state_;
+        }
+
+    protected:
+        boost::uint32_t state_;     // lexer state this token was matched in
+    };
+
+#if defined(BOOST_SPIRIT_DEBUG)
+    template <typename Char, typename Traits, typename Iterator
+      , typename HasState>
+    inline std::basic_ostream<Char, Traits>&
+    operator<< (std::basic_ostream<Char, Traits>& os
+      , compact_token<Iterator, HasState> const& t)
+    {
+        if (t.is_valid()) {
+            iterator_range<Iterator> const r = t.value();
+            for (Iterator it = r.begin(); it != r.end(); ++it)
+                os << *it;
+        }
+        else {
+            os << "<invalid token>";
+        }
+        return os;
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  tokens are considered equal, if their id's match (these are unique)
+    template <typename Iterator, typename HasState>
+    inline bool
+    operator== (compact_token<Iterator, HasState> const& lhs,
+                compact_token<Iterator, HasState> const& rhs)
+    {
+        return lhs.id() == rhs.id();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  This overload is needed by the multi_pass/functor_input_policy to
+    //  validate a token instance. It has to be defined in the same namespace
+    //  as the token class itself to allow ADL to find it.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename HasState>
+    inline bool
+    token_is_valid(compact_token<Iterator, HasState> const& t)
+    {
+        return t.is_valid();
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  We have to provide specializations for the customization point
+    //  assign_to_attribute_from_value allowing to extract the needed value
+    //  from the token.
+    ///////////////////////////////////////////////////////////////////////////
+
+    //  This is called from the parse function of token_def, the matched input
+    //  sequence is converted to the required type on every access.
+    template <typename Attribute, typename Iterator, typename HasState>
+    struct assign_to_attribute_from_value<Attribute
+      , lex::lexertl::compact_token<Iterator, HasState> >
+    {
+        static void
+        call(lex::lexertl::compact_token<Iterator, HasState> const& t
+          , Attribute& attr)
+        {
+            iterator_range<Iterator> const ip = t.value();
+            spirit::traits::assign_to(ip.begin(), ip.end(), attr);
+        }
+    };
+
+    template <typename Attribute, typename Iterator, typename HasState>
+    struct assign_to_container_from_value<Attribute
+          , lex::lexertl::compact_token<Iterator, HasState> >
+      : assign_to_attribute_from_value<Attribute
+          , lex::lexertl::compact_token<Iterator, HasState> >
+    {};
+
+    template <typename Iterator, typename HasState>
+    struct assign_to_container_from_value<utree
+          , lex::lexertl::compact_token<Iterator, HasState> >
+      : assign_to_attribute_from_value<utree
+          , lex::lexertl::compact_token<Iterator, HasState> >
+    {};
+
+    //  This is called from the parse function of lexer_def_
+    template <typename Iterator, typename HasState, typename Idtype_>
+    struct assign_to_attribute_from_value<
+        fusion::vector2<Idtype_, iterator_range<Iterator> >
+      , lex::lexertl::compact_token<Iterator, HasState> >
+    {
+        static void
+        call(lex::lexertl::compact_token<Iterator, HasState> const& t
+          , fusion::vector2<Idtype_, iterator_range<Iterator> >& attr)
+        {
+            //  The type returned by the lexer_def_ parser components is a
+            //  fusion::vector containing the token id of the matched token
+            //  and the pair of iterators to the matched character sequence.
+            typedef fusion::vector2<Idtype_, iterator_range<Iterator> >
+                attribute_type;
+
+            attr = attribute_type(t.id(), t.value());
+        }
+    };
+
+    template <typename Iterator, typename HasState, typename Idtype_>
+    struct assign_to_container_from_value<
+            fusion::vector2<Idtype_, iterator_range<Iterator> >
+          , lex::lexertl::compact_token<Iterator, HasState> >
+      : assign_to_attribute_from_value<
+            fusion::vector2<Idtype_, iterator_range<Iterator> >
+          , lex::lexertl::compact_token<Iterator, HasState> >
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Overload debug output for a single token, this integrates lexer tokens
+    // with Qi's simple_trace debug facilities
+    template <typename Iterator, typename HasState>
+    struct token_printer_debug<lex::lexertl::compact_token<Iterator, HasState> >
+    {
+        typedef lex::lexertl::compact_token<Iterator, HasState> token_type;
+
+        template <typename Out>
+        static void print(Out& out, token_type const& val)
+        {
+            out << '[';
+            spirit::traits::print_token(out, val.value());
+            out << ']';
+        }
+    };
+}}}
+
+#undef BOOST_SPIRIT_COMPACT_TOKEN_THREAD_LOCAL
+
+#endif
@@ -130,17 +130,23 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         template <typename MultiPass>
         static result_type& get_next(MultiPass& mp, result_type& result)
         {
+#if defined(BOOST_SPIRIT_STATIC_EOF)
+            return get_next(mp.shared()->ftor, result, eof);
+#else
+            return get_next(mp.shared()->ftor, result, mp.ftor.eof);
+#endif
+        }
+
+        // match the next token, this is used directly by the batch_tokenizer
+        static result_type& 
+        get_next(shared& data, result_type& result, result_type const& eof_token)
+        {
             typedef typename result_type::id_type id_type;
 
-            shared& data = mp.shared()->ftor;
             for(;;) 
             {
                 if (data.get_first() == data.get_last()) 
-#if defined(BOOST_SPIRIT_STATIC_EOF)
-                    return result = eof;
-#else
-                    return result = mp.ftor.eof;
-#endif
+                    return result = eof_token;
 
                 data.reset_value();
                 Iterator end = data.get_first();
@@ -164,11 +170,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                     return result = result_type(0);
                 }
                 else if (0 == id) {         // EOF reached
-#if defined(BOOST_SPIRIT_STATIC_EOF)
-                    return result = eof;
-#else
-                    return result = mp.ftor.eof;
-#endif
+                    return result = eof_token;
                 }
 
 #if defined(BOOST_SPIRIT_LEXERTL_DEBUG)
@@ -14,6 +14,8 @@
 #include <boost/spirit/home/support/detail/lexer/generator.hpp>
 #include <boost/spirit/home/support/detail/lexer/rules.hpp>
 #include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+#include <boost/spirit/home/support/detail/lexer/lazy_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/compact_state_machine.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/semantic_action_data.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/wrap_action.hpp>
@@ -57,8 +59,11 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             data (IterData const& data_, Iterator& first, Iterator const& last)
               : first_(first), last_(last)
               , state_machine_(data_.state_machine_)
+              , lazy_state_machine_(data_.lazy_state_machine_)
               , rules_(data_.rules_)
-              , bol_(data_.state_machine_.data()._seen_BOL_assertion) {}
+              , bol_(lazy_state_machine_ ?
+                    lazy_state_machine_->seen_BOL_assertion() :
+                    data_.state_machine_.seen_BOL_assertion()) {}
 
             // The following functions are used by the implementation of the 
             // placeholder '_state'.
@@ -154,6 +159,11 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                 prev_bol = bol_;
 
                 typedef basic_iterator_tokeniser<Iterator> tokenizer;
+                if (lazy_state_machine_)
+                {
+                    return tokenizer::next(*lazy_state_machine_, bol_, end
+                      , last_, unique_id);
+                }
                 return tokenizer::next(state_machine_, bol_, end, last_
                   , unique_id);
             }
@@ -184,10 +194,28 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             void reset_bol(bool bol) { bol_ = bol; }
 
         protected:
+            // match the next token starting in the given lexer state
+            std::size_t next_token(std::size_t& state, bool& bol
+              , Iterator& end, std::size_t& unique_id)
+            {
+                typedef basic_iterator_tokeniser<Iterator> tokenizer;
+                if (lazy_state_machine_)
+                {
+                    return tokenizer::next(*lazy_state_machine_, state, bol
+                      , end, last_, unique_id);
+                }
+                return tokenizer::next(state_machine_, state, bol, end
+                  , last_, unique_id);
+            }
+
             Iterator& first_;
             Iterator last_;
 
-            boost::lexer::basic_state_machine<char_type> const& state_machine_;
+            basic_compact_state_machine<char_type> const& state_machine_;
+            // the DFA built while tokenizing, if any (see
+            // match_flags::match_lazy_dfa)
+            boost::lexer::basic_lazy_state_machine<char_type>*
+                lazy_state_machine_;
             boost::lexer::basic_rules<char_type> const& rules_;
 
             bool bol_;      // helper storing whether last character was \n
@@ -254,9 +282,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             {
                 prev_bol = this->bol_;
 
-                typedef basic_iterator_tokeniser<Iterator> tokenizer;
-                return tokenizer::next(this->state_machine_, state_, 
-                    this->bol_, end, this->get_eoi(), unique_id);
+                return this->next_token(state_, this->bol_, end, unique_id);
             }
 
             std::size_t& get_state() { return state_; }
@@ -348,9 +374,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                 if (std::size_t(~0) == state)
                     state = this->state_;
 
-                typedef basic_iterator_tokeniser<Iterator> tokenizer;
-                return id == tokenizer::next(this->state_machine_, state, 
-                    bol, end, this->get_eoi(), unique_id);
+                return id == this->next_token(state, bol, end, unique_id);
             }
 
             // The adjust_start() and revert_adjust_start() are helper 
@@ -488,9 +512,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                 if (std::size_t(~0) == state)
                     state = this->state_;
 
-                typedef basic_iterator_tokeniser<Iterator> tokenizer;
-                return id == tokenizer::next(this->state_machine_, state, 
-                    bol, end, this->get_eoi(), unique_id);
+                return id == this->next_token(state, bol, end, unique_id);
             }
 
             // The adjust_start() and revert_adjust_start() are helper 
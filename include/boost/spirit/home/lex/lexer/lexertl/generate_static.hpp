@@ -17,14 +17,79 @@
 #include <boost/spirit/home/support/detail/lexer/size_t.hpp>
 #include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
 #include <boost/spirit/home/support/detail/lexer/debug.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/compact_state_machine.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/static_version.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/scoped_array.hpp>
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace boost { namespace spirit { namespace lex { namespace lexertl
 {
+    ///////////////////////////////////////////////////////////////////////////
+    //  The number of visits of every state of the DFAs of a lexer and how
+    //  many of those came from the state looping back to itself, recorded
+    //  by record_state_profile (see below) and used by
+    //  generate_static_threaded to lay out the states of the generated
+    //  tokenizer and to decide which states are worth scanning.
+    ///////////////////////////////////////////////////////////////////////////
+    class state_profile
+    {
+    public:
+        std::size_t visits(std::size_t dfa, std::size_t state) const
+        {
+            return get(visits_, dfa, state);
+        }
+
+        std::size_t loops(std::size_t dfa, std::size_t state) const
+        {
+            return get(loops_, dfa, state);
+        }
+
+        void visit(std::size_t dfa, std::size_t state, bool loop = false)
+        {
+            ++at(visits_, dfa, state);
+            if (loop)
+                ++at(loops_, dfa, state);
+        }
+
+        bool empty() const { return visits_.empty(); }
+
+        void clear()
+        {
+            visits_.clear();
+            loops_.clear();
+        }
+
+    private:
+        typedef std::vector<std::vector<std::size_t> > counts_type;
+
+        static std::size_t get(counts_type const& counts, std::size_t dfa
+          , std::size_t state)
+        {
+            if (dfa >= counts.size() || state >= counts[dfa].size())
+                return 0;
+            return counts[dfa][state];
+        }
+
+        static std::size_t& at(counts_type& counts, std::size_t dfa
+          , std::size_t state)
+        {
+            if (dfa >= counts.size())
+                counts.resize(dfa + 1);
+            if (state >= counts[dfa].size())
+                counts[dfa].resize(state + 1, 0);
+            return counts[dfa][state];
+        }
+
+        counts_type visits_;
+        counts_type loops_;
+    };
+
     namespace detail
     {
 
@@ -179,18 +244,61 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         return os_.good();
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // generate a static array initialized with the given values
+    template <typename Char, typename T>
+    inline void
+    generate_table(std::basic_ostream<Char>& os_, char const* type_
+      , std::basic_string<Char> const& name_, T const* values_
+      , std::size_t count_)
+    {
+        os_ << "    static " << type_ << " const " << name_ << "["
+            << count_ << "] = {\n        ";
+        for (std::size_t i_ = 0; i_ < count_; ++i_)
+        {
+            if (i_ != 0)
+            {
+                os_ << ((i_ % 8) ? ", " : ",\n        ");
+            }
+            os_ << static_cast<std::size_t>(values_[i_]);
+        }
+        os_ << " };\n";
+    }
+
+    // generate the tables of one lexer state's DFA in the compact layout
+    // (see compact_state_machine.hpp)
+    template <typename Index, typename Char>
+    inline void
+    generate_compact_tables(std::basic_ostream<Char>& os_
+      , char const* index_type_, compact_dfa const& dfa_
+      , std::basic_string<Char> const& suffix_)
+    {
+        generate_table(os_, index_type_, L<Char>("lookup") + suffix_ + L<Char>("_")
+          , dfa_.lookup<Index>(), dfa_.lookups());
+        generate_table(os_, index_type_, L<Char>("dfa") + suffix_ + L<Char>("_")
+          , dfa_.rows<Index>(), dfa_.states() * dfa_.width());
+        generate_table(os_, "std::size_t", L<Char>("accept") + suffix_ + L<Char>("_")
+          , dfa_.accept(), dfa_.states() * compact::accept_size);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // generate function body based on traversing the DFA tables
     template <typename Char>
     bool generate_function_body_dfa(std::basic_ostream<Char>& os_
       , boost::lexer::basic_state_machine<Char> const &sm_)
     {
-        std::size_t const dfas_ = sm_.data()._dfa->size();
+        basic_compact_state_machine<Char> const csm_(sm_);
+        std::size_t const dfas_ = csm_.size();
         std::size_t const lookups_ = sm_.data()._lookup->front()->size();
-
-        os_ << "    enum {end_state_index, id_index, unique_id_index, "
-               "state_index, bol_index,\n";
-        os_ << "        eol_index, dead_state_index, dfa_offset};\n\n";
+        char const* index_type_ =
+            csm_.wide() ? "boost::uint32_t" : "boost::uint16_t";
+        bool const bol_ = csm_.seen_BOL_assertion();
+        bool const eol_ = csm_.seen_EOL_assertion();
+
+        os_ << "    enum {end_state_index, bol_index, eol_index, "
+               "dead_state_index, row_offset};\n";
+        os_ << "    enum {id_index, unique_id_index, state_index, "
+               "accept_size};\n\n";
         os_ << "    static std::size_t const npos = "
                "static_cast<std::size_t>(~0);\n";
 
@@ -198,154 +306,67 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         {
             for (std::size_t state_ = 0; state_ < dfas_; ++state_)
             {
-                std::size_t i_ = 0;
-                std::size_t j_ = 1;
-                std::size_t count_ = lookups_ / 8;
-                std::size_t const* lookup_ = &sm_.data()._lookup[state_]->front();
-                std::size_t const* dfa_ = &sm_.data()._dfa[state_]->front();
-
-                os_ << "    static std::size_t const lookup" << state_
-                    << "_[" << lookups_ << "] = {\n        ";
-                for (/**/; i_ < count_; ++i_)
-                {
-                    std::size_t const index_ = i_ * 8;
-                    os_ << lookup_[index_];
-                    for (/**/; j_ < 8; ++j_)
-                    {
-                        os_ << ", " << lookup_[index_ + j_];
-                    }
-                    if (i_ < count_ - 1)
-                    {
-                        os_ << ",\n        ";
-                    }
-                    j_ = 1;
-                }
-                os_ << " };\n";
-
-                count_ = sm_.data()._dfa[state_]->size ();
-                os_ << "    static const std::size_t dfa" << state_ << "_["
-                    << count_ << "] = {\n        ";
-                count_ /= 8;
-                for (i_ = 0; i_ < count_; ++i_)
+                std::basic_string<Char> suffix_ =
+                    boost::lexical_cast<std::basic_string<Char> >(state_);
+                if (csm_.wide())
                 {
-                    std::size_t const index_ = i_ * 8;
-                    os_ << dfa_[index_];
-                    for (j_ = 1; j_ < 8; ++j_)
-                    {
-                        os_ << ", " << dfa_[index_ + j_];
-                    }
-                    if (i_ < count_ - 1)
-                    {
-                        os_ << ",\n        ";
-                    }
+                    generate_compact_tables<boost::uint32_t>(os_, index_type_
+                      , csm_[state_], suffix_);
                 }
-
-                std::size_t const mod_ = sm_.data()._dfa[state_]->size () % 8;
-                if (mod_)
+                else
                 {
-                    std::size_t const index_ = count_ * 8;
-                    if (count_)
-                    {
-                        os_ << ",\n        ";
-                    }
-                    os_ << dfa_[index_];
-                    for (j_ = 1; j_ < mod_; ++j_)
-                    {
-                        os_ << ", " << dfa_[index_ + j_];
-                    }
+                    generate_compact_tables<boost::uint16_t>(os_, index_type_
+                      , csm_[state_], suffix_);
                 }
-                os_ << " };\n";
             }
 
-            std::size_t count_ = sm_.data()._dfa_alphabet.size();
-            std::size_t i_ = 1;
-
-            os_ << "    static std::size_t const* lookup_arr_[" << count_
-                << "] = { lookup0_";
-            for (i_ = 1; i_ < count_; ++i_)
+            os_ << "    static " << index_type_ << " const* lookup_arr_["
+                << dfas_ << "] = { lookup0_";
+            for (std::size_t i_ = 1; i_ < dfas_; ++i_)
             {
                 os_ << ", " << "lookup" << i_ << "_";
             }
             os_ << " };\n";
 
             os_ << "    static std::size_t const dfa_alphabet_arr_["
-                << count_ << "] = { ";
-            os_ << sm_.data()._dfa_alphabet.front ();
-            for (i_ = 1; i_ < count_; ++i_)
+                << dfas_ << "] = { ";
+            os_ << csm_[0].width();
+            for (std::size_t i_ = 1; i_ < dfas_; ++i_)
             {
-                os_ << ", " << sm_.data()._dfa_alphabet[i_];
+                os_ << ", " << csm_[i_].width();
             }
             os_ << " };\n";
 
-            os_ << "    static std::size_t const* dfa_arr_[" << count_
-                << "] = { ";
-            os_ << "dfa0_";
-            for (i_ = 1; i_ < count_; ++i_)
+            os_ << "    static " << index_type_ << " const* dfa_arr_["
+                << dfas_ << "] = { dfa0_";
+            for (std::size_t i_ = 1; i_ < dfas_; ++i_)
             {
                 os_ << ", " << "dfa" << i_ << "_";
             }
             os_ << " };\n";
-        }
-        else
-        {
-            std::size_t const* lookup_ = &sm_.data()._lookup[0]->front();
-            std::size_t const* dfa_ = &sm_.data()._dfa[0]->front();
-            std::size_t i_ = 0;
-            std::size_t j_ = 1;
-            std::size_t count_ = lookups_ / 8;
 
-            os_ << "    static std::size_t const lookup_[";
-            os_ << sm_.data()._lookup[0]->size() << "] = {\n        ";
-            for (/**/; i_ < count_; ++i_)
+            os_ << "    static std::size_t const* accept_arr_["
+                << dfas_ << "] = { accept0_";
+            for (std::size_t i_ = 1; i_ < dfas_; ++i_)
             {
-                const std::size_t index_ = i_ * 8;
-                os_ << lookup_[index_];
-                for (/**/; j_ < 8; ++j_)
-                {
-                    os_ << ", " << lookup_[index_ + j_];
-                }
-                if (i_ < count_ - 1)
-                {
-                    os_ << ",\n        ";
-                }
-                j_ = 1;
+                os_ << ", " << "accept" << i_ << "_";
             }
             os_ << " };\n";
-
-            os_ << "    static std::size_t const dfa_alphabet_ = "
-                << sm_.data()._dfa_alphabet.front () << ";\n";
-            os_ << "    static std::size_t const dfa_["
-                << sm_.data()._dfa[0]->size () << "] = {\n        ";
-            count_ = sm_.data()._dfa[0]->size () / 8;
-            for (i_ = 0; i_ < count_; ++i_)
+        }
+        else
+        {
+            if (csm_.wide())
             {
-                const std::size_t index_ = i_ * 8;
-                os_ << dfa_[index_];
-                for (j_ = 1; j_ < 8; ++j_)
-                {
-                    os_ << ", " << dfa_[index_ + j_];
-                }
-                if (i_ < count_ - 1)
-                {
-                    os_ << ",\n        ";
-                }
+                generate_compact_tables<boost::uint32_t>(os_, index_type_
+                  , csm_[0], L<Char>());
             }
-
-            const std::size_t mod_ = sm_.data()._dfa[0]->size () % 8;
-            if (mod_)
+            else
             {
-                const std::size_t index_ = count_ * 8;
-                if (count_)
-                {
-                    os_ << ",\n        ";
-                }
-                os_ << dfa_[index_];
-                for (j_ = 1; j_ < mod_; ++j_)
-                {
-                    os_ << ", " << dfa_[index_ + j_];
-                }
+                generate_compact_tables<boost::uint16_t>(os_, index_type_
+                  , csm_[0], L<Char>());
             }
-            os_ << " };\n";
+            os_ << "    static std::size_t const dfa_alphabet_ = "
+                << csm_[0].width() << ";\n";
         }
 
         os_ << "\n    if (start_token_ == end_)\n";
@@ -353,7 +374,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         os_ << "        unique_id_ = npos;\n";
         os_ << "        return 0;\n";
         os_ << "    }\n\n";
-        if (sm_.data()._seen_BOL_assertion)
+        if (bol_)
         {
             os_ << "    bool bol = bol_;\n\n";
         }
@@ -361,21 +382,24 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         if (dfas_ > 1)
         {
             os_ << "again:\n";
-            os_ << "    std::size_t const* lookup_ = lookup_arr_[start_state_];\n";
+            os_ << "    " << index_type_
+                << " const* lookup_ = lookup_arr_[start_state_];\n";
             os_ << "    std::size_t dfa_alphabet_ = dfa_alphabet_arr_[start_state_];\n";
-            os_ << "    std::size_t const*dfa_ = dfa_arr_[start_state_];\n";
+            os_ << "    " << index_type_
+                << " const* dfa_ = dfa_arr_[start_state_];\n";
+            os_ << "    std::size_t const* accept_ = accept_arr_[start_state_];\n";
         }
 
-        os_ << "    std::size_t const* ptr_ = dfa_ + dfa_alphabet_;\n";
+        os_ << "    " << index_type_ << " const* ptr_ = dfa_ + dfa_alphabet_;\n";
         os_ << "    Iterator curr_ = start_token_;\n";
         os_ << "    bool end_state_ = *ptr_ != 0;\n";
-        os_ << "    std::size_t id_ = *(ptr_ + id_index);\n";
-        os_ << "    std::size_t uid_ = *(ptr_ + unique_id_index);\n";
+        os_ << "    std::size_t id_ = accept_[accept_size + id_index];\n";
+        os_ << "    std::size_t uid_ = accept_[accept_size + unique_id_index];\n";
         if (dfas_ > 1)
         {
             os_ << "    std::size_t end_start_state_ = start_state_;\n";
         }
-        if (sm_.data()._seen_BOL_assertion)
+        if (bol_)
         {
             os_ << "    bool end_bol_ = bol_;\n";
         }
@@ -383,132 +407,76 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 
         os_ << "    while (curr_ != end_)\n";
         os_ << "    {\n";
+        os_ << "        std::size_t state_ = 0;\n\n";
 
-        if (sm_.data()._seen_BOL_assertion)
+        if (bol_)
         {
-            os_ << "        std::size_t const BOL_state_ = ptr_[bol_index];\n\n";
+            os_ << "        std::size_t const BOL_state_ = ptr_[bol_index];\n";
         }
-
-        if (sm_.data()._seen_EOL_assertion)
+        if (eol_)
         {
-            os_ << "        std::size_t const EOL_state_ = ptr_[eol_index];\n\n";
+            os_ << "        std::size_t const EOL_state_ = ptr_[eol_index];\n";
         }
-
-        if (sm_.data()._seen_BOL_assertion && sm_.data()._seen_EOL_assertion)
+        if (bol_ || eol_)
         {
-            os_ << "        if (BOL_state_ && bol)\n";
-            os_ << "        {\n";
-            os_ << "            ptr_ = &dfa_[BOL_state_ * dfa_alphabet_];\n";
-            os_ << "        }\n";
-            os_ << "        else if (EOL_state_ && *curr_ == '\\n')\n";
-            os_ << "        {\n";
-            os_ << "            ptr_ = &dfa_[EOL_state_ * dfa_alphabet_];\n";
-            os_ << "        }\n";
-            os_ << "        else\n";
-            os_ << "        {\n";
-            if (lookups_ == 256)
-            {
-                os_ << "            unsigned char index = \n";
-                os_ << "                static_cast<unsigned char>(*curr_++);\n";
-            }
-            else
-            {
-                os_ << "            std::size_t index = *curr_++\n";
-            }
-            os_ << "            bol = (index == '\\n') ? true : false;\n";
-            os_ << "            std::size_t const state_ = ptr_[\n";
-            os_ << "                lookup_[static_cast<std::size_t>(index)]];\n";
-
-            os_ << '\n';
-            os_ << "            if (state_ == 0) break;\n";
             os_ << '\n';
-            os_ << "            ptr_ = &dfa_[state_ * dfa_alphabet_];\n";
-            os_ << "        }\n\n";
         }
-        else if (sm_.data()._seen_BOL_assertion)
+
+        char const* indent_ = "        ";
+        if (bol_)
         {
             os_ << "        if (BOL_state_ && bol)\n";
             os_ << "        {\n";
-            os_ << "            ptr_ = &dfa_[BOL_state_ * dfa_alphabet_];\n";
+            os_ << "            state_ = BOL_state_;\n";
             os_ << "        }\n";
-            os_ << "        else\n";
-            os_ << "        {\n";
-            if (lookups_ == 256)
-            {
-                os_ << "            unsigned char index = \n";
-                os_ << "                static_cast<unsigned char>(*curr_++);\n";
-            }
-            else
-            {
-                os_ << "            std::size_t index = *curr_++\n";
-            }
-            os_ << "            bol = (index == '\\n') ? true : false;\n";
-            os_ << "            std::size_t const state_ = ptr_[\n";
-            os_ << "                lookup_[static_cast<std::size_t>(index)]];\n";
-
-            os_ << '\n';
-            os_ << "            if (state_ == 0) break;\n";
-            os_ << '\n';
-            os_ << "            ptr_ = &dfa_[state_ * dfa_alphabet_];\n";
-            os_ << "        }\n\n";
         }
-        else if (sm_.data()._seen_EOL_assertion)
+        if (eol_)
         {
-            os_ << "        if (EOL_state_ && *curr_ == '\\n')\n";
+            os_ << (bol_ ? "        else if" : "        if")
+                << " (EOL_state_ && *curr_ == '\\n')\n";
             os_ << "        {\n";
-            os_ << "            ptr_ = &dfa_[EOL_state_ * dfa_alphabet_];\n";
+            os_ << "            state_ = EOL_state_;\n";
             os_ << "        }\n";
+        }
+        if (bol_ || eol_)
+        {
             os_ << "        else\n";
             os_ << "        {\n";
-            if (lookups_ == 256)
-            {
-                os_ << "            unsigned char index = \n";
-                os_ << "                static_cast<unsigned char>(*curr_++);\n";
-            }
-            else
-            {
-                os_ << "            std::size_t index = *curr_++\n";
-            }
-            os_ << "            bol = (index == '\\n') ? true : false;\n";
-            os_ << "            std::size_t const state_ = ptr_[\n";
-            os_ << "                lookup_[static_cast<std::size_t>(index)]];\n";
+            indent_ = "            ";
+        }
 
-            os_ << '\n';
-            os_ << "            if (state_ == 0) break;\n";
-            os_ << '\n';
-            os_ << "            ptr_ = &dfa_[state_ * dfa_alphabet_];\n";
-            os_ << "        }\n\n";
+        if (lookups_ == 256)
+        {
+            os_ << indent_ << "unsigned char index =\n";
+            os_ << indent_ << "    static_cast<unsigned char>(*curr_++);\n";
         }
         else
         {
-            os_ << "        std::size_t const state_ =\n";
-
-            if (lookups_ == 256)
-            {
-                os_ << "            ptr_[lookup_["
-                       "static_cast<unsigned char>(*curr_++)]];\n";
-            }
-            else
-            {
-                os_ << "            ptr_[lookup_[*curr_++]];\n";
-            }
-
-            os_ << '\n';
-            os_ << "        if (state_ == 0) break;\n";
-            os_ << '\n';
-            os_ << "        ptr_ = &dfa_[state_ * dfa_alphabet_];\n\n";
+            os_ << indent_ << "std::size_t index = *curr_++;\n";
+        }
+        if (bol_)
+        {
+            os_ << indent_ << "bol = (index == '\\n') ? true : false;\n";
+        }
+        os_ << indent_ << "state_ = ptr_[lookup_[static_cast<std::size_t>(index)]];\n\n";
+        os_ << indent_ << "if (state_ == 0) break;\n";
+        if (bol_ || eol_)
+        {
+            os_ << "        }\n";
         }
 
+        os_ << "\n        ptr_ = &dfa_[state_ * dfa_alphabet_];\n\n";
         os_ << "        if (*ptr_)\n";
         os_ << "        {\n";
+        os_ << "            std::size_t const* acc_ = &accept_[state_ * accept_size];\n\n";
         os_ << "            end_state_ = true;\n";
-        os_ << "            id_ = *(ptr_ + id_index);\n";
-        os_ << "            uid_ = *(ptr_ + unique_id_index);\n";
+        os_ << "            id_ = acc_[id_index];\n";
+        os_ << "            uid_ = acc_[unique_id_index];\n";
         if (dfas_ > 1)
         {
-            os_ << "            end_start_state_ = *(ptr_ + state_index);\n";
+            os_ << "            end_start_state_ = acc_[state_index];\n";
         }
-        if (sm_.data()._seen_BOL_assertion)
+        if (bol_)
         {
             os_ << "            end_bol_ = bol;\n";
         }
@@ -516,7 +484,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         os_ << "        }\n";
         os_ << "    }\n\n";
 
-        if (sm_.data()._seen_EOL_assertion)
+        if (eol_)
         {
             os_ << "    std::size_t const EOL_state_ = ptr_[eol_index];\n\n";
 
@@ -526,14 +494,16 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 
             os_ << "        if (*ptr_)\n";
             os_ << "        {\n";
+            os_ << "            std::size_t const* acc_ = "
+                   "&accept_[EOL_state_ * accept_size];\n\n";
             os_ << "            end_state_ = true;\n";
-            os_ << "            id_ = *(ptr_ + id_index);\n";
-            os_ << "            uid_ = *(ptr_ + unique_id_index);\n";
+            os_ << "            id_ = acc_[id_index];\n";
+            os_ << "            uid_ = acc_[unique_id_index];\n";
             if (dfas_ > 1)
             {
-                os_ << "            end_start_state_ = *(ptr_ + state_index);\n";
+                os_ << "            end_start_state_ = acc_[state_index];\n";
             }
-            if (sm_.data()._seen_BOL_assertion)
+            if (bol_)
             {
                 os_ << "            end_bol_ = bol;\n";
             }
@@ -552,13 +522,13 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             os_ << "        start_state_ = end_start_state_;\n";
             os_ << "        if (id_ == 0)\n";
             os_ << "        {\n";
-            if (sm_.data()._seen_BOL_assertion)
+            if (bol_)
             {
                 os_ << "            bol = end_bol_;\n";
             }
             os_ << "            goto again;\n";
             os_ << "        }\n";
-            if (sm_.data()._seen_BOL_assertion)
+            if (bol_)
             {
                 os_ << "        else\n";
                 os_ << "        {\n";
@@ -566,7 +536,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                 os_ << "        }\n";
             }
         }
-        else if (sm_.data()._seen_BOL_assertion)
+        else if (bol_)
         {
             os_ << "        bol_ = end_bol_;\n";
         }
@@ -575,7 +545,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         os_ << "    else\n";
         os_ << "    {\n";
 
-        if (sm_.data()._seen_BOL_assertion)
+        if (bol_)
         {
             os_ << "        bol_ = (*start_token_ == '\\n') ? true : false;\n";
         }
@@ -872,6 +842,566 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         return os_.good();
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  The states of a DFA of a char based state machine as seen by the
+    //  threaded code generator: next holds the target state for every input
+    //  character (npos if there is none).
+    struct threaded_state
+    {
+        threaded_state()
+          : end_state(false), id(0), unique_id(boost::lexer::npos)
+          , goto_dfa(0), bol_index(boost::lexer::npos)
+          , eol_index(boost::lexer::npos), next(256, boost::lexer::npos)
+        {}
+
+        bool has_transitions() const
+        {
+            for (std::size_t c_ = 0; c_ < next.size(); ++c_)
+            {
+                if (next[c_] != boost::lexer::npos)
+                    return true;
+            }
+            return false;
+        }
+
+        bool end_state;
+        std::size_t id;
+        std::size_t unique_id;
+        std::size_t goto_dfa;
+        std::size_t bol_index;
+        std::size_t eol_index;
+        std::vector<std::size_t> next;
+    };
+
+    typedef std::vector<threaded_state> threaded_dfa;
+
+    template <typename Char>
+    void get_threaded_dfas(boost::lexer::basic_state_machine<Char> const& sm_
+      , std::vector<threaded_dfa>& dfas_)
+    {
+        typedef typename boost::lexer::basic_state_machine<Char>::iterator
+            iterator_type;
+
+        iterator_type iter_ = sm_.begin();
+        dfas_.resize(sm_.data()._dfa->size());
+
+        for (std::size_t dfa_ = 0; dfa_ < dfas_.size(); ++dfa_)
+        {
+            std::size_t const states_ = iter_->states;
+            dfas_[dfa_].resize(states_);
+
+            for (std::size_t state_ = 0; state_ < states_; ++state_)
+            {
+                threaded_state& s_ = dfas_[dfa_][state_];
+                std::size_t const transitions_ = iter_->transitions;
+
+                s_.end_state = iter_->end_state;
+                s_.id = iter_->id;
+                s_.unique_id = iter_->unique_id;
+                s_.goto_dfa = iter_->goto_dfa;
+                s_.bol_index = iter_->bol_index;
+                s_.eol_index = iter_->eol_index;
+
+                for (std::size_t t_ = 0; t_ < transitions_; ++t_)
+                {
+                    std::vector<bool> chars_(256, iter_->token._negated);
+                    std::basic_string<Char> const& charset_ =
+                        iter_->token._charset;
+
+                    for (std::size_t i_ = 0; i_ < charset_.size(); ++i_)
+                    {
+                        chars_[static_cast<unsigned char>(charset_[i_])] =
+                            !iter_->token._negated;
+                    }
+                    for (std::size_t c_ = 0; c_ < 256; ++c_)
+                    {
+                        if (chars_[c_])
+                            s_.next[c_] = iter_->goto_state;
+                    }
+                    ++iter_;
+                }
+                if (transitions_ == 0) ++iter_;
+            }
+        }
+    }
+
+    // run the DFAs over the given input the way the generated tokenizer does,
+    // counting the visits of every state (BOL and EOL assertions are ignored)
+    template <typename Iterator>
+    void record_state_profile(std::vector<threaded_dfa> const& dfas_
+      , Iterator first_, Iterator const& last_, state_profile& profile_)
+    {
+        std::size_t dfa_ = 0;
+        while (first_ != last_)
+        {
+            threaded_dfa const& states_ = dfas_[dfa_];
+            std::size_t state_ = 0;
+            Iterator curr_ = first_;
+            Iterator end_token_ = first_;
+            std::size_t end_dfa_ = dfa_;
+            bool loop_ = false;
+
+            for (;;)
+            {
+                profile_.visit(dfa_, state_, loop_);
+
+                threaded_state const& s_ = states_[state_];
+                if (s_.end_state)
+                {
+                    end_token_ = curr_;
+                    end_dfa_ = s_.goto_dfa;
+                }
+
+                if (curr_ == last_)
+                    break;
+
+                std::size_t const next_ =
+                    s_.next[static_cast<unsigned char>(*curr_)];
+                if (next_ == boost::lexer::npos)
+                    break;
+
+                loop_ = next_ == state_;
+                state_ = next_;
+                ++curr_;
+            }
+
+            if (end_token_ != first_)
+            {
+                first_ = end_token_;
+                dfa_ = end_dfa_;
+            }
+            else
+            {
+                ++first_;       // skip the unmatched character
+            }
+        }
+    }
+
+    // orders the states of a DFA by descending number of visits
+    struct hotter_state
+    {
+        hotter_state(state_profile const& profile, std::size_t dfa)
+          : profile_(profile), dfa_(dfa)
+        {}
+
+        bool operator()(std::size_t lhs, std::size_t rhs) const
+        {
+            return profile_.visits(dfa_, lhs) > profile_.visits(dfa_, rhs);
+        }
+
+        state_profile const& profile_;
+        std::size_t dfa_;
+    };
+
+    // scanning pays off only if the state loops for a couple of characters
+    // every time it is entered, as known from the profile
+    inline bool worth_scanning(state_profile const* profile_, std::size_t dfa_
+      , std::size_t state_)
+    {
+        if (!profile_)
+            return true;
+
+        std::size_t const loops_ = profile_->loops(dfa_, state_);
+        std::size_t const entries_ = profile_->visits(dfa_, state_) - loops_;
+        return loops_ >= 8 * entries_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Generate a direct threaded tokenizer: every state is a label and the
+    //  next state is found by indexing a per state table of label addresses
+    //  with the character class of the current character (computed goto),
+    //  or by a switch over the character class where computed goto is not
+    //  available. The states are laid out in the order of the given profile,
+    //  hottest first, and states looping back to themselves for all but a
+    //  few characters skip over the input using scan() (if the profile shows
+    //  they loop long enough).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char>
+    bool generate_function_body_threaded(std::basic_ostream<Char>& os_
+      , boost::lexer::basic_state_machine<Char> const& sm_
+      , state_profile const* profile_)
+    {
+        // the threaded tokenizer works on char input only
+        if (sm_.data()._lookup->front()->size() != 256)
+            return generate_function_body_switch(os_, sm_);
+
+        std::vector<threaded_dfa> dfas_;
+        get_threaded_dfas(sm_, dfas_);
+
+        std::size_t const count_ = dfas_.size();
+        bool const seen_bol_ = sm_.data()._seen_BOL_assertion;
+
+        // the character classes of every DFA: characters leading to the same
+        // targets in all states of the DFA share their class
+        std::vector<std::vector<std::size_t> > lookup_(count_);
+        std::vector<std::vector<std::size_t> > classes_(count_);
+
+        for (std::size_t dfa_ = 0; dfa_ < count_; ++dfa_)
+        {
+            threaded_dfa const& states_ = dfas_[dfa_];
+            std::map<std::vector<std::size_t>, std::size_t> columns_;
+
+            lookup_[dfa_].resize(256);
+            for (std::size_t c_ = 0; c_ < 256; ++c_)
+            {
+                std::vector<std::size_t> column_(states_.size());
+                for (std::size_t state_ = 0; state_ < states_.size(); ++state_)
+                    column_[state_] = states_[state_].next[c_];
+
+                std::pair<std::map<std::vector<std::size_t>, std::size_t>::
+                    iterator, bool> const r_ = columns_.insert(
+                        std::make_pair(column_, classes_[dfa_].size()));
+                if (r_.second)
+                    classes_[dfa_].push_back(c_);   // the class representative
+                lookup_[dfa_][c_] = r_.first->second;
+            }
+        }
+
+        // the layout of the states, hottest first
+        std::vector<std::vector<std::size_t> > order_(count_);
+        for (std::size_t dfa_ = 0; dfa_ < count_; ++dfa_)
+        {
+            for (std::size_t state_ = 0; state_ < dfas_[dfa_].size(); ++state_)
+                order_[dfa_].push_back(state_);
+
+            if (profile_)
+            {
+                std::stable_sort(order_[dfa_].begin(), order_[dfa_].end()
+                  , hotter_state(*profile_, dfa_));
+            }
+        }
+
+        // only referenced states get a label
+        std::vector<std::vector<bool> > referenced_(count_);
+        for (std::size_t dfa_ = 0; dfa_ < count_; ++dfa_)
+        {
+            threaded_dfa const& states_ = dfas_[dfa_];
+            referenced_[dfa_].resize(states_.size(), false);
+            referenced_[dfa_][0] = count_ > 1 || order_[dfa_][0] != 0;
+
+            for (std::size_t state_ = 0; state_ < states_.size(); ++state_)
+            {
+                threaded_state const& s_ = states_[state_];
+                if (s_.bol_index != boost::lexer::npos)
+                    referenced_[dfa_][s_.bol_index] = true;
+                if (s_.eol_index != boost::lexer::npos)
+                    referenced_[dfa_][s_.eol_index] = true;
+                for (std::size_t c_ = 0; c_ < 256; ++c_)
+                {
+                    if (s_.next[c_] != boost::lexer::npos)
+                        referenced_[dfa_][s_.next[c_]] = true;
+                }
+            }
+        }
+
+        os_ << "    static std::size_t const npos = "
+               "static_cast<std::size_t>(~0);\n";
+
+        for (std::size_t dfa_ = 0; dfa_ < count_; ++dfa_)
+        {
+            os_ << "    static unsigned char const lookup" << dfa_
+                << "_[256] = {";
+            for (std::size_t c_ = 0; c_ < 256; ++c_)
+            {
+                os_ << ((c_ % 16) ? " " : "\n        ") << lookup_[dfa_][c_]
+                    << ((c_ != 255) ? "," : "");
+            }
+            os_ << " };\n";
+        }
+
+        os_ << "\n#if defined(BOOST_SPIRIT_LEXERTL_COMPUTED_GOTO)\n";
+        for (std::size_t dfa_ = 0; dfa_ < count_; ++dfa_)
+        {
+            threaded_dfa const& states_ = dfas_[dfa_];
+            for (std::size_t i_ = 0; i_ < states_.size(); ++i_)
+            {
+                std::size_t const state_ = order_[dfa_][i_];
+                if (!states_[state_].has_transitions())
+                    continue;
+
+                os_ << "    static void* const state" << dfa_ << '_' << state_
+                    << "_[" << classes_[dfa_].size() << "] = {";
+                for (std::size_t k_ = 0; k_ < classes_[dfa_].size(); ++k_)
+                {
+                    std::size_t const next_ =
+                        states_[state_].next[classes_[dfa_][k_]];
+
+                    os_ << ((k_ % 4) ? " " : "\n        ");
+                    if (next_ == boost::lexer::npos)
+                        os_ << "&&end";
+                    else
+                        os_ << "&&state" << dfa_ << '_' << next_;
+                    if (k_ + 1 != classes_[dfa_].size())
+                        os_ << ',';
+                }
+                os_ << " };\n";
+            }
+        }
+        os_ << "#endif\n";
+
+        os_ << "\n    if (start_token_ == end_)\n";
+        os_ << "    {\n";
+        os_ << "        unique_id_ = npos;\n";
+        os_ << "        return 0;\n";
+        os_ << "    }\n\n";
+
+        if (seen_bol_)
+        {
+            os_ << "    bool bol = bol_;\n";
+        }
+
+        if (count_ > 1)
+        {
+            os_ << "again:\n";
+        }
+
+        os_ << "    Iterator curr_ = start_token_;\n";
+        os_ << "    bool end_state_ = false;\n";
+        os_ << "    std::size_t id_ = npos;\n";
+        os_ << "    std::size_t uid_ = npos;\n";
+
+        if (count_ > 1)
+        {
+            os_ << "    std::size_t end_start_state_ = start_state_;\n";
+        }
+
+        if (seen_bol_)
+        {
+            os_ << "    bool end_bol_ = bol_;\n";
+        }
+
+        os_ << "    Iterator end_token_ = start_token_;\n";
+        os_ << '\n';
+        os_ << "    char ch_ = 0;\n\n";
+
+        if (count_ > 1)
+        {
+            os_ << "    switch (start_state_)\n";
+            os_ << "    {\n";
+
+            for (std::size_t i_ = 0; i_ < count_; ++i_)
+            {
+                os_ << "    case " << i_ << ":\n";
+                os_ << "        goto state" << i_ << "_0;\n";
+                os_ << "        break;\n";
+            }
+
+            os_ << "    default:\n";
+            os_ << "        goto end;\n";
+            os_ << "        break;\n";
+            os_ << "    }\n";
+        }
+        else if (order_[0][0] != 0)
+        {
+            os_ << "    goto state0_0;\n";
+        }
+
+        for (std::size_t dfa_ = 0; dfa_ < count_; ++dfa_)
+        {
+            threaded_dfa const& states_ = dfas_[dfa_];
+            for (std::size_t i_ = 0; i_ < states_.size(); ++i_)
+            {
+                std::size_t const state_ = order_[dfa_][i_];
+                threaded_state const& s_ = states_[state_];
+                bool const transitions_ = s_.has_transitions();
+
+                if (referenced_[dfa_][state_])
+                {
+                    os_ << "\nstate" << dfa_ << '_' << state_ << ":\n";
+                }
+
+                if (s_.end_state)
+                {
+                    os_ << "    end_state_ = true;\n";
+                    os_ << "    id_ = " << s_.id << ";\n";
+                    os_ << "    uid_ = " << s_.unique_id << ";\n";
+                    os_ << "    end_token_ = curr_;\n";
+
+                    if (count_ > 1)
+                    {
+                        os_ << "    end_start_state_ = " << s_.goto_dfa
+                            << ";\n";
+                    }
+
+                    if (seen_bol_)
+                    {
+                        os_ << "    end_bol_ = bol;\n";
+                    }
+                }
+
+                // skip over the characters looping back to this state
+                std::vector<std::size_t> stops_;
+                for (std::size_t c_ = 0; c_ < 256 && stops_.size() <= 4; ++c_)
+                {
+                    if (s_.next[c_] != state_)
+                        stops_.push_back(c_);
+                }
+
+                if (stops_.size() <= 4 &&
+                    s_.bol_index == boost::lexer::npos &&
+                    s_.eol_index == boost::lexer::npos &&
+                    worth_scanning(profile_, dfa_, state_))
+                {
+                    os_ << "    curr_ = scan(curr_, end_";
+                    for (std::size_t j_ = 0; j_ < stops_.size(); ++j_)
+                    {
+                        os_ << ", '" << get_charlit(static_cast<Char>(
+                            static_cast<unsigned char>(stops_[j_]))) << "'";
+                    }
+                    os_ << ");\n";
+
+                    if (s_.end_state)
+                    {
+                        os_ << "    end_token_ = curr_;\n";
+                    }
+                }
+
+                if (!transitions_ &&
+                    s_.bol_index == boost::lexer::npos &&
+                    s_.eol_index == boost::lexer::npos)
+                {
+                    os_ << "    goto end;\n";
+                    continue;
+                }
+
+                os_ << "    if (curr_ == end_) goto end;\n";
+                os_ << "    ch_ = *curr_;\n";
+                if (s_.bol_index != boost::lexer::npos)
+                {
+                    os_ << "    if (bol) goto state" << dfa_ << '_'
+                        << s_.bol_index << ";\n";
+                }
+                if (s_.eol_index != boost::lexer::npos)
+                {
+                    os_ << "    if (ch_ == '\\n') goto state" << dfa_
+                        << '_' << s_.eol_index << ";\n";
+                }
+                os_ << "    ++curr_;\n";
+
+                if (!transitions_)
+                {
+                    os_ << "    goto end;\n";
+                    continue;
+                }
+
+                os_ << "#if defined(BOOST_SPIRIT_LEXERTL_COMPUTED_GOTO)\n";
+                os_ << "    goto *state" << dfa_ << '_' << state_ << "_[lookup"
+                    << dfa_ << "_[static_cast<unsigned char>(ch_)]];\n";
+                os_ << "#else\n";
+                os_ << "    switch (lookup" << dfa_
+                    << "_[static_cast<unsigned char>(ch_)])\n";
+                os_ << "    {\n";
+
+                // the classes leading to the same state share their case
+                std::map<std::size_t, std::vector<std::size_t> > targets_;
+                for (std::size_t k_ = 0; k_ < classes_[dfa_].size(); ++k_)
+                {
+                    std::size_t const next_ = s_.next[classes_[dfa_][k_]];
+                    if (next_ != boost::lexer::npos)
+                        targets_[next_].push_back(k_);
+                }
+
+                std::map<std::size_t, std::vector<std::size_t> >::
+                    const_iterator last_ = targets_.end();
+                for (std::map<std::size_t, std::vector<std::size_t> >::
+                        const_iterator it_ = targets_.begin();
+                     it_ != last_; ++it_)
+                {
+                    for (std::size_t j_ = 0; j_ < it_->second.size(); ++j_)
+                    {
+                        os_ << "    case " << it_->second[j_] << ":\n";
+                    }
+                    os_ << "        goto state" << dfa_ << '_' << it_->first
+                        << ";\n";
+                }
+
+                os_ << "    default:\n";
+                os_ << "        goto end;\n";
+                os_ << "    }\n";
+                os_ << "#endif\n";
+            }
+        }
+
+        os_ << "\nend:\n";
+        os_ << "    if (end_state_)\n";
+        os_ << "    {\n";
+        os_ << "        // return longest match\n";
+        os_ << "        start_token_ = end_token_;\n";
+
+        if (count_ > 1)
+        {
+            os_ << "        start_state_ = end_start_state_;\n";
+            os_ << "\n        if (id_ == 0)\n";
+            os_ << "        {\n";
+
+            if (seen_bol_)
+            {
+                os_ << "            bol = end_bol_;\n";
+            }
+
+            os_ << "            goto again;\n";
+            os_ << "        }\n";
+
+            if (seen_bol_)
+            {
+                os_ << "        else\n";
+                os_ << "        {\n";
+                os_ << "            bol_ = end_bol_;\n";
+                os_ << "        }\n";
+            }
+        }
+        else if (seen_bol_)
+        {
+            os_ << "        bol_ = end_bol_;\n";
+        }
+
+        os_ << "    }\n";
+        os_ << "    else\n";
+        os_ << "    {\n";
+
+        if (seen_bol_)
+        {
+            os_ << "        bol_ = (*start_token_ == '\\n') ? true : false;\n";
+        }
+        os_ << "        id_ = npos;\n";
+        os_ << "        uid_ = npos;\n";
+        os_ << "    }\n\n";
+
+        os_ << "    unique_id_ = uid_;\n";
+        os_ << "    return id_;\n";
+        return os_.good();
+    }
+
+    // binds the profile to generate_function_body_threaded
+    template <typename Char>
+    struct threaded_function_body
+    {
+        explicit threaded_function_body(state_profile const* profile)
+          : profile_(profile)
+        {}
+
+        bool operator()(std::basic_ostream<Char>& os_
+          , boost::lexer::basic_state_machine<Char> const& sm_) const
+        {
+            return generate_function_body_threaded(os_, sm_, profile_);
+        }
+
+        state_profile const* profile_;
+    };
+
+    // the includes needed by the generated tokenizer
+    template <typename Char, typename F>
+    inline void generate_cpp_includes(std::basic_ostream<Char>&, F const&)
+    {
+    }
+
+    template <typename Char>
+    inline void generate_cpp_includes(std::basic_ostream<Char>& os_
+      , threaded_function_body<Char> const&)
+    {
+        os_ << "#include <boost/spirit/home/lex/lexer/lexertl/static_threaded.hpp>\n";
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Generate a tokenizer for the given state machine.
     template <typename Char, typename F>
@@ -911,8 +1441,11 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         os_ << "#if !defined(BOOST_SPIRIT_LEXER_NEXT_TOKEN_" << guard << ")\n";
         os_ << "#define BOOST_SPIRIT_LEXER_NEXT_TOKEN_" << guard << "\n\n";
 
+        os_ << "#include <boost/cstdint.hpp>\n";
         os_ << "#include <boost/detail/iterator.hpp>\n";
-        os_ << "#include <boost/spirit/home/support/detail/lexer/char_traits.hpp>\n\n";
+        os_ << "#include <boost/spirit/home/support/detail/lexer/char_traits.hpp>\n";
+        generate_cpp_includes(os_, generate_function_body);
+        os_ << '\n';
 
         generate_delimiter(os_);
         os_ << "// the generated table of state names and the tokenizer have to be\n"
@@ -979,6 +1512,8 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
     {
         if (!lexer.init_dfa(true))    // always minimize DFA for static lexers
             return false;
+        if (lexer.state_machine_.empty())   // loaded by read_state_machine
+            return false;
         return detail::generate_cpp(lexer.state_machine_, lexer.rules_, os
           , name_suffix, f);
     }
@@ -1021,6 +1556,49 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
           , &detail::generate_function_body_switch<typename Lexer::char_type>);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  Record the state visits of the (minimized) DFAs of the given lexer
+    //  while tokenizing the given sample input. Returns false for lexers
+    //  not using char input or not having a state machine.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lexer, typename Iterator>
+    inline bool
+    record_state_profile(Lexer const& lexer, Iterator first
+      , Iterator const& last, state_profile& profile)
+    {
+        if (!lexer.init_dfa(true))    // the DFA as used by generate_static
+            return false;
+        if (lexer.state_machine_.empty() ||
+            lexer.state_machine_.data()._lookup->front()->size() != 256)
+        {
+            return false;
+        }
+
+        std::vector<detail::threaded_dfa> dfas;
+        detail::get_threaded_dfas(lexer.state_machine_, dfas);
+        detail::record_state_profile(dfas, first, last, profile);
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Generate a direct threaded tokenizer (see
+    //  detail::generate_function_body_threaded). The generated code includes
+    //  static_threaded.hpp. If a profile is given, the states are laid out
+    //  in the order of their recorded visits.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lexer>
+    inline bool
+    generate_static_threaded(Lexer const& lexer
+      , std::basic_ostream<typename Lexer::char_type>& os
+      , typename Lexer::char_type const* name_suffix =
+          detail::L<typename Lexer::char_type>()
+      , state_profile const* profile = 0)
+    {
+        return generate_static(lexer, os, name_suffix
+          , detail::threaded_function_body<typename Lexer::char_type>(
+              profile));
+    }
+
 ///////////////////////////////////////////////////////////////////////////////
 }}}}
 
@@ -19,12 +19,14 @@
 #include <boost/spirit/home/support/iterators/detail/split_functor_input_policy.hpp>
 #include <boost/spirit/home/support/iterators/detail/ref_counted_policy.hpp>
 #include <boost/spirit/home/support/iterators/detail/split_std_deque_policy.hpp>
+#include <boost/spirit/home/support/iterators/detail/split_ring_buffer_policy.hpp>
 #include <boost/spirit/home/support/iterators/multi_pass.hpp>
 
 namespace boost { namespace spirit { namespace lex { namespace lexertl
 { 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename FunctorData>
+    template <typename FunctorData
+      , typename StoragePolicy = iterator_policies::split_std_deque>
     struct make_multi_pass
     {
         // Divide the given functor type into its components (unique and 
@@ -44,7 +46,7 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 #else
         typedef iterator_policies::no_check check_policy;
 #endif
-        typedef iterator_policies::split_std_deque storage_policy;
+        typedef StoragePolicy storage_policy;
 
         typedef iterator_policies::default_policy<
                 ownership_policy, check_policy, input_policy, storage_policy>
@@ -57,10 +59,14 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
     ///////////////////////////////////////////////////////////////////////////
     //  lexer_iterator exposes an iterator for a lexertl based dfa (lexer) 
     //  The template parameters have the same semantics as described for the
-    //  functor above.
+    //  functor above. The StoragePolicy is the one used for the tokens
+    //  buffered by the multi_pass iterator, split_std_deque stores all the
+    //  tokens needed for backtracking, split_ring_buffer<N> stores only the
+    //  last N tokens.
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Functor>
-    class iterator : public make_multi_pass<Functor>::type
+    template <typename Functor
+      , typename StoragePolicy = iterator_policies::split_std_deque>
+    class iterator : public make_multi_pass<Functor, StoragePolicy>::type
     {
     public:
         typedef typename Functor::unique unique_functor_type;
@@ -70,9 +76,9 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         typedef typename Functor::result_type token_type;
 
     private:
-        typedef typename make_multi_pass<Functor>::functor_data_type 
+        typedef typename make_multi_pass<Functor, StoragePolicy>::functor_data_type 
             functor_type;
-        typedef typename make_multi_pass<Functor>::type base_type;
+        typedef typename make_multi_pass<Functor, StoragePolicy>::type base_type;
         typedef typename Functor::char_type char_type;
 
     public:
@@ -120,25 +126,25 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 
 namespace traits 
 { 
-    template <typename Functor>
-    struct is_multi_pass<spirit::lex::lexertl::iterator<Functor> >
+    template <typename Functor, typename StoragePolicy>
+    struct is_multi_pass<spirit::lex::lexertl::iterator<Functor, StoragePolicy> >
       : mpl::true_ {};
 
-    template <typename Functor>
-    void clear_queue(spirit::lex::lexertl::iterator<Functor> & mp
+    template <typename Functor, typename StoragePolicy>
+    void clear_queue(spirit::lex::lexertl::iterator<Functor, StoragePolicy> & mp
         , BOOST_SCOPED_ENUM(traits::clear_mode) mode)
     {
         mp.clear_queue(mode);
     }
 
-    template <typename Functor>
-    void inhibit_clear_queue(spirit::lex::lexertl::iterator<Functor>& mp, bool flag)
+    template <typename Functor, typename StoragePolicy>
+    void inhibit_clear_queue(spirit::lex::lexertl::iterator<Functor, StoragePolicy>& mp, bool flag)
     {
         mp.inhibit_clear_queue(flag);
     }
 
-    template <typename Functor> 
-    bool inhibit_clear_queue(spirit::lex::lexertl::iterator<Functor>& mp)
+    template <typename Functor, typename StoragePolicy> 
+    bool inhibit_clear_queue(spirit::lex::lexertl::iterator<Functor, StoragePolicy>& mp)
     {
         return mp.inhibit_clear_queue();
     }
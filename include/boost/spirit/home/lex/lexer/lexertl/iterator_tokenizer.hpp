@@ -12,9 +12,13 @@
 
 #include <boost/detail/iterator.hpp>
 #include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+#include <boost/spirit/home/support/detail/lexer/lazy_state_machine.hpp>
 #include <boost/spirit/home/support/detail/lexer/consts.hpp>
 #include <boost/spirit/home/support/detail/lexer/size_t.hpp>
 #include <boost/spirit/home/support/detail/lexer/char_traits.hpp>
+#include <boost/spirit/home/support/detail/lexer/literals.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/compact_state_machine.hpp>
+#include <boost/cstdint.hpp>
 #include <vector>
 
 namespace boost { namespace spirit { namespace lex { namespace lexertl
@@ -248,6 +252,304 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             unique_id_ = uid_;
             return id_;
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  The same as above, matching against the compact tables (see
+        //  compact_state_machine.hpp).
+        static std::size_t next (
+            basic_compact_state_machine<char_type> const& state_machine_
+          , std::size_t &dfa_state_, bool& bol_, Iterator &start_token_
+          , Iterator const& end_, std::size_t& unique_id_)
+        {
+            if (state_machine_.wide())
+            {
+                return next_compact<boost::uint32_t>(state_machine_, dfa_state_
+                  , true, bol_, start_token_, end_, unique_id_);
+            }
+            return next_compact<boost::uint16_t>(state_machine_, dfa_state_
+              , true, bol_, start_token_, end_, unique_id_);
+        }
+
+        static std::size_t next (
+            basic_compact_state_machine<char_type> const& state_machine_
+          , bool& bol_, Iterator &start_token_, Iterator const& end_
+          , std::size_t& unique_id_)
+        {
+            std::size_t dfa_state_ = 0;
+            if (state_machine_.wide())
+            {
+                return next_compact<boost::uint32_t>(state_machine_, dfa_state_
+                  , false, bol_, start_token_, end_, unique_id_);
+            }
+            return next_compact<boost::uint16_t>(state_machine_, dfa_state_
+              , false, bol_, start_token_, end_, unique_id_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  The same as above, building the DFA states as they are reached
+        //  (see lazy_state_machine.hpp).
+        static std::size_t next (
+            boost::lexer::basic_lazy_state_machine<char_type>& state_machine_
+          , std::size_t &dfa_state_, bool& bol_, Iterator &start_token_
+          , Iterator const& end_, std::size_t& unique_id_)
+        {
+            return next_lazy(state_machine_, dfa_state_, true, bol_
+              , start_token_, end_, unique_id_);
+        }
+
+        static std::size_t next (
+            boost::lexer::basic_lazy_state_machine<char_type>& state_machine_
+          , bool& bol_, Iterator &start_token_, Iterator const& end_
+          , std::size_t& unique_id_)
+        {
+            std::size_t dfa_state_ = 0;
+            return next_lazy(state_machine_, dfa_state_, false, bol_
+              , start_token_, end_, unique_id_);
+        }
+
+    private:
+        static std::size_t next_lazy (
+            boost::lexer::basic_lazy_state_machine<char_type>& state_machine_
+          , std::size_t &dfa_state_, bool multi_state_, bool& bol_
+          , Iterator &start_token_, Iterator const& end_
+          , std::size_t& unique_id_)
+        {
+            if (start_token_ == end_)
+            {
+                unique_id_ = boost::lexer::npos;
+                return 0;
+            }
+
+            typedef typename
+                boost::lexer::char_traits<char_type>::index_type
+            index_type;
+
+            bool bol = bol_;
+
+        again:
+            std::size_t const* lookup_ = state_machine_.lookup(dfa_state_);
+            std::size_t state_ = 1;
+            std::size_t const* ptr_ = state_machine_.row(dfa_state_, state_);
+            Iterator curr_ = start_token_;
+            bool end_state_ = *ptr_ != 0;
+            std::size_t id_ = *(ptr_ + boost::lexer::id_index);
+            std::size_t uid_ = *(ptr_ + boost::lexer::unique_id_index);
+            std::size_t end_start_state_ = dfa_state_;
+            bool end_bol_ = bol_;
+            Iterator end_token_ = start_token_;
+
+            while (curr_ != end_)
+            {
+                std::size_t const BOL_state_ = ptr_[boost::lexer::bol_index];
+                std::size_t const EOL_state_ = ptr_[boost::lexer::eol_index];
+
+                if (BOL_state_ && bol)
+                {
+                    state_ = BOL_state_;
+                }
+                else if (EOL_state_ && *curr_ == '\n')
+                {
+                    state_ = EOL_state_;
+                }
+                else
+                {
+                    index_type index =
+                        boost::lexer::char_traits<char_type>::call(*curr_++);
+                    bol = (index == '\n') ? true : false;
+                    state_ = ptr_[lookup_[static_cast<std::size_t>(index)]];
+
+                    if (state_ == 0)
+                    {
+                        break;
+                    }
+                }
+
+                ptr_ = state_machine_.row(dfa_state_, state_);
+                if (*ptr_)
+                {
+                    end_state_ = true;
+                    id_ = *(ptr_ + boost::lexer::id_index);
+                    uid_ = *(ptr_ + boost::lexer::unique_id_index);
+                    end_start_state_ = *(ptr_ + boost::lexer::state_index);
+                    end_bol_ = bol;
+                    end_token_ = curr_;
+                }
+            }
+
+            std::size_t EOL_state_ = ptr_[boost::lexer::eol_index];
+
+            if (EOL_state_ && curr_ == end_)
+            {
+                ptr_ = state_machine_.row(dfa_state_, EOL_state_);
+
+                if (*ptr_)
+                {
+                    end_state_ = true;
+                    id_ = *(ptr_ + boost::lexer::id_index);
+                    uid_ = *(ptr_ + boost::lexer::unique_id_index);
+                    end_start_state_ = *(ptr_ + boost::lexer::state_index);
+                    end_bol_ = bol;
+                    end_token_ = curr_;
+                }
+            }
+
+            if (end_state_) {
+                // return longest match
+                start_token_ = end_token_;
+
+                if (multi_state_)
+                {
+                    dfa_state_ = end_start_state_;
+                    if (id_ == 0)
+                    {
+                        bol = end_bol_;
+                        goto again;
+                    }
+                }
+                bol_ = end_bol_;
+            }
+            else {
+                bol_ = (*start_token_ == '\n') ? true : false;
+                id_ = boost::lexer::npos;
+                uid_ = boost::lexer::npos;
+            }
+
+            unique_id_ = uid_;
+            return id_;
+        }
+
+        template <typename Index>
+        static std::size_t next_compact (
+            basic_compact_state_machine<char_type> const& state_machine_
+          , std::size_t &dfa_state_, bool multi_state_, bool& bol_
+          , Iterator &start_token_, Iterator const& end_
+          , std::size_t& unique_id_)
+        {
+            if (start_token_ == end_)
+            {
+                unique_id_ = boost::lexer::npos;
+                return 0;
+            }
+
+            typedef typename
+                boost::lexer::char_traits<char_type>::index_type
+            index_type;
+
+            bool bol = bol_;
+
+        again:
+            compact_dfa const& dfa = state_machine_[dfa_state_];
+            std::size_t const* accept_ = dfa.accept();
+            Index const* lookup_ = dfa.template lookup<Index>();
+            Index const* rows_ = dfa.template rows<Index>();
+            std::size_t const* literals_ = dfa.literals();
+            std::size_t const width_ = dfa.width();
+
+            Index const* ptr_ = rows_ + width_;
+            Iterator curr_ = start_token_;
+            bool end_state_ = *ptr_ != 0;
+            std::size_t id_ = accept_[compact::accept_size + compact::id_index];
+            std::size_t uid_ =
+                accept_[compact::accept_size + compact::unique_id_index];
+            std::size_t end_start_state_ = dfa_state_;
+            bool end_bol_ = bol_;
+            Iterator end_token_ = start_token_;
+            std::size_t state_ = 1;
+
+            while (curr_ != end_)
+            {
+                std::size_t const BOL_state_ = ptr_[compact::bol_index];
+                std::size_t const EOL_state_ = ptr_[compact::eol_index];
+
+                if (BOL_state_ && bol)
+                {
+                    state_ = BOL_state_;
+                }
+                else if (EOL_state_ && *curr_ == '\n')
+                {
+                    state_ = EOL_state_;
+                }
+                else if (literals_ && boost::lexer::detail::match_literal<
+                    boost::lexer::char_traits<char_type> >(
+                        literals_, state_, curr_, end_, bol))
+                {
+                    if (state_ == 0)
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    index_type index =
+                        boost::lexer::char_traits<char_type>::call(*curr_++);
+                    bol = (index == '\n') ? true : false;
+                    state_ = ptr_[lookup_[static_cast<std::size_t>(index)]];
+
+                    if (state_ == 0)
+                    {
+                        break;
+                    }
+                }
+
+                ptr_ = rows_ + state_ * width_;
+                if (*ptr_)
+                {
+                    std::size_t const* acc_ =
+                        accept_ + state_ * compact::accept_size;
+
+                    end_state_ = true;
+                    id_ = acc_[compact::id_index];
+                    uid_ = acc_[compact::unique_id_index];
+                    end_start_state_ = acc_[compact::state_index];
+                    end_bol_ = bol;
+                    end_token_ = curr_;
+                }
+            }
+
+            std::size_t const EOL_state_ = ptr_[compact::eol_index];
+
+            if (EOL_state_ && curr_ == end_)
+            {
+                ptr_ = rows_ + EOL_state_ * width_;
+
+                if (*ptr_)
+                {
+                    std::size_t const* acc_ =
+                        accept_ + EOL_state_ * compact::accept_size;
+
+                    end_state_ = true;
+                    id_ = acc_[compact::id_index];
+                    uid_ = acc_[compact::unique_id_index];
+                    end_start_state_ = acc_[compact::state_index];
+                    end_bol_ = bol;
+                    end_token_ = curr_;
+                }
+            }
+
+            if (end_state_) {
+                // return longest match
+                start_token_ = end_token_;
+
+                if (multi_state_)
+                {
+                    dfa_state_ = end_start_state_;
+                    if (id_ == 0)
+                    {
+                        bol = end_bol_;
+                        goto again;
+                    }
+                }
+                bol_ = end_bol_;
+            }
+            else {
+                bol_ = (*start_token_ == '\n') ? true : false;
+                id_ = boost::lexer::npos;
+                uid_ = boost::lexer::npos;
+            }
+
+            unique_id_ = uid_;
+            return id_;
+        }
     };
 
 }}}}
@@ -15,12 +15,16 @@
 #include <boost/spirit/home/support/detail/lexer/generator.hpp>
 #include <boost/spirit/home/support/detail/lexer/rules.hpp>
 #include <boost/spirit/home/support/detail/lexer/consts.hpp>
+#include <boost/spirit/home/support/detail/lexer/lazy_state_machine.hpp>
 #include <boost/spirit/home/support/unused.hpp>
 
+#include <boost/spirit/home/lex/lexer/lexertl/binary_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/compact_state_machine.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/token.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/functor.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/functor_data.hpp>
 #include <boost/spirit/home/lex/lexer/lexertl/iterator.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/batch_tokenizer.hpp>
 #if defined(BOOST_SPIRIT_LEXERTL_DEBUG)
 #include <boost/spirit/home/support/detail/lexer/debug.hpp>
 #endif
@@ -86,6 +90,8 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
                 retval |= boost::lexer::dot_not_newline;
             if (flags & match_flags::match_icase)
                 retval |= boost::lexer::icase;
+            if (flags & match_flags::match_utf8)
+                retval |= boost::lexer::utf8;
 
             return boost::lexer::regex_flags(retval);
         }
@@ -97,6 +103,15 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
       , std::basic_ostream<typename Lexer::char_type>&
       , typename Lexer::char_type const*, F);
 
+    template <typename Lexer>
+    bool save_binary(Lexer const&, std::ostream&);
+
+    class state_profile;
+
+    template <typename Lexer, typename Iterator>
+    bool record_state_profile(Lexer const&, Iterator, Iterator const&
+      , state_profile&);
+
     ///////////////////////////////////////////////////////////////////////////
     //
     //  Every lexer type to be used as a lexer for Spirit has to conform to
@@ -130,6 +145,9 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
     //        Functor         The type of the InputPolicy to use to instantiate
     //                        the multi_pass iterator type to be used as the
     //                        token iterator (returned from begin()/end()).
+    //        StoragePolicy   The type of the StoragePolicy to use to
+    //                        instantiate the token iterator, i.e. how the
+    //                        tokens needed for backtracking are buffered.
     //
     ///////////////////////////////////////////////////////////////////////////
 
@@ -145,7 +163,8 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
     ///////////////////////////////////////////////////////////////////////////
     template <typename Token = token<>
       , typename Iterator = typename Token::iterator_type
-      , typename Functor = functor<Token, lexertl::detail::data, Iterator> >
+      , typename Functor = functor<Token, lexertl::detail::data, Iterator>
+      , typename StoragePolicy = iterator_policies::split_std_deque>
     class lexer
     {
     private:
@@ -168,7 +187,8 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         //  a public interface .
         typedef Token token_type;
         typedef typename Token::id_type id_type;
-        typedef iterator<Functor> iterator_type;
+        typedef iterator<Functor, StoragePolicy> iterator_type;
+        typedef batch_tokenizer<Functor> batch_tokenizer_type;
 
     private:
         // this type is purely used for the iterator_type construction below
@@ -177,13 +197,16 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             typedef typename Functor::semantic_actions_type semantic_actions_type;
 
             iterator_data_type(
-                    boost::lexer::basic_state_machine<char_type> const& sm
+                    basic_compact_state_machine<char_type> const& sm
+                  , boost::lexer::basic_lazy_state_machine<char_type>* lazy_sm
                   , boost::lexer::basic_rules<char_type> const& rules
                   , semantic_actions_type const& actions)
-              : state_machine_(sm), rules_(rules), actions_(actions)
+              : state_machine_(sm), lazy_state_machine_(lazy_sm)
+              , rules_(rules), actions_(actions)
             {}
 
-            boost::lexer::basic_state_machine<char_type> const& state_machine_;
+            basic_compact_state_machine<char_type> const& state_machine_;
+            boost::lexer::basic_lazy_state_machine<char_type>* lazy_state_machine_;
             boost::lexer::basic_rules<char_type> const& rules_;
             semantic_actions_type const& actions_;
 
@@ -201,7 +224,9 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             if (!init_dfa())    // never minimize DFA for dynamic lexers
                 return iterator_type();
 
-            iterator_data_type iterator_data(state_machine_, rules_, actions_);
+            iterator_data_type iterator_data(compact_state_machine_
+              , lazy_state_machine_.empty() ? 0 : &lazy_state_machine_
+              , rules_, actions_);
             return iterator_type(iterator_data, first, last, initial_state);
         }
 
@@ -212,11 +237,36 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
             return iterator_type();
         }
 
+        //  Return a tokenizer filling arrays of tokens, this avoids the
+        //  overhead of the token iterator if no backtracking is needed.
+        batch_tokenizer_type batch(Iterator& first, Iterator const& last
+          , char_type const* initial_state = 0) const
+        {
+            init_dfa();
+            iterator_data_type iterator_data(compact_state_machine_
+              , lazy_state_machine_.empty() ? 0 : &lazy_state_machine_
+              , rules_, actions_);
+            return batch_tokenizer_type(iterator_data, first, last
+              , initial_state);
+        }
+
     protected:
         //  Lexer instances can be created by means of a derived class only.
         lexer(unsigned int flags)
           : flags_(detail::map_flags(flags))
           , rules_(flags_)
+          , lazy_dfa_((flags & match_flags::match_lazy_dfa) != 0)
+          , initialized_dfa_(false)
+        {}
+
+        //  The state machine written by save_binary() from a lexer with the
+        //  same token definitions is used instead of building one. The
+        //  tables are not copied, they have to outlive the lexer.
+        lexer(unsigned int flags, binary_state_machine const& tables)
+          : flags_(detail::map_flags(flags))
+          , rules_(flags_)
+          , tables_(tables)
+          , lazy_dfa_((flags & match_flags::match_lazy_dfa) != 0)
           , initialized_dfa_(false)
         {}
 
@@ -322,6 +372,15 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
 //             actions_.add_action(unique_id, add_state(state), wrapper_type::call(act));
 //         }
 
+        //  With match_flags::match_lazy_dfa, the DFA states are built while
+        //  tokenizing, the first time they are reached, and at most this many
+        //  of them are kept for each lexer state (see lazy_state_machine.hpp).
+        //  Such a lexer must not be used by several threads at the same time.
+        void lazy_dfa_max_states(std::size_t max_states)
+        {
+            lazy_state_machine_.max_states(max_states);
+        }
+
         // We do not minimize the state machine by default anymore because
         // Ben said: "If you can afford to generate a lexer at runtime, there
         //            is little point in calling minimise."
@@ -330,14 +389,34 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         {
             if (!initialized_dfa_) {
                 state_machine_.clear();
+                compact_state_machine_.clear();
+                lazy_state_machine_.clear();
+                if (tables_.data && read_state_machine(
+                        tables_, compact_state_machine_
+                      , binary::fingerprint(rules_)))
+                {
+                    initialized_dfa_ = true;
+                    return true;
+                }
+
+                if (lazy_dfa_)
+                {
+                    lazy_state_machine_.build(rules_);
+                    initialized_dfa_ = true;
+                    return true;
+                }
+
+                // the DFAs of the lexer states are built concurrently
                 typedef boost::lexer::basic_generator<char_type> generator;
-                generator::build (rules_, state_machine_);
+                generator::build (rules_, state_machine_, 0);
                 if (minimize)
-                    generator::minimise (state_machine_);
+                    generator::minimise (state_machine_, 0);
 
 #if defined(BOOST_SPIRIT_LEXERTL_DEBUG)
                 boost::lexer::debug::dump(state_machine_, std::cerr);
 #endif
+                // the tables the tokenizer matches against
+                compact_state_machine_.assign(state_machine_);
                 initialized_dfa_ = true;
 
 //                 // release memory held by rules description
@@ -351,8 +430,13 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
     private:
         // lexertl specific data
         mutable boost::lexer::basic_state_machine<char_type> state_machine_;
+        mutable basic_compact_state_machine<char_type> compact_state_machine_;
+        mutable boost::lexer::basic_lazy_state_machine<char_type>
+            lazy_state_machine_;
         boost::lexer::regex_flags flags_;
         /*mutable*/ basic_rules_type rules_;
+        binary_state_machine tables_;
+        bool lazy_dfa_;
 
         typename Functor::semantic_actions_type actions_;
         mutable bool initialized_dfa_;
@@ -362,8 +446,29 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
         friend bool generate_static(Lexer const&
           , std::basic_ostream<typename Lexer::char_type>&
           , typename Lexer::char_type const*, F);
+
+        template <typename Lexer>
+        friend bool save_binary(Lexer const&, std::ostream&);
+
+        template <typename Lexer, typename Iter>
+        friend bool record_state_profile(Lexer const&, Iter, Iter const&
+          , state_profile&);
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  Write the state machine of the given lexer in the format expected by
+    //  the lexer constructor taking a binary_state_machine (see
+    //  binary_state_machine.hpp).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Lexer>
+    inline bool save_binary(Lexer const& lexer, std::ostream& os)
+    {
+        if (!lexer.init_dfa() || lexer.compact_state_machine_.empty())
+            return false;       // the DFA is built lazily
+        return write_state_machine(os, lexer.compact_state_machine_
+          , binary::fingerprint(lexer.rules_));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     //
     //  The actor_lexer class is another implementation of a Spirit.Lex
@@ -385,13 +490,16 @@ namespace boost { namespace spirit { namespace lex { namespace lexertl
     ///////////////////////////////////////////////////////////////////////////
     template <typename Token = token<>
       , typename Iterator = typename Token::iterator_type
-      , typename Functor = functor<Token, lexertl::detail::data, Iterator, mpl::true_> >
-    class actor_lexer : public lexer<Token, Iterator, Functor>
+      , typename Functor = functor<Token, lexertl::detail::data, Iterator, mpl::true_>
+      , typename StoragePolicy = iterator_policies::split_std_deque>
+    class actor_lexer : public lexer<Token, Iterator, Functor, StoragePolicy>
     {
     protected:
         //  Lexer instances can be created by means of a derived class only.
         actor_lexer(unsigned int flags)
-          : lexer<Token, Iterator, Functor>(flags) {}
+          : lexer<Token, Iterator, Functor, StoragePolicy>(flags) {}
+        actor_lexer(unsigned int flags, binary_state_machine const& tables)
+          : lexer<Token, Iterator, Functor, StoragePolicy>(flags, tables) {}
     };
 
 }}}}
@@ -0,0 +1,183 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_LEX_LEXERTL_STATIC_THREADED_OCT_17_2026_0145AM)
+#define BOOST_SPIRIT_LEX_LEXERTL_STATIC_THREADED_OCT_17_2026_0145AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <cstring>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Support code for the lexers generated by generate_static_threaded (see
+//  generate_static.hpp).
+//
+//  The generated lexers jump from state to state using computed goto where
+//  the compiler supports it (GCC and compatible compilers), and a switch
+//  statement otherwise. Define BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO to
+//  always use the switch statement.
+///////////////////////////////////////////////////////////////////////////////
+#if defined(__GNUC__) && !defined(BOOST_SPIRIT_LEXERTL_NO_COMPUTED_GOTO)
+#define BOOST_SPIRIT_LEXERTL_COMPUTED_GOTO
+#endif
+
+#if (defined(__SSE2__) || defined(_M_X64) || \
+        (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && \
+    !defined(BOOST_SPIRIT_LEXERTL_NO_SIMD)
+#define BOOST_SPIRIT_LEXERTL_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace boost { namespace spirit { namespace lex { namespace lexertl
+{
+    namespace static_
+    {
+        ///////////////////////////////////////////////////////////////////////
+        //  scan() returns the position of the first character in [first,
+        //  last) which is one of the given stop characters, or last. The
+        //  generated lexers use it to skip over the input looping back to
+        //  the same state, as in the body of a comment or a string literal.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Iterator>
+        inline Iterator scan(Iterator first, Iterator const& last)
+        {
+            while (first != last)
+                ++first;
+            return first;
+        }
+
+        template <typename Iterator, typename Char>
+        inline Iterator scan(Iterator first, Iterator const& last, Char c0)
+        {
+            while (first != last && *first != c0)
+                ++first;
+            return first;
+        }
+
+        template <typename Iterator, typename Char>
+        inline Iterator scan(Iterator first, Iterator const& last, Char c0
+          , Char c1)
+        {
+            for (/**/; first != last; ++first)
+            {
+                Char const ch = *first;
+                if (ch == c0 || ch == c1)
+                    break;
+            }
+            return first;
+        }
+
+        template <typename Iterator, typename Char>
+        inline Iterator scan(Iterator first, Iterator const& last, Char c0
+          , Char c1, Char c2)
+        {
+            for (/**/; first != last; ++first)
+            {
+                Char const ch = *first;
+                if (ch == c0 || ch == c1 || ch == c2)
+                    break;
+            }
+            return first;
+        }
+
+        template <typename Iterator, typename Char>
+        inline Iterator scan(Iterator first, Iterator const& last, Char c0
+          , Char c1, Char c2, Char c3)
+        {
+            for (/**/; first != last; ++first)
+            {
+                Char const ch = *first;
+                if (ch == c0 || ch == c1 || ch == c2 || ch == c3)
+                    break;
+            }
+            return first;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  Contiguous input is scanned using memchr or SSE2.
+        inline char const* scan(char const*, char const* const& last)
+        {
+            return last;
+        }
+
+        inline char const* scan(char const* first, char const* const& last
+          , char c0)
+        {
+            void const* p = std::memchr(first, c0, last - first);
+            return p ? static_cast<char const*>(p) : last;
+        }
+
+        namespace detail
+        {
+#if defined(BOOST_SPIRIT_LEXERTL_SSE2)
+            // scan 16 characters at a time for up to 4 stop characters,
+            // unused stop characters repeat c0
+            inline char const* scan_sse2(char const* first
+              , char const* last, char c0, char c1, char c2, char c3)
+            {
+                __m128i const v0 = _mm_set1_epi8(c0);
+                __m128i const v1 = _mm_set1_epi8(c1);
+                __m128i const v2 = _mm_set1_epi8(c2);
+                __m128i const v3 = _mm_set1_epi8(c3);
+
+                for (/**/; last - first >= 16; first += 16)
+                {
+                    __m128i const data = _mm_loadu_si128(
+                        reinterpret_cast<__m128i const*>(first));
+                    __m128i const found = _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(data, v0)
+                          , _mm_cmpeq_epi8(data, v1))
+                      , _mm_or_si128(_mm_cmpeq_epi8(data, v2)
+                          , _mm_cmpeq_epi8(data, v3)));
+
+                    unsigned int mask = static_cast<unsigned int>(
+                        _mm_movemask_epi8(found));
+                    if (mask != 0)
+                    {
+                        while (!(mask & 1))
+                        {
+                            mask >>= 1;
+                            ++first;
+                        }
+                        return first;
+                    }
+                }
+
+                for (/**/; first != last; ++first)
+                {
+                    char const ch = *first;
+                    if (ch == c0 || ch == c1 || ch == c2 || ch == c3)
+                        break;
+                }
+                return first;
+            }
+#endif
+        }
+
+#if defined(BOOST_SPIRIT_LEXERTL_SSE2)
+        inline char const* scan(char const* first, char const* const& last
+          , char c0, char c1)
+        {
+            return detail::scan_sse2(first, last, c0, c1, c0, c0);
+        }
+
+        inline char const* scan(char const* first, char const* const& last
+          , char c0, char c1, char c2)
+        {
+            return detail::scan_sse2(first, last, c0, c1, c2, c0);
+        }
+
+        inline char const* scan(char const* first, char const* const& last
+          , char c0, char c1, char c2, char c3)
+        {
+            return detail::scan_sse2(first, last, c0, c1, c2, c3);
+        }
+#endif
+    }
+}}}}
+
+#endif
@@ -20,6 +20,7 @@
 #include <boost/spirit/home/qi/detail/attributes.hpp>
 #include <boost/spirit/home/support/char_encoding/ascii.hpp>
 #include <boost/spirit/home/support/numeric_traits.hpp>
+#include <boost/spirit/home/support/detail/digit_block.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/iteration/local.hpp>
 #include <boost/preprocessor/comparison/less.hpp>
@@ -28,6 +29,7 @@
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_integral.hpp>
 #include <boost/type_traits/is_signed.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/and.hpp>
 #include <boost/limits.hpp>
@@ -156,6 +158,21 @@ namespace boost { namespace spirit { namespace qi { namespace detail
             n += static_cast<T>(digit);
             return true;
         }
+
+        template <typename T>
+        inline static bool add_block(T& n, boost::uint32_t block) // checked add
+        {
+            // Ensure n * Radix^8 + block will not overflow
+            typedef constexpr_int<T, boost::integer_traits<T>::const_max> max;
+            typedef constexpr_int<T
+              , T(spirit::detail::digit_block_scale<Radix>::value)> scale;
+
+            if (n > (max::value - static_cast<T>(block)) / scale::value)
+                return false;
+
+            n = n * scale::value + static_cast<T>(block);
+            return true;
+        }
     };
 
     template <unsigned Radix>
@@ -188,6 +205,101 @@ namespace boost { namespace spirit { namespace qi { namespace detail
             n -= static_cast<T>(digit);
             return true;
         }
+
+        template <typename T>
+        inline static bool add_block(T& n, boost::uint32_t block) // checked subtract
+        {
+            // Ensure n * Radix^8 - block will not underflow
+            typedef constexpr_int<T, boost::integer_traits<T>::const_min> min;
+            typedef constexpr_int<T
+              , T(spirit::detail::digit_block_scale<Radix>::value)> scale;
+
+            if (n < (min::value + static_cast<T>(block)) / scale::value)
+                return false;
+
+            n = n * scale::value - static_cast<T>(block);
+            return true;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  block_extractor: Extract 8 digits at a time from char pointers for as
+    //  long as they are all valid and fit into n. Returns the number of
+    //  digits consumed; the remaining ones (and any overflow) are left to
+    //  the digit by digit loop.
+    ///////////////////////////////////////////////////////////////////////////
+    template <unsigned Radix, typename Accumulator>
+    struct is_block_accumulator : mpl::false_ {};
+
+    template <unsigned Radix>
+    struct is_block_accumulator<Radix, positive_accumulator<Radix> >
+      : mpl::bool_<Radix == 10 || Radix == 16> {};
+
+    template <unsigned Radix>
+    struct is_block_accumulator<Radix, negative_accumulator<Radix> >
+      : mpl::bool_<Radix == 10 || Radix == 16> {};
+
+    template <typename Iterator>
+    struct is_block_iterator
+      : mpl::bool_<
+            is_same<Iterator, char const*>::value
+         || is_same<Iterator, char*>::value
+        >
+    {};
+
+    template <unsigned Radix, typename Accumulator, int MaxDigits>
+    struct block_extractor
+    {
+        template <typename T>
+        inline static std::size_t
+        call(char const*& it, char const* last, T& n, mpl::true_)
+        {
+            typedef spirit::detail::digit_block<Radix> block;
+            std::size_t const size = spirit::detail::digit_block_size;
+
+            std::size_t count = 0;
+            while (static_cast<std::size_t>(last - it) >= size)
+            {
+                boost::uint64_t const w = spirit::detail::load_digit_block(it);
+                if (!block::is_valid(w) || !Accumulator::add_block(n, block::value(w)))
+                    break;
+                it += size;
+                count += size;
+            }
+            return count;
+        }
+
+        template <typename T>
+        inline static std::size_t
+        call(char*& it, char* last, T& n, mpl::true_)
+        {
+            char const* first = it;
+            std::size_t const count = call(first, last, n, mpl::true_());
+            it += count;
+            return count;
+        }
+
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator& /*it*/, Iterator const& /*last*/, T& /*n*/, mpl::false_)
+        {
+            return 0;
+        }
+
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator& it, Iterator const& last, T& n)
+        {
+            return call(it, last, n
+              , mpl::bool_<
+                    (MaxDigits < 0)
+                  && is_block_accumulator<Radix, Accumulator>::value
+                  && is_block_iterator<Iterator>::value
+                  && is_integral<T>::value
+                  && (digits_traits<T, Radix>::value > 8)
+                >()
+            );
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -339,7 +451,8 @@ namespace boost { namespace spirit { namespace qi { namespace detail
             attribute_type;
 
             attribute_type val = Accumulate ? attr : attribute_type(0);
-            std::size_t count = 0;
+            std::size_t count = block_extractor<Radix, Accumulator, MaxDigits>
+                ::call(it, last, val);
             char_type ch;
 
             while (true)
@@ -466,6 +579,7 @@ namespace boost { namespace spirit { namespace qi { namespace detail
 
             // count = 0; $$$ verify: I think this is wrong $$$
             ++it;
+            count += block_extractor<Radix, Accumulator, -1>::call(it, last, val);
             while (true)
             {
                 BOOST_PP_REPEAT(
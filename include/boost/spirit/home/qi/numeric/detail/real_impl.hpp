@@ -20,7 +20,10 @@
 #include <boost/spirit/home/qi/detail/attributes.hpp>
 #include <boost/spirit/home/support/detail/pow10.hpp>
 #include <boost/spirit/home/support/detail/sign.hpp>
+#include <boost/spirit/home/support/detail/decimal_to_float.hpp>
 #include <boost/integer.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/type_traits/is_integral.hpp>
 #include <boost/assert.hpp>
 
 #if BOOST_WORKAROUND(BOOST_MSVC, >= 1400)
@@ -57,6 +60,26 @@ namespace boost { namespace spirit { namespace traits
         {
             compensate_roundoff(n, acc_n, is_integral<AccT>());
         }
+
+        template <typename T, typename AccT>
+        inline typename disable_if<is_integral<AccT>, bool>::type
+        scale_exact(int /*exp*/, T& /*n*/, AccT const& /*acc_n*/)
+        {
+            // the digits have not been accumulated exactly
+            return false;
+        }
+
+        template <typename T, typename AccT>
+        inline typename enable_if<is_integral<AccT>, bool>::type
+        scale_exact(int exp, T& n, AccT acc_n)
+        {
+            // The policies drop the digits which do not fit into acc_n. If it
+            // is (almost) saturated we have to assume it holds the leading
+            // digits only.
+            bool const truncated =
+                acc_n > ((std::numeric_limits<AccT>::max)() - 9) / 10;
+            return spirit::detail::decimal_to_float(acc_n, exp, truncated, n);
+        }
     }
 
     template <typename T, typename AccT>
@@ -71,6 +94,10 @@ namespace boost { namespace spirit { namespace traits
             // do this check only for primitive types!
             if (is_floating_point<T>() && exp > max_exp)
                 return false;
+
+            // try the correctly rounded conversion first (float and double)
+            if (detail::scale_exact(exp, n, acc_n))
+                return true;
             n = acc_n * pow10<T>(exp);
         }
         else
@@ -78,19 +105,22 @@ namespace boost { namespace spirit { namespace traits
             if (exp < std::numeric_limits<T>::min_exponent10)
             {
                 int min_exp = std::numeric_limits<T>::min_exponent10;
-                detail::compensate_roundoff(n, acc_n);
-                n /= pow10<T>(-min_exp);
 
-                // return false if exp still exceeds the min_exp
+                // return false if exp exceeds twice the min_exp (see below)
                 // do this check only for primitive types!
-                exp += -min_exp;
-                if (is_floating_point<T>() && exp < min_exp)
+                if (is_floating_point<T>() && exp < 2 * min_exp)
                     return false;
+                if (detail::scale_exact(exp, n, acc_n))
+                    return true;
 
-                n /= pow10<T>(-exp);
+                detail::compensate_roundoff(n, acc_n);
+                n /= pow10<T>(-min_exp);
+                n /= pow10<T>(-(exp - min_exp));
             }
             else
             {
+                if (detail::scale_exact(exp, n, acc_n))
+                    return true;
                 n = T(acc_n) / pow10<T>(-exp);
             }
         }
@@ -167,9 +197,11 @@ namespace boost { namespace spirit { namespace traits
     template <typename T>
     struct real_accumulator : mpl::identity<T> {};
 
+    // float uses the same (wider) accumulator as double: 19 exact digits
+    // leave enough room for correct rounding of any float
     template <>
     struct real_accumulator<float>
-        : mpl::identity<uint_t<(sizeof(float)*CHAR_BIT)>::least> {};
+        : mpl::identity<uint_t<(sizeof(double)*CHAR_BIT)>::least> {};
 
     template <>
     struct real_accumulator<double>
@@ -13,9 +13,92 @@
 
 #include <boost/spirit/home/support/unused.hpp>
 #include <boost/spirit/home/qi/detail/unused_skipper.hpp>
+#include <boost/spirit/home/support/detail/skip_white.hpp>
+#include <boost/fusion/container/list/cons_fwd.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <string>
+#include <vector>
+
+namespace boost { namespace spirit
+{
+    namespace tag
+    {
+        struct space;
+
+        template <typename CharClass, typename CharEncoding>
+        struct char_code;
+    }
+
+    namespace qi
+    {
+        template <typename Tag>
+        struct char_class;
+
+        template <typename Elements>
+        struct alternative;
+    }
+}}
 
 namespace boost { namespace spirit { namespace qi
 {
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Skippers starting with a space parser (space, ascii::space,
+        // space | comment, ...) get past runs of blanks in 8 bit character
+        // arrays, strings and vectors without invoking the skipper for every
+        // single character.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Skipper>
+        struct is_space_skipper
+          : mpl::false_ {};
+
+        template <typename CharEncoding>
+        struct is_space_skipper<
+                char_class<spirit::tag::char_code<spirit::tag::space, CharEncoding> > >
+          : mpl::true_ {};
+
+        template <typename Car, typename Cdr>
+        struct is_space_skipper<alternative<fusion::cons<Car, Cdr> > >
+          : is_space_skipper<Car> {};
+
+        template <typename Iterator>
+        struct is_white_iterator
+          : mpl::bool_<
+                is_same<Iterator, char const*>::value
+             || is_same<Iterator, char*>::value
+             || is_same<Iterator, std::string::const_iterator>::value
+             || is_same<Iterator, std::string::iterator>::value
+             || is_same<Iterator, std::vector<char>::const_iterator>::value
+             || is_same<Iterator, std::vector<char>::iterator>::value
+            >
+        {};
+
+        template <typename Iterator, typename T>
+        inline void skip_over(Iterator& first, Iterator const& last
+          , T const& skipper, mpl::false_)
+        {
+            while (skipper.parse(first, last, unused, unused, unused))
+                /***/;
+        }
+
+        template <typename Iterator, typename T>
+        inline void skip_over(Iterator& first, Iterator const& last
+          , T const& skipper, mpl::true_)
+        {
+            do
+            {
+                if (first != last)
+                {
+                    char const* p = &*first;
+                    first += spirit::detail::skip_white(p, p + (last - first)) - p;
+                }
+            }
+            while (skipper.parse(first, last, unused, unused, unused));
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Move the /first/ iterator to the first non-matching position
     // given a skip-parser. The function is a no-op if unused_type is
@@ -24,8 +107,9 @@ namespace boost { namespace spirit { namespace qi
     template <typename Iterator, typename T>
     inline void skip_over(Iterator& first, Iterator const& last, T const& skipper)
     {
-        while (skipper.parse(first, last, unused, unused, unused))
-            /***/;
+        detail::skip_over(first, last, skipper, mpl::bool_<
+            detail::is_space_skipper<T>::value
+         && detail::is_white_iterator<Iterator>::value>());
     }
 
     template <typename Iterator>
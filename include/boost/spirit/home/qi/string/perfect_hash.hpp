@@ -0,0 +1,163 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_PERFECT_HASH_OCTOBER_16_2016_0230PM)
+#define BOOST_SPIRIT_PERFECT_HASH_OCTOBER_16_2016_0230PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/qi/string/tst.hpp>
+#include <boost/spirit/home/support/detail/perfect_hash.hpp>
+#include <boost/call_traits.hpp>
+
+namespace boost { namespace spirit { namespace qi
+{
+    namespace detail
+    {
+        template <typename Filter>
+        struct perfect_hash_equal
+        {
+            perfect_hash_equal(Filter const& filter)
+              : filter(filter)
+            {
+            }
+
+            template <typename Ch, typename Char>
+            bool operator()(Ch ch, Char key) const
+            {
+                return filter(ch) == key;
+            }
+
+            Filter const& filter;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  perfect_hash: a Lookup for symbols tables that are filled once and
+    //  then only searched (keywords, reserved words, ...).
+    //
+    //  It behaves like (and is) a tst until freeze() is called. freeze()
+    //  compiles the symbols into a minimal perfect hash table (see
+    //  support/detail/perfect_hash.hpp); lookups then hash the filtered
+    //  input a prefix at a time, for as long as there are keys starting
+    //  with it, and verify the keys found, still returning the longest
+    //  match. Adding or removing symbols afterwards turns the table back
+    //  into a tst, until the next freeze().
+    //
+    //  freeze() moves the values: pointers returned by add no longer refer
+    //  to them.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename T>
+    struct perfect_hash
+    {
+        typedef Char char_type; // the character type
+        typedef T value_type; // the value associated with each entry
+
+        perfect_hash()
+          : frozen(false)
+        {
+        }
+
+        template <typename Iterator, typename Filter>
+        T* find(Iterator& first, Iterator last, Filter filter) const
+        {
+            if (!frozen)
+                return pending.find(first, last, filter);
+            return table.find(first, last, filter
+              , detail::perfect_hash_equal<Filter>(filter));
+        }
+
+        template <typename Iterator>
+        T* find(Iterator& first, Iterator last) const
+        {
+            return find(first, last, tst_pass_through());
+        }
+
+        template <typename Iterator>
+        T* add(
+            Iterator first
+          , Iterator last
+          , typename boost::call_traits<T>::param_type val)
+        {
+            thaw();
+            return pending.add(first, last, val);
+        }
+
+        template <typename Iterator>
+        void remove(Iterator first, Iterator last)
+        {
+            thaw();
+            pending.remove(first, last);
+        }
+
+        void clear()
+        {
+            pending.clear();
+            table.clear();
+            frozen = false;
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            if (frozen)
+                table.for_each(f);
+            else
+                pending.for_each(f);
+        }
+
+        void freeze()
+        {
+            if (!frozen)
+            {
+                table.assign(pending);
+                pending.clear();
+                frozen = true;
+            }
+        }
+
+        bool is_frozen() const
+        {
+            return frozen;
+        }
+
+    private:
+
+        struct adder
+        {
+            adder(tst<Char, T>& lookup)
+              : lookup(lookup)
+            {
+            }
+
+            template <typename String>
+            void operator()(String const& s, T const& val) const
+            {
+                lookup.add(s.begin(), s.end(), val);
+            }
+
+            tst<Char, T>& lookup;
+        };
+
+        void thaw()
+        {
+            if (frozen)
+            {
+                table.for_each(adder(pending));
+                table.clear();
+                frozen = false;
+            }
+        }
+
+        tst<Char, T> pending;
+        spirit::detail::perfect_hash_table<Char, T> table;
+        bool frozen;
+    };
+}}}
+
+#endif
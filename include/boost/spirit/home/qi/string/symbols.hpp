@@ -141,6 +141,13 @@ namespace boost { namespace spirit { namespace qi
             lookup->clear();
         }
 
+        // compile the symbols into a read-only form (for Lookups providing
+        // it, such as perfect_hash)
+        void freeze()
+        {
+            lookup->freeze();
+        }
+
         struct adder;
         struct remover;
 
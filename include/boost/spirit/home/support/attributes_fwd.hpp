@@ -277,6 +277,15 @@ namespace boost { namespace spirit { namespace traits
     template <typename Attribute, typename T, typename Enable = void>
     struct symbols_value;
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Write ranges of characters to the output iterator given to karma
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Enable = void>
+    struct sink_write;
+
+    template <typename OutputIterator, typename Enable = void>
+    struct sink_reserve;
+
     ///////////////////////////////////////////////////////////////////////////
     // transform attribute types exposed from compound operator components
     ///////////////////////////////////////////////////////////////////////////
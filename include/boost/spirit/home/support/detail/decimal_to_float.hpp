@@ -0,0 +1,374 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+    http://spirit.sourceforge.net/
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(SPIRIT_DECIMAL_TO_FLOAT_OCTOBER_16_2016_1000AM)
+#define SPIRIT_DECIMAL_TO_FLOAT_OCTOBER_16_2016_1000AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <cfloat>
+#include <cstring>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/spirit/home/support/detail/power_of_five.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//  Correctly rounded conversion of a decimal number w * 10^q (w being a 64 bit
+//  unsigned integer) to float or double, based on the algorithm described by
+//  Daniel Lemire in "Number Parsing at a Gigabyte per Second" (2021), which
+//  builds on Michael Eisel's work:
+//
+//    - if w and 10^q are both exactly representable, a single floating point
+//      multiplication or division gives the correctly rounded result
+//      (Clinger's fast path),
+//
+//    - otherwise w is multiplied by a 128 bit approximation of 5^q. In all but
+//      very few cases the upper bits of the product are enough to determine
+//      the correctly rounded binary significand.
+//
+//  The conversion reports failure (and leaves the result untouched) whenever
+//  it cannot guarantee correct rounding. Callers are expected to fall back to
+//  a slower computation in that case.
+///////////////////////////////////////////////////////////////////////////////
+namespace boost { namespace spirit { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  Parameters of the IEEE-754 binary formats
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct binary_format;
+
+    template <>
+    struct binary_format<double>
+    {
+        typedef boost::uint64_t bits_type;
+
+        static int const mantissa_explicit_bits = 52;
+        static int const minimum_exponent = -1023;
+        static int const infinite_power = 0x7FF;
+        static int const smallest_power_of_ten = -342;
+        static int const largest_power_of_ten = 308;
+        static int const min_exponent_round_to_even = -4;
+        static int const max_exponent_round_to_even = 23;
+        static int const max_exponent_fast_path = 22;
+        static boost::uint64_t const max_mantissa_fast_path =
+            boost::uint64_t(2) << mantissa_explicit_bits;
+
+        static bool is_supported()
+        {
+            return std::numeric_limits<double>::is_iec559
+                && std::numeric_limits<double>::digits == 53;
+        }
+
+        static double exact_power_of_ten(int q)
+        {
+            static double const powers[] =
+            {
+                1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+            return powers[q];
+        }
+    };
+
+    template <>
+    struct binary_format<float>
+    {
+        typedef boost::uint32_t bits_type;
+
+        static int const mantissa_explicit_bits = 23;
+        static int const minimum_exponent = -127;
+        static int const infinite_power = 0xFF;
+        static int const smallest_power_of_ten = -65;
+        static int const largest_power_of_ten = 38;
+        static int const min_exponent_round_to_even = -17;
+        static int const max_exponent_round_to_even = 10;
+        static int const max_exponent_fast_path = 10;
+        static boost::uint64_t const max_mantissa_fast_path =
+            boost::uint64_t(2) << mantissa_explicit_bits;
+
+        static bool is_supported()
+        {
+            return std::numeric_limits<float>::is_iec559
+                && std::numeric_limits<float>::digits == 24;
+        }
+
+        static float exact_power_of_ten(int q)
+        {
+            static float const powers[] =
+            {
+                1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f,
+                1e8f, 1e9f, 1e10f
+            };
+            return powers[q];
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  64 bit arithmetic helpers
+    ///////////////////////////////////////////////////////////////////////////
+    struct uint128_parts
+    {
+        boost::uint64_t high;
+        boost::uint64_t low;
+    };
+
+    inline uint128_parts full_multiplication(boost::uint64_t a, boost::uint64_t b)
+    {
+        uint128_parts r;
+#if defined(BOOST_HAS_INT128)
+        boost::uint128_type const p = boost::uint128_type(a) * b;
+        r.high = boost::uint64_t(p >> 64);
+        r.low = boost::uint64_t(p);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        r.low = _umul128(a, b, &r.high);
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+        r.high = __umulh(a, b);
+        r.low = a * b;
+#else
+        boost::uint64_t const mask = 0xFFFFFFFF;
+        boost::uint64_t const a_lo = a & mask, a_hi = a >> 32;
+        boost::uint64_t const b_lo = b & mask, b_hi = b >> 32;
+        boost::uint64_t const p0 = a_lo * b_lo;
+        boost::uint64_t const p1 = a_lo * b_hi;
+        boost::uint64_t const p2 = a_hi * b_lo;
+        boost::uint64_t const p3 = a_hi * b_hi;
+        boost::uint64_t const mid = (p0 >> 32) + (p1 & mask) + (p2 & mask);
+        r.low = (mid << 32) | (p0 & mask);
+        r.high = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+#endif
+        return r;
+    }
+
+    inline int leading_zeros(boost::uint64_t w)
+    {
+        // precondition: w != 0
+#if defined(__GNUC__)
+        return __builtin_clzll(w);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+        unsigned long index;
+        _BitScanReverse64(&index, w);
+        return 63 - int(index);
+#else
+        int n = 0;
+        for (int shift = 32; shift != 0; shift >>= 1)
+        {
+            if ((w >> (64 - shift)) == 0)
+            {
+                n += shift;
+                w <<= shift;
+            }
+        }
+        return n;
+#endif
+    }
+
+    // floor(log2(10^q)) + 63, exact for -342 <= q <= 308
+    inline int binary_power_of_ten(int q)
+    {
+        return (((152170 + 65536) * q) >> 16) + 63;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Compute the binary significand and biased exponent of w * 10^q.
+    //  Returns false if the result cannot be determined from the 128 bit
+    //  approximation of 5^q.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline bool
+    compute_float(boost::uint64_t w, int q, boost::uint64_t& mantissa, int& power2)
+    {
+        typedef binary_format<T> format;
+        typedef power_of_five<> powers;
+
+        int const bits = format::mantissa_explicit_bits;
+
+        if (w == 0 || q < format::smallest_power_of_ten)
+        {
+            mantissa = 0;
+            power2 = 0;
+            return true;
+        }
+        if (q > format::largest_power_of_ten)
+        {
+            mantissa = 0;
+            power2 = format::infinite_power;
+            return true;
+        }
+
+        int const lz = detail::leading_zeros(w);
+        w <<= lz;
+
+        // We need the upper mantissa_explicit_bits + 3 bits of the product to
+        // be exact. Only if the bits below them are all ones, the lower half
+        // of the power of five may carry into them.
+        uint128_parts product = detail::full_multiplication(w, powers::high(q));
+        boost::uint64_t const precision_mask =
+            ~boost::uint64_t(0) >> (bits + 3);
+        if ((product.high & precision_mask) == precision_mask)
+        {
+            uint128_parts const second =
+                detail::full_multiplication(w, powers::low(q));
+            product.low += second.high;
+            if (second.high > product.low)
+                ++product.high;
+        }
+
+        // The product is still an approximation. If its lower half is all
+        // ones, we cannot tell which way to round, unless 5^q is exactly
+        // represented in the table.
+        if (product.low == ~boost::uint64_t(0) && (q < -27 || q > 55))
+            return false;
+
+        int const upperbit = int(product.high >> 63);
+        int const shift = upperbit + 64 - bits - 3;
+        mantissa = product.high >> shift;
+        power2 = detail::binary_power_of_ten(q) + upperbit - lz
+            - format::minimum_exponent;
+
+        if (power2 <= 0)
+        {
+            // subnormal (or zero)
+            if (-power2 + 1 >= 64)
+            {
+                mantissa = 0;
+                power2 = 0;
+                return true;
+            }
+            mantissa >>= -power2 + 1;
+            mantissa += (mantissa & 1);     // round up
+            mantissa >>= 1;
+
+            // rounding may have turned the subnormal into the smallest
+            // normal number
+            power2 = (mantissa < (boost::uint64_t(1) << bits)) ? 0 : 1;
+            return true;
+        }
+
+        // We usually round up, but exactly halfway between two floats we
+        // round to even. This can only happen for small q, where 5^q is
+        // exactly represented.
+        if (product.low <= 1
+            && q >= format::min_exponent_round_to_even
+            && q <= format::max_exponent_round_to_even
+            && (mantissa & 3) == 1
+            && (mantissa << shift) == product.high)
+        {
+            mantissa &= ~boost::uint64_t(1);
+        }
+
+        mantissa += (mantissa & 1);         // round up
+        mantissa >>= 1;
+        if (mantissa >= (boost::uint64_t(2) << bits))
+        {
+            mantissa = boost::uint64_t(1) << bits;
+            ++power2;                       // undo the overflow of the rounding
+        }
+
+        mantissa &= ~(boost::uint64_t(1) << bits);
+        if (power2 >= format::infinite_power)
+        {
+            mantissa = 0;
+            power2 = format::infinite_power;
+        }
+        return true;
+    }
+
+    template <typename T>
+    inline T
+    make_float(boost::uint64_t mantissa, int power2)
+    {
+        typedef typename binary_format<T>::bits_type bits_type;
+        bits_type const bits = static_cast<bits_type>(mantissa
+            | (boost::uint64_t(power2) << binary_format<T>::mantissa_explicit_bits));
+
+        T result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Convert w * 10^q to the nearest T. If truncated is true, w holds only
+    //  the leading digits of the number (the real value lies in
+    //  [w, w + 1) * 10^q): the conversion succeeds only if both ends of the
+    //  interval round to the same value.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    inline bool
+    decimal_to_float_impl(boost::uint64_t w, int q, bool truncated, T& result)
+    {
+        typedef binary_format<T> format;
+
+        if (!format::is_supported())
+            return false;
+
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+        // Clinger's fast path: both operands are exact, so is the result
+        if (!truncated && w <= format::max_mantissa_fast_path
+            && q >= -format::max_exponent_fast_path
+            && q <= format::max_exponent_fast_path)
+        {
+            T const value = static_cast<T>(w);
+            result = q < 0 ?
+                value / format::exact_power_of_ten(-q) :
+                value * format::exact_power_of_ten(q);
+            return true;
+        }
+#endif
+
+        boost::uint64_t mantissa;
+        int power2;
+        if (!detail::compute_float<T>(w, q, mantissa, power2))
+            return false;
+
+        if (truncated)
+        {
+            boost::uint64_t upper_mantissa;
+            int upper_power2;
+            if (w == ~boost::uint64_t(0)
+                || !detail::compute_float<T>(w + 1, q, upper_mantissa, upper_power2)
+                || mantissa != upper_mantissa || power2 != upper_power2)
+            {
+                return false;
+            }
+        }
+
+        result = detail::make_float<T>(mantissa, power2);
+        return true;
+    }
+
+    template <typename T>
+    inline bool
+    decimal_to_float(boost::uint64_t /*w*/, int /*q*/, bool /*truncated*/, T& /*result*/)
+    {
+        // not an IEEE-754 binary format we know about
+        return false;
+    }
+
+    inline bool
+    decimal_to_float(boost::uint64_t w, int q, bool truncated, double& result)
+    {
+        return detail::decimal_to_float_impl(w, q, truncated, result);
+    }
+
+    inline bool
+    decimal_to_float(boost::uint64_t w, int q, bool truncated, float& result)
+    {
+        return detail::decimal_to_float_impl(w, q, truncated, result);
+    }
+}}}
+
+#endif
@@ -0,0 +1,140 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+    http://spirit.sourceforge.net/
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(SPIRIT_DIGIT_BLOCK_OCTOBER_16_2016_1100AM)
+#define SPIRIT_DIGIT_BLOCK_OCTOBER_16_2016_1100AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <cstddef>
+#include <cstring>
+#include <boost/cstdint.hpp>
+#include <boost/predef/other/endian.h>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Conversion of 8 characters at a time (SIMD within a register) for the
+//  integer extractors. A block is loaded into a 64 bit word, the first
+//  character ending up in the least significant byte. All 8 characters are
+//  validated with a handful of additions and masks and then folded into a
+//  binary value with three multiplications (radix 10) or a few shifts
+//  (radix 16).
+///////////////////////////////////////////////////////////////////////////////
+namespace boost { namespace spirit { namespace detail
+{
+    std::size_t const digit_block_size = 8;
+
+    inline boost::uint64_t load_digit_block(char const* p)
+    {
+        boost::uint64_t w;
+        std::memcpy(&w, p, sizeof(w));
+#if BOOST_ENDIAN_BIG_BYTE
+        w = ((w & UINT64_C(0x00000000ffffffff)) << 32)
+          | ((w & UINT64_C(0xffffffff00000000)) >> 32);
+        w = ((w & UINT64_C(0x0000ffff0000ffff)) << 16)
+          | ((w & UINT64_C(0xffff0000ffff0000)) >> 16);
+        w = ((w & UINT64_C(0x00ff00ff00ff00ff)) << 8)
+          | ((w & UINT64_C(0xff00ff00ff00ff00)) >> 8);
+#endif
+        return w;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  Radix specific block conversion:
+    //
+    //      Test whether all 8 characters of the block are valid digits:
+    //
+    //          static bool is_valid(boost::uint64_t w);
+    //
+    //      Convert a valid block to binary (the first character being the
+    //      most significant digit):
+    //
+    //          static boost::uint32_t value(boost::uint64_t w);
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <unsigned Radix>
+    struct digit_block;
+
+    template <>
+    struct digit_block<10>
+    {
+        static bool is_valid(boost::uint64_t w)
+        {
+            // a byte is a digit if neither adding 0x46 ('9' + 1 + 0x46 ==
+            // 0x80) nor subtracting '0' sets (or borrows from) its top bit
+            return (((w + UINT64_C(0x4646464646464646))
+                | (w - UINT64_C(0x3030303030303030)))
+                & UINT64_C(0x8080808080808080)) == 0;
+        }
+
+        static boost::uint32_t value(boost::uint64_t w)
+        {
+            // combine pairs of digits, then pairs of pairs, ...
+            w = ((w & UINT64_C(0x0f0f0f0f0f0f0f0f)) * 2561) >> 8;
+            w = ((w & UINT64_C(0x00ff00ff00ff00ff)) * 6553601) >> 16;
+            return static_cast<boost::uint32_t>(
+                ((w & UINT64_C(0x0000ffff0000ffff)) * UINT64_C(42949672960001)) >> 32);
+        }
+    };
+
+    template <>
+    struct digit_block<16>
+    {
+        // high bit of each byte set if the byte is >= lo (bytes < 0x80 only)
+        static boost::uint64_t at_least(boost::uint64_t w, unsigned lo)
+        {
+            return w + UINT64_C(0x0101010101010101) * (0x80 - lo);
+        }
+
+        // high bit of each byte set if the byte is > hi (bytes < 0x80 only)
+        static boost::uint64_t above(boost::uint64_t w, unsigned hi)
+        {
+            return w + UINT64_C(0x0101010101010101) * (0x7f - hi);
+        }
+
+        static bool is_valid(boost::uint64_t w)
+        {
+            boost::uint64_t const highs = UINT64_C(0x8080808080808080);
+            boost::uint64_t const lower = w | UINT64_C(0x2020202020202020);
+            boost::uint64_t const digit = at_least(w, '0') & ~above(w, '9');
+            boost::uint64_t const alpha = at_least(lower, 'a') & ~above(lower, 'f');
+            return ((digit | alpha) & ~w & highs) == highs;
+        }
+
+        static boost::uint32_t value(boost::uint64_t w)
+        {
+            // 'a'..'f' and 'A'..'F' have bit 6 set, '0'..'9' have not
+            w = (w & UINT64_C(0x0f0f0f0f0f0f0f0f))
+              + ((w >> 6) & UINT64_C(0x0101010101010101)) * 9;
+            w = (w << 4) + (w >> 8);
+            return static_cast<boost::uint32_t>(
+                ((w & 0xff) << 24) | ((w >> 16 & 0xff) << 16)
+              | ((w >> 32 & 0xff) << 8) | (w >> 48 & 0xff));
+        }
+    };
+
+    // Radix^8, the factor a value is shifted by when a block is appended
+    template <unsigned Radix>
+    struct digit_block_scale;
+
+    template <>
+    struct digit_block_scale<10>
+    {
+        static boost::uint64_t const value = UINT64_C(100000000);
+    };
+
+    template <>
+    struct digit_block_scale<16>
+    {
+        static boost::uint64_t const value = UINT64_C(0x100000000);
+    };
+}}}
+
+#endif
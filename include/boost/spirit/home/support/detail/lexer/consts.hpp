@@ -14,7 +14,9 @@ namespace boost
 {
 namespace lexer
 {
-    enum regex_flags {none = 0, icase = 1, dot_not_newline = 2};
+    // utf8: the regexes of char based rules are written over Unicode code
+    // points and compiled into DFAs matching their UTF-8 encoding
+    enum regex_flags {none = 0, icase = 1, dot_not_newline = 2, utf8 = 4};
     // 0 = end state, 1 = id, 2 = unique_id, 3 = lex state, 4 = bol, 5 = eol,
     // 6 = dead_state_index
     enum {end_state_index, id_index, unique_id_index, state_index, bol_index,
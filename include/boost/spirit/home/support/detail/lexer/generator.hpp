@@ -17,6 +17,8 @@
 #include "parser/parser.hpp"
 #include "containers/ptr_list.hpp"
 #include <boost/move/unique_ptr.hpp>
+#include "literals.hpp"
+#include "parallel_for.hpp"
 #include "rules.hpp"
 #include "state_machine.hpp"
 
@@ -33,10 +35,19 @@ public:
 
     static void build (const rules &rules_,
         basic_state_machine<CharT> &state_machine_)
+    {
+        build (rules_, state_machine_, 1);
+    }
+
+    // The DFAs of the lexer states are independent, so they are built on
+    // up to threads_ threads (one per core if 0). The result is the same
+    // as that of the serial build.
+    static void build (const rules &rules_,
+        basic_state_machine<CharT> &state_machine_,
+        const std::size_t threads_)
     {
         std::size_t index_ = 0;
         std::size_t size_ = rules_.statemap ().size ();
-        node_ptr_vector node_ptr_vector_;
         detail::internals &internals_ = const_cast<detail::internals &>
             (state_machine_.data ());
         bool seen_BOL_assertion_ = false;
@@ -51,38 +62,26 @@ public:
             internals_._dfa_alphabet.push_back (0);
             internals_._dfa->push_back (static_cast<size_t_vector *>(0));
             internals_._dfa->back () = new size_t_vector;
+            internals_._literals->push_back (static_cast<size_t_vector *>(0));
+            internals_._literals->back () = new size_t_vector;
         }
 
-        for (index_ = 0, size_ = internals_._lookup->size ();
-            index_ < size_; ++index_)
-        {
-            internals_._lookup[index_]->resize (sizeof (CharT) == 1 ?
-                num_chars : num_wchar_ts, dead_state_index);
-
-            if (!rules_.regexes ()[index_].empty ())
-            {
-                // vector mapping token indexes to partitioned token index sets
-                index_set_vector set_mapping_;
-                // syntax tree
-                detail::node *root_ = build_tree (rules_, index_,
-                    node_ptr_vector_, internals_, set_mapping_);
+        size_ = internals_._lookup->size ();
 
-                build_dfa (root_, set_mapping_,
-                    internals_._dfa_alphabet[index_],
-                    *internals_._dfa[index_]);
+        dfa_builder builder_ (rules_, internals_);
 
-                if (internals_._seen_BOL_assertion)
-                {
-                    seen_BOL_assertion_ = true;
-                }
+        detail::parallel_for (size_, threads_, builder_);
 
-                if (internals_._seen_EOL_assertion)
-                {
-                    seen_EOL_assertion_ = true;
-                }
+        for (index_ = 0; index_ < size_; ++index_)
+        {
+            if (builder_._seen_BOL_assertion[index_])
+            {
+                seen_BOL_assertion_ = true;
+            }
 
-                internals_._seen_BOL_assertion = false;
-                internals_._seen_EOL_assertion = false;
+            if (builder_._seen_EOL_assertion[index_])
+            {
+                seen_EOL_assertion_ = true;
             }
         }
 
@@ -91,27 +90,18 @@ public:
     }
 
     static void minimise (basic_state_machine<CharT> &state_machine_)
+    {
+        minimise (state_machine_, 1);
+    }
+
+    static void minimise (basic_state_machine<CharT> &state_machine_,
+        const std::size_t threads_)
     {
         detail::internals &internals_ = const_cast<detail::internals &>
             (state_machine_.data ());
-        const std::size_t machines_ = internals_._dfa->size ();
+        dfa_minimiser minimiser_ (internals_);
 
-        for (std::size_t i_ = 0; i_ < machines_; ++i_)
-        {
-            const std::size_t dfa_alphabet_ = internals_._dfa_alphabet[i_];
-            size_t_vector *dfa_ = internals_._dfa[i_];
-
-            if (dfa_alphabet_ != 0)
-            {
-                std::size_t size_ = 0;
-
-                do
-                {
-                    size_ = dfa_->size ();
-                    minimise_dfa (dfa_alphabet_, *dfa_, size_);
-                } while (dfa_->size () != size_);
-            }
-        }
+        detail::parallel_for (internals_._dfa->size (), threads_, minimiser_);
     }
 
 protected:
@@ -138,11 +128,93 @@ protected:
     typedef std::pair<macro_iter, bool> macro_iter_pair;
     typedef typename parser::tokeniser::token_map token_map;
 
+    // Builds the DFA of a lexer state
+    struct dfa_builder
+    {
+        const rules &_rules;
+        detail::internals &_internals;
+        std::vector<char> _seen_BOL_assertion;
+        std::vector<char> _seen_EOL_assertion;
+
+        dfa_builder (const rules &rules_, detail::internals &internals_) :
+            _rules (rules_),
+            _internals (internals_),
+            _seen_BOL_assertion (internals_._lookup->size (), false),
+            _seen_EOL_assertion (internals_._lookup->size (), false)
+        {
+        }
+
+        void operator () (const std::size_t index_)
+        {
+            _internals._lookup[index_]->resize (sizeof (CharT) == 1 ?
+                num_chars : num_wchar_ts, dead_state_index);
+
+            if (!_rules.regexes ()[index_].empty ())
+            {
+                node_ptr_vector node_ptr_vector_;
+                // vector mapping token indexes to partitioned token index sets
+                index_set_vector set_mapping_;
+                bool seen_BOL_assertion_ = false;
+                bool seen_EOL_assertion_ = false;
+                // syntax tree
+                detail::node *root_ = build_tree (_rules, index_,
+                    node_ptr_vector_, _internals._lookup[index_],
+                    _internals._dfa_alphabet[index_], seen_BOL_assertion_,
+                    seen_EOL_assertion_, set_mapping_);
+
+                build_dfa (root_, set_mapping_,
+                    _internals._dfa_alphabet[index_],
+                    *_internals._dfa[index_]);
+                build_literals (*_internals._lookup[index_],
+                    _internals._dfa_alphabet[index_],
+                    *_internals._dfa[index_], *_internals._literals[index_]);
+                _seen_BOL_assertion[index_] = seen_BOL_assertion_;
+                _seen_EOL_assertion[index_] = seen_EOL_assertion_;
+            }
+        }
+    };
+
+    // Minimises the DFA of a lexer state
+    struct dfa_minimiser
+    {
+        detail::internals &_internals;
+
+        explicit dfa_minimiser (detail::internals &internals_) :
+            _internals (internals_)
+        {
+        }
+
+        void operator () (const std::size_t index_)
+        {
+            const std::size_t dfa_alphabet_ = _internals._dfa_alphabet[index_];
+            size_t_vector *dfa_ = _internals._dfa[index_];
+
+            if (dfa_alphabet_ != 0)
+            {
+                std::size_t size_ = 0;
+
+                do
+                {
+                    size_ = dfa_->size ();
+                    minimise_dfa (dfa_alphabet_, *dfa_, size_);
+                } while (dfa_->size () != size_);
+
+                // the states have been renumbered
+                if (index_ < _internals._literals->size ())
+                {
+                    build_literals (*_internals._lookup[index_],
+                        dfa_alphabet_, *dfa_, *_internals._literals[index_]);
+                }
+            }
+        }
+    };
+
     static detail::node *build_tree (const rules &rules_,
         const std::size_t state_, node_ptr_vector &node_ptr_vector_,
-        detail::internals &internals_, index_set_vector &set_mapping_)
+        size_t_vector *lookup_, std::size_t &dfa_alphabet_,
+        bool &seen_BOL_assertion_, bool &seen_EOL_assertion_,
+        index_set_vector &set_mapping_)
     {
-        size_t_vector *lookup_ = internals_._lookup[state_];
         const typename rules::string_deque_deque &regexes_ =
             rules_.regexes ();
         const typename rules::id_vector_deque &ids_ = rules_.ids ();
@@ -169,13 +241,13 @@ protected:
 
         build_macros (token_map_, macrodeque_, macromap_,
             rules_.flags (), rules_.locale (), node_ptr_vector_,
-            internals_._seen_BOL_assertion, internals_._seen_EOL_assertion);
+            seen_BOL_assertion_, seen_EOL_assertion_);
 
         detail::node *root_ = parser::parse (regex_.c_str (),
             regex_.c_str () + regex_.size (), *ids_iter_, *unique_ids_iter_,
             *states_iter_, rules_.flags (), rules_.locale (), node_ptr_vector_,
-            macromap_, token_map_, internals_._seen_BOL_assertion,
-            internals_._seen_EOL_assertion);
+            macromap_, token_map_, seen_BOL_assertion_,
+            seen_EOL_assertion_);
 
         ++regex_iter_;
         ++ids_iter_;
@@ -193,8 +265,8 @@ protected:
                 regex2_.c_str () + regex2_.size (), *ids_iter_,
                 *unique_ids_iter_, *states_iter_, rules_.flags (),
                 rules_.locale (), node_ptr_vector_, macromap_, token_map_,
-                internals_._seen_BOL_assertion,
-                internals_._seen_EOL_assertion);
+                seen_BOL_assertion_,
+                seen_EOL_assertion_);
             tree_vector_.push_back (root_);
             ++regex_iter_;
             ++ids_iter_;
@@ -202,7 +274,7 @@ protected:
             ++states_iter_;
         }
 
-        if (internals_._seen_BOL_assertion)
+        if (seen_BOL_assertion_)
         {
             // Fixup BOLs
             typename detail::node::node_vector::iterator iter_ =
@@ -266,7 +338,7 @@ protected:
             }
         }
 
-        internals_._dfa_alphabet[state_] = token_list_->size () + dfa_offset;
+        dfa_alphabet_ = token_list_->size () + dfa_offset;
         return root_;
     }
 
@@ -747,6 +819,145 @@ protected:
         }
     }
 
+    // Finds the chains of states which can only be left through a single
+    // character each (and have no BOL or EOL transition), the states inside
+    // a chain not being end states either. The input has to match the whole
+    // chain to get to the state at its end, so the runtime can compare all
+    // of its characters at once (see literals.hpp).
+    static void build_literals (const size_t_vector &lookup_,
+        const std::size_t dfa_alphabet_, const size_t_vector &dfa_,
+        size_t_vector &literals_)
+    {
+        literals_.clear ();
+
+        if (dfa_alphabet_ == 0)
+        {
+            return;
+        }
+
+        const std::size_t states_ = dfa_.size () / dfa_alphabet_;
+        // the character of every column used by a single character only
+        size_t_vector column_char_ (dfa_alphabet_, npos);
+        size_t_vector column_count_ (dfa_alphabet_, 0);
+
+        for (std::size_t i_ = 0, size_ = lookup_.size (); i_ < size_; ++i_)
+        {
+            const std::size_t column_ = lookup_[i_];
+
+            if (column_ >= dfa_offset && ++column_count_[column_] == 1)
+            {
+                column_char_[column_] = i_;
+            }
+        }
+
+        for (std::size_t c_ = dfa_offset; c_ < dfa_alphabet_; ++c_)
+        {
+            if (column_count_[c_] != 1)
+            {
+                column_char_[c_] = npos;
+            }
+        }
+
+        // the single character leaving every state and where it leads to
+        size_t_vector char_ (states_, npos);
+        size_t_vector next_ (states_, npos);
+
+        for (std::size_t s_ = 1; s_ < states_; ++s_)
+        {
+            const std::size_t *ptr_ = &dfa_[s_ * dfa_alphabet_];
+            std::size_t column_ = 0;
+            std::size_t count_ = 0;
+
+            if (ptr_[bol_index] || ptr_[eol_index])
+            {
+                continue;
+            }
+
+            for (std::size_t c_ = dfa_offset; c_ < dfa_alphabet_ &&
+                count_ < 2; ++c_)
+            {
+                if (ptr_[c_])
+                {
+                    column_ = c_;
+                    ++count_;
+                }
+            }
+
+            if (count_ == 1 && column_char_[column_] != npos)
+            {
+                char_[s_] = column_char_[column_];
+                next_[s_] = ptr_[column_];
+            }
+        }
+
+        // the chains continue through the states which are not end states,
+        // and start in the states not inside a chain
+        std::vector<bool> inner_ (states_, false);
+        std::vector<bool> inside_ (states_, false);
+
+        for (std::size_t s_ = 1; s_ < states_; ++s_)
+        {
+            inner_[s_] = next_[s_] != npos &&
+                !dfa_[s_ * dfa_alphabet_ + end_state_index];
+        }
+
+        for (std::size_t s_ = 1; s_ < states_; ++s_)
+        {
+            if (next_[s_] != npos && inner_[next_[s_]])
+            {
+                inside_[next_[s_]] = true;
+            }
+        }
+
+        bool found_ = false;
+        size_t_vector path_;
+
+        literals_.resize (states_ * literal_size, 0);
+
+        for (std::size_t s_ = 1; s_ < states_; ++s_)
+        {
+            if (next_[s_] == npos || inside_[s_])
+            {
+                continue;
+            }
+
+            const std::size_t offset_ = literals_.size ();
+            std::size_t state_ = s_;
+
+            path_.clear ();
+
+            // the length check stops at cycles
+            do
+            {
+                path_.push_back (state_);
+                literals_.push_back (char_[state_]);
+                state_ = next_[state_];
+            } while (inner_[state_] && path_.size () < states_);
+
+            const std::size_t length_ = path_.size ();
+
+            // a suffix of the chain starts in every state on the way (which
+            // may have been reached through another chain already)
+            for (std::size_t i_ = 0; i_ + 1 < length_; ++i_)
+            {
+                std::size_t *chain_ = &literals_[path_[i_] * literal_size];
+
+                if (chain_[literal_length] == 0)
+                {
+                    chain_[literal_offset] = offset_ + i_;
+                    chain_[literal_length] = length_ - i_;
+                    chain_[literal_target] = state_;
+                    found_ = true;
+                }
+            }
+        }
+
+        if (!found_)
+        {
+            literals_.clear ();
+        }
+    }
+
     static void minimise_dfa (const std::size_t dfa_alphabet_,
         size_t_vector &dfa_, std::size_t size_)
     {
@@ -8,6 +8,7 @@
 
 #include "char_traits.hpp"
 #include <boost/detail/iterator.hpp>
+#include "literals.hpp"
 #include "size_t.hpp"
 #include "state_machine.hpp"
 
@@ -99,6 +100,15 @@ public:
         const basic_input *_input;
         data _data;
 
+        // the literal chains of the DFA of the given lexer state, if any
+        static const std::size_t *literals (const detail::internals &internals_,
+            const std::size_t index_)
+        {
+            return index_ < internals_._literals->size () &&
+                !internals_._literals[index_]->empty () ?
+                &internals_._literals[index_]->front () : 0;
+        }
+
         void next_token ()
         {
             const detail::internals &internals_ =
@@ -115,13 +125,15 @@ public:
                         (&internals_._lookup->front ()->front (),
                         internals_._dfa_alphabet.front (),
                         &internals_._dfa->front ()->front (),
+                        literals (internals_, 0),
                         _data.bol, _data.end, _input->_end, _data.unique_id);
                 }
                 else
                 {
                     _data.id = next (&internals_._lookup->front ()->front (),
                         internals_._dfa_alphabet.front (), &internals_.
-                        _dfa->front ()->front (), _data.end, _input->_end,
+                        _dfa->front ()->front (), literals (internals_, 0),
+                        _data.end, _input->_end,
                         _data.unique_id);
                 }
             }
@@ -144,6 +156,7 @@ public:
             {
                 // Ensure current state matches that returned by end().
                 _data.state = npos;
+                _data.bol = false;
             }
         }
 
@@ -163,7 +176,9 @@ public:
                 front ();
             std::size_t dfa_alphabet_ = internals_._dfa_alphabet[start_state_];
             const std::size_t *dfa_ = &internals_._dfa[start_state_]->front ();
+            const std::size_t *literals_ = literals (internals_, start_state_);
             const std::size_t *ptr_ = dfa_ + dfa_alphabet_;
+            std::size_t curr_state_ = 1;
             FwdIter curr_ = start_token_;
             bool end_state_ = *ptr_ != 0;
             std::size_t id_ = *(ptr_ + id_index);
@@ -179,12 +194,24 @@ public:
 
                 if (BOL_state_ && bol_)
                 {
+                    curr_state_ = BOL_state_;
                     ptr_ = &dfa_[BOL_state_ * dfa_alphabet_];
                 }
                 else if (EOL_state_ && *curr_ == '\n')
                 {
+                    curr_state_ = EOL_state_;
                     ptr_ = &dfa_[EOL_state_ * dfa_alphabet_];
                 }
+                else if (literals_ && detail::match_literal<Traits>
+                    (literals_, curr_state_, curr_, end_, bol_))
+                {
+                    if (curr_state_ == 0)
+                    {
+                        break;
+                    }
+
+                    ptr_ = &dfa_[curr_state_ * dfa_alphabet_];
+                }
                 else
                 {
                     typename Traits::char_type prev_char_ = *curr_++;
@@ -200,6 +227,7 @@ public:
                         break;
                     }
 
+                    curr_state_ = state_;
                     ptr_ = &dfa_[state_ * dfa_alphabet_];
                 }
 
@@ -275,7 +303,9 @@ public:
                 front ();
             std::size_t dfa_alphabet_ = internals_._dfa_alphabet[start_state_];
             const std::size_t *dfa_ = &internals_._dfa[start_state_]->front ();
+            const std::size_t *literals_ = literals (internals_, start_state_);
             const std::size_t *ptr_ = dfa_ + dfa_alphabet_;
+            std::size_t curr_state_ = 1;
             FwdIter curr_ = start_token_;
             bool end_state_ = *ptr_ != 0;
             std::size_t id_ = *(ptr_ + id_index);
@@ -285,15 +315,29 @@ public:
 
             while (curr_ != end_)
             {
-                const std::size_t state_ = ptr_[lookup_[static_cast
-                    <typename Traits::index_type>(*curr_++)]];
-
-                if (state_ == 0)
+                if (literals_ && detail::match_literal<Traits>
+                    (literals_, curr_state_, curr_, end_))
                 {
-                    break;
+                    if (curr_state_ == 0)
+                    {
+                        break;
+                    }
+
+                    ptr_ = &dfa_[curr_state_ * dfa_alphabet_];
                 }
+                else
+                {
+                    const std::size_t state_ = ptr_[lookup_[static_cast
+                        <typename Traits::index_type>(*curr_++)]];
 
-                ptr_ = &dfa_[state_ * dfa_alphabet_];
+                    if (state_ == 0)
+                    {
+                        break;
+                    }
+
+                    curr_state_ = state_;
+                    ptr_ = &dfa_[state_ * dfa_alphabet_];
+                }
 
                 if (*ptr_)
                 {
@@ -327,6 +371,7 @@ public:
 
         std::size_t next (const std::size_t * const lookup_,
             const std::size_t dfa_alphabet_, const std::size_t * const dfa_,
+            const std::size_t * const literals_,
             bool bol_, FwdIter &start_token_, FwdIter const &end_,
             std::size_t &unique_id_)
         {
@@ -337,6 +382,7 @@ public:
             }
 
             const std::size_t *ptr_ = dfa_ + dfa_alphabet_;
+            std::size_t curr_state_ = 1;
             FwdIter curr_ = start_token_;
             bool end_state_ = *ptr_ != 0;
             std::size_t id_ = *(ptr_ + id_index);
@@ -351,12 +397,24 @@ public:
 
                 if (BOL_state_ && bol_)
                 {
+                    curr_state_ = BOL_state_;
                     ptr_ = &dfa_[BOL_state_ * dfa_alphabet_];
                 }
                 else if (EOL_state_ && *curr_ == '\n')
                 {
+                    curr_state_ = EOL_state_;
                     ptr_ = &dfa_[EOL_state_ * dfa_alphabet_];
                 }
+                else if (literals_ && detail::match_literal<Traits>
+                    (literals_, curr_state_, curr_, end_, bol_))
+                {
+                    if (curr_state_ == 0)
+                    {
+                        break;
+                    }
+
+                    ptr_ = &dfa_[curr_state_ * dfa_alphabet_];
+                }
                 else
                 {
                     typename Traits::char_type prev_char_ = *curr_++;
@@ -372,6 +430,7 @@ public:
                         break;
                     }
 
+                    curr_state_ = state_;
                     ptr_ = &dfa_[state_ * dfa_alphabet_];
                 }
 
@@ -422,6 +481,7 @@ public:
 
         std::size_t next (const std::size_t * const lookup_,
             const std::size_t dfa_alphabet_, const std::size_t * const dfa_,
+            const std::size_t * const literals_,
             FwdIter &start_token_, FwdIter const &end_,
             std::size_t &unique_id_)
         {
@@ -432,6 +492,7 @@ public:
             }
 
             const std::size_t *ptr_ = dfa_ + dfa_alphabet_;
+            std::size_t curr_state_ = 1;
             FwdIter curr_ = start_token_;
             bool end_state_ = *ptr_ != 0;
             std::size_t id_ = *(ptr_ + id_index);
@@ -440,15 +501,29 @@ public:
 
             while (curr_ != end_)
             {
-                const std::size_t state_ = ptr_[lookup_[static_cast
-                    <typename Traits::index_type>(*curr_++)]];
-
-                if (state_ == 0)
+                if (literals_ && detail::match_literal<Traits>
+                    (literals_, curr_state_, curr_, end_))
                 {
-                    break;
+                    if (curr_state_ == 0)
+                    {
+                        break;
+                    }
+
+                    ptr_ = &dfa_[curr_state_ * dfa_alphabet_];
                 }
+                else
+                {
+                    const std::size_t state_ = ptr_[lookup_[static_cast
+                        <typename Traits::index_type>(*curr_++)]];
+
+                    if (state_ == 0)
+                    {
+                        break;
+                    }
 
-                ptr_ = &dfa_[state_ * dfa_alphabet_];
+                    curr_state_ = state_;
+                    ptr_ = &dfa_[state_ * dfa_alphabet_];
+                }
 
                 if (*ptr_)
                 {
@@ -22,6 +22,8 @@ struct internals
     size_t_vector_vector _lookup;
     size_t_vector _dfa_alphabet;
     size_t_vector_vector _dfa;
+    // the literal chains of every DFA (see literals.hpp)
+    size_t_vector_vector _literals;
     bool _seen_BOL_assertion;
     bool _seen_EOL_assertion;
 
@@ -36,6 +38,7 @@ struct internals
         _lookup.clear ();
         _dfa_alphabet.clear ();
         _dfa.clear ();
+        _literals.clear ();
         _seen_BOL_assertion = false;
         _seen_EOL_assertion = false;
     }
@@ -45,6 +48,7 @@ struct internals
         _lookup->swap (*internals_._lookup);
         _dfa_alphabet.swap (internals_._dfa_alphabet);
         _dfa->swap (*internals_._dfa);
+        _literals->swap (*internals_._literals);
         std::swap (_seen_BOL_assertion, internals_._seen_BOL_assertion);
         std::swap (_seen_EOL_assertion, internals_._seen_EOL_assertion);
     }
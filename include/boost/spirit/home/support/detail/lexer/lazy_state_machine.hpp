@@ -0,0 +1,327 @@
+// lazy_state_machine.hpp
+// Copyright (c) 2007-2009 Ben Hanson (http://www.benhanson.net/)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file licence_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_LEXER_LAZY_STATE_MACHINE_HPP
+#define BOOST_LEXER_LAZY_STATE_MACHINE_HPP
+
+#include "generator.hpp"
+#include <vector>
+
+namespace boost
+{
+namespace lexer
+{
+// A state machine whose DFA states are only built when they are first
+// reached while tokenising. The syntax trees of the rules are kept, and
+// each DFA state is the set of tree positions it stands for (as in
+// basic_generator::build ()), so that the transitions of a state can be
+// built at any time.
+//
+// At most max_states_ DFA states are kept per lexer state: when building
+// the transitions of a state could exceed that, all the states but the
+// start state and the one being built are dropped, which renumbers the
+// latter. The tables are in the same format as those of a
+// basic_state_machine, except for the rows not built yet.
+//
+// A lazy state machine is modified while it is used, so it must not be
+// used by several threads at the same time.
+template<typename CharT, typename Traits = char_traits<CharT> >
+class basic_lazy_state_machine : private basic_generator<CharT, Traits>
+{
+public:
+    typedef basic_rules<CharT> rules;
+    typedef typename detail::internals::size_t_vector size_t_vector;
+
+    basic_lazy_state_machine (const std::size_t max_states_ = 4096) :
+        _max_states (max_states_),
+        _flushes (0)
+    {
+    }
+
+    void build (const rules &rules_)
+    {
+        std::size_t index_ = 0;
+        std::size_t size_ = rules_.statemap ().size ();
+        detail::internals &internals_ = const_cast<detail::internals &>
+            (_sm.data ());
+        bool seen_BOL_assertion_ = false;
+        bool seen_EOL_assertion_ = false;
+
+        clear ();
+
+        for (; index_ < size_; ++index_)
+        {
+            internals_._lookup->push_back (static_cast<size_t_vector *>(0));
+            internals_._lookup->back () = new size_t_vector;
+            internals_._lookup->back ()->resize (sizeof (CharT) == 1 ?
+                num_chars : num_wchar_ts, dead_state_index);
+            internals_._dfa_alphabet.push_back (0);
+            internals_._dfa->push_back (static_cast<size_t_vector *>(0));
+            internals_._dfa->back () = new size_t_vector;
+            _dfas->push_back (static_cast<lazy_dfa *>(0));
+            _dfas->back () = new lazy_dfa;
+
+            lazy_dfa &dfa_ = *_dfas[index_];
+
+            if (rules_.regexes ()[index_].empty ())
+            {
+                // jam state and a start state without any transitions
+                internals_._dfa_alphabet[index_] = dfa_offset;
+                internals_._dfa[index_]->resize (2 * dfa_offset, 0);
+                dfa_._built.resize (2, true);
+                continue;
+            }
+
+            bool seen_BOL_ = false;
+            bool seen_EOL_ = false;
+
+            dfa_._root = base::build_tree (rules_, index_, _node_ptr_vector,
+                internals_._lookup[index_], internals_._dfa_alphabet[index_],
+                seen_BOL_, seen_EOL_, dfa_._set_mapping);
+            start (index_);
+            seen_BOL_assertion_ = seen_BOL_assertion_ || seen_BOL_;
+            seen_EOL_assertion_ = seen_EOL_assertion_ || seen_EOL_;
+        }
+
+        internals_._seen_BOL_assertion = seen_BOL_assertion_;
+        internals_._seen_EOL_assertion = seen_EOL_assertion_;
+    }
+
+    void clear ()
+    {
+        _sm.clear ();
+        _dfas.clear ();
+        _node_ptr_vector.clear ();
+        _flushes = 0;
+    }
+
+    bool empty () const
+    {
+        return _dfas->empty ();
+    }
+
+    // Number of lexer states
+    std::size_t size () const
+    {
+        return _dfas->size ();
+    }
+
+    std::size_t max_states () const
+    {
+        return _max_states;
+    }
+
+    void max_states (const std::size_t max_states_)
+    {
+        _max_states = max_states_;
+    }
+
+    // Number of DFA states built so far (including the jam state)
+    std::size_t states (const std::size_t dfa_) const
+    {
+        return _dfas[dfa_]->_built.size ();
+    }
+
+    // Number of times states were dropped
+    std::size_t flushes () const
+    {
+        return _flushes;
+    }
+
+    bool seen_BOL_assertion () const
+    {
+        return _sm.data ()._seen_BOL_assertion;
+    }
+
+    bool seen_EOL_assertion () const
+    {
+        return _sm.data ()._seen_EOL_assertion;
+    }
+
+    const std::size_t *lookup (const std::size_t dfa_) const
+    {
+        return &_sm.data ()._lookup[dfa_]->front ();
+    }
+
+    std::size_t dfa_alphabet (const std::size_t dfa_) const
+    {
+        return _sm.data ()._dfa_alphabet[dfa_];
+    }
+
+    // The row of the given DFA state, with its transitions built. This may
+    // renumber state_, and invalidates the rows returned before.
+    const std::size_t *row (const std::size_t dfa_, std::size_t &state_)
+    {
+        if (!_dfas[dfa_]->_built[state_])
+        {
+            build_state (dfa_, state_);
+        }
+
+        return &_sm.data ()._dfa[dfa_]->front () +
+            state_ * _sm.data ()._dfa_alphabet[dfa_];
+    }
+
+private:
+    typedef basic_generator<CharT, Traits> base;
+    typedef typename base::node_ptr_vector node_ptr_vector;
+    typedef typename base::index_set_vector index_set_vector;
+    typedef typename base::node_set_vector node_set_vector;
+    typedef typename base::node_vector node_vector;
+    typedef typename base::node_vector_vector node_vector_vector;
+    typedef typename base::equivset equivset;
+    typedef typename base::equivset_list equivset_list;
+
+    struct lazy_dfa
+    {
+        // syntax tree
+        detail::node *_root;
+        // vector mapping token indexes to partitioned token index sets
+        index_set_vector _set_mapping;
+        // the tree positions of each DFA state but the jam state
+        node_set_vector _seen_sets;
+        node_vector_vector _seen_vectors;
+        size_t_vector _hash_vector;
+        // whether the transitions of each DFA state are built
+        std::vector<bool> _built;
+
+        lazy_dfa () :
+            _root (0)
+        {
+        }
+    };
+
+    basic_state_machine<CharT> _sm;
+    detail::ptr_vector<lazy_dfa> _dfas;
+    node_ptr_vector _node_ptr_vector;
+    std::size_t _max_states;
+    std::size_t _flushes;
+
+    // Drop all DFA states and add the jam and start states.
+    void start (const std::size_t index_)
+    {
+        lazy_dfa &dfa_ = *_dfas[index_];
+        detail::internals &internals_ = const_cast<detail::internals &>
+            (_sm.data ());
+        const std::size_t dfa_alphabet_ = internals_._dfa_alphabet[index_];
+        size_t_vector &table_ = *internals_._dfa[index_];
+
+        dfa_._seen_sets.clear ();
+        dfa_._seen_vectors.clear ();
+        dfa_._hash_vector.clear ();
+        table_.assign (dfa_alphabet_, 0);
+        base::closure (&dfa_._root->firstpos (), dfa_._seen_sets,
+            dfa_._seen_vectors, dfa_._hash_vector, dfa_alphabet_, table_);
+        dfa_._built.assign (2, false);
+        // 'jam' state
+        dfa_._built[0] = true;
+    }
+
+    // Drop all DFA states but the start state and state_, which gets
+    // renumbered.
+    void flush (const std::size_t index_, std::size_t &state_)
+    {
+        lazy_dfa &dfa_ = *_dfas[index_];
+        typename detail::node::node_vector positions_;
+
+        for (typename node_vector::const_iterator iter_ =
+            dfa_._seen_vectors[state_ - 1]->begin (),
+            end_ = dfa_._seen_vectors[state_ - 1]->end ();
+            iter_ != end_; ++iter_)
+        {
+            positions_.push_back (const_cast<detail::node *>(*iter_));
+        }
+
+        start (index_);
+
+        detail::internals &internals_ = const_cast<detail::internals &>
+            (_sm.data ());
+
+        state_ = base::closure (&positions_, dfa_._seen_sets,
+            dfa_._seen_vectors, dfa_._hash_vector,
+            internals_._dfa_alphabet[index_], *internals_._dfa[index_]);
+        dfa_._built.resize (dfa_._seen_sets->size () + 1, false);
+        ++_flushes;
+    }
+
+    // The same as basic_generator::build_dfa () for a single DFA state.
+    void build_state (const std::size_t index_, std::size_t &state_)
+    {
+        lazy_dfa &dfa_ = *_dfas[index_];
+        detail::internals &internals_ = const_cast<detail::internals &>
+            (_sm.data ());
+        const std::size_t dfa_alphabet_ = internals_._dfa_alphabet[index_];
+        size_t_vector &table_ = *internals_._dfa[index_];
+
+        // A state has at most one transition per column, each of which may
+        // add a state.
+        if (dfa_._built.size () > 3 &&
+            dfa_._built.size () + dfa_alphabet_ > _max_states)
+        {
+            flush (index_, state_);
+        }
+
+        equivset_list equiv_list_;
+
+        base::build_equiv_list (dfa_._seen_vectors[state_ - 1],
+            dfa_._set_mapping, equiv_list_);
+
+        for (typename equivset_list::list::const_iterator iter_ =
+            equiv_list_->begin (), end_ = equiv_list_->end ();
+            iter_ != end_; ++iter_)
+        {
+            equivset *equivset_ = *iter_;
+            const std::size_t transition_ = base::closure
+                (&equivset_->_followpos, dfa_._seen_sets,
+                dfa_._seen_vectors, dfa_._hash_vector, dfa_alphabet_,
+                table_);
+
+            if (transition_ != npos)
+            {
+                std::size_t *ptr_ = &table_.front () +
+                    state_ * dfa_alphabet_;
+
+                // Prune abstemious transitions from end states.
+                if (*ptr_ && !equivset_->_greedy) continue;
+
+                for (typename detail::equivset::index_vector::const_iterator
+                    equiv_iter_ = equivset_->_index_vector.begin (),
+                    equiv_end_ = equivset_->_index_vector.end ();
+                    equiv_iter_ != equiv_end_; ++equiv_iter_)
+                {
+                    const std::size_t equiv_index_ = *equiv_iter_;
+
+                    if (equiv_index_ == bol_token)
+                    {
+                        if (ptr_[eol_index] == 0)
+                        {
+                            ptr_[bol_index] = transition_;
+                        }
+                    }
+                    else if (equiv_index_ == eol_token)
+                    {
+                        if (ptr_[bol_index] == 0)
+                        {
+                            ptr_[eol_index] = transition_;
+                        }
+                    }
+                    else
+                    {
+                        ptr_[equiv_index_ + dfa_offset] = transition_;
+                    }
+                }
+            }
+        }
+
+        dfa_._built.resize (dfa_._seen_sets->size () + 1, false);
+        dfa_._built[state_] = true;
+    }
+};
+
+typedef basic_lazy_state_machine<char> lazy_state_machine;
+typedef basic_lazy_state_machine<wchar_t> wlazy_state_machine;
+}
+}
+
+#endif
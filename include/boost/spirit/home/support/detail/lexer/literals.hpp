@@ -0,0 +1,117 @@
+// literals.hpp
+// Copyright (c) 2007-2009 Ben Hanson (http://www.benhanson.net/)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file licence_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_LEXER_LITERALS_HPP
+#define BOOST_LEXER_LITERALS_HPP
+
+#include <iterator>
+#include "size_t.hpp"
+
+namespace boost
+{
+namespace lexer
+{
+// The literal chains of a DFA (see basic_generator::build_literals) are
+// stored as literal_size entries per state (the offset of the characters of
+// the chain starting in that state, their number, and the state the chain
+// leads to), followed by the characters. A length of 0 means no chain
+// starts in the state. A DFA without any chains has no entries at all.
+enum {literal_offset, literal_length, literal_target, literal_size};
+
+namespace detail
+{
+template<typename Traits, typename FwdIter>
+bool equal_literal (const std::size_t *first_, const std::size_t *last_,
+    FwdIter &curr_, const FwdIter &end_, std::input_iterator_tag)
+{
+    FwdIter iter_ = curr_;
+
+    for (; first_ != last_; ++first_, ++iter_)
+    {
+        if (iter_ == end_ ||
+            static_cast<std::size_t>(Traits::call (*iter_)) != *first_)
+        {
+            return false;
+        }
+    }
+
+    curr_ = iter_;
+    return true;
+}
+
+// One bounds check for the whole literal.
+template<typename Traits, typename FwdIter>
+bool equal_literal (const std::size_t *first_, const std::size_t *last_,
+    FwdIter &curr_, const FwdIter &end_, std::random_access_iterator_tag)
+{
+    if (static_cast<std::size_t>(end_ - curr_) <
+        static_cast<std::size_t>(last_ - first_))
+    {
+        return false;
+    }
+
+    FwdIter iter_ = curr_;
+
+    for (; first_ != last_; ++first_, ++iter_)
+    {
+        if (static_cast<std::size_t>(Traits::call (*iter_)) != *first_)
+        {
+            return false;
+        }
+    }
+
+    curr_ = iter_;
+    return true;
+}
+
+// Returns false if no chain starts in state_. Otherwise state_ is set to
+// the state the chain leads to and curr_ is moved past the chain if the
+// input matches it, else state_ is set to 0 (the DFA would have stopped
+// inside the chain without reaching an end state).
+template<typename Traits, typename FwdIter>
+bool match_literal (const std::size_t *literals_, std::size_t &state_,
+    FwdIter &curr_, const FwdIter &end_)
+{
+    const std::size_t *chain_ = literals_ + state_ * literal_size;
+
+    if (chain_[literal_length] == 0)
+    {
+        return false;
+    }
+
+    const std::size_t *first_ = literals_ + chain_[literal_offset];
+    typedef typename std::iterator_traits<FwdIter>::iterator_category
+        category;
+
+    state_ = equal_literal<Traits> (first_, first_ + chain_[literal_length],
+        curr_, end_, category ()) ? chain_[literal_target] : 0;
+    return true;
+}
+
+// The same, also setting bol_ as stepping through the chain would.
+template<typename Traits, typename FwdIter>
+bool match_literal (const std::size_t *literals_, std::size_t &state_,
+    FwdIter &curr_, const FwdIter &end_, bool &bol_)
+{
+    const std::size_t *chain_ = literals_ + state_ * literal_size;
+
+    if (!match_literal<Traits> (literals_, state_, curr_, end_))
+    {
+        return false;
+    }
+
+    if (state_ != 0)
+    {
+        bol_ = literals_[chain_[literal_offset] +
+            chain_[literal_length] - 1] == '\n';
+    }
+
+    return true;
+}
+}
+}
+}
+
+#endif
@@ -0,0 +1,135 @@
+// parallel_for.hpp
+// Copyright (c) 2007-2009 Ben Hanson (http://www.benhanson.net/)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file licence_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_LEXER_PARALLEL_FOR_HPP
+#define BOOST_LEXER_PARALLEL_FOR_HPP
+
+#include <boost/config.hpp>
+#include "size_t.hpp"
+
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_LEXER_NO_THREADS) && \
+    !defined(BOOST_NO_CXX11_HDR_THREAD) && \
+    !defined(BOOST_NO_CXX11_HDR_ATOMIC) && \
+    !defined(BOOST_NO_CXX11_HDR_EXCEPTION)
+#define BOOST_LEXER_HAS_THREADS
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+#endif
+
+namespace boost
+{
+namespace lexer
+{
+namespace detail
+{
+#if defined(BOOST_LEXER_HAS_THREADS)
+template<typename F>
+struct parallel_for_worker
+{
+    F &_f;
+    std::atomic<std::size_t> &_next;
+    std::vector<std::exception_ptr> &_errors;
+
+    parallel_for_worker (F &f_, std::atomic<std::size_t> &next_,
+        std::vector<std::exception_ptr> &errors_) :
+        _f (f_),
+        _next (next_),
+        _errors (errors_)
+    {
+    }
+
+    void operator () () const
+    {
+        const std::size_t count_ = _errors.size ();
+
+        for (std::size_t index_ = _next++; index_ < count_;
+            index_ = _next++)
+        {
+            try
+            {
+                _f (index_);
+            }
+            catch (...)
+            {
+                _errors[index_] = std::current_exception ();
+            }
+        }
+    }
+};
+#endif
+
+// Calls f_ (0) ... f_ (count_ - 1) on up to threads_ threads (one per core
+// if 0), in no particular order. If any of the calls throw, the exception
+// of the lowest index is rethrown once all calls are done. Without thread
+// support the calls are made in order on the calling thread.
+template<typename F>
+void parallel_for (const std::size_t count_, std::size_t threads_, F &f_)
+{
+#if defined(BOOST_LEXER_HAS_THREADS)
+    if (threads_ == 0)
+    {
+        threads_ = std::thread::hardware_concurrency ();
+    }
+
+    if (threads_ > count_)
+    {
+        threads_ = count_;
+    }
+
+    if (threads_ > 1)
+    {
+        std::atomic<std::size_t> next_ (0);
+        std::vector<std::exception_ptr> errors_ (count_);
+        parallel_for_worker<F> worker_ (f_, next_, errors_);
+        std::vector<std::thread> pool_;
+
+        pool_.reserve (threads_ - 1);
+
+        for (std::size_t i_ = 1; i_ < threads_; ++i_)
+        {
+            try
+            {
+                pool_.push_back (std::thread (worker_));
+            }
+            catch (...)
+            {
+                // Make do with the threads started so far.
+                break;
+            }
+        }
+
+        worker_ ();
+
+        for (std::size_t i_ = 0; i_ < pool_.size (); ++i_)
+        {
+            pool_[i_].join ();
+        }
+
+        for (std::size_t i_ = 0; i_ < count_; ++i_)
+        {
+            if (errors_[i_])
+            {
+                std::rethrow_exception (errors_[i_]);
+            }
+        }
+
+        return;
+    }
+#else
+    (void) threads_;
+#endif
+
+    for (std::size_t index_ = 0; index_ < count_; ++index_)
+    {
+        f_ (index_);
+    }
+}
+}
+}
+}
+
+#endif
@@ -15,6 +15,7 @@
 #include "tree/sequence_node.hpp"
 #include "../size_t.hpp"
 #include "tokeniser/re_tokeniser.hpp"
+#include "utf8_regex.hpp"
 
 namespace boost
 {
@@ -57,6 +58,21 @@ Grammar:
         const macro_map &macromap_, typename tokeniser::token_map &map_,
         bool &seen_BOL_assertion_, bool &seen_EOL_assertion_)
     {
+        string utf8_regex_;
+
+        if ((flags_ & utf8) &&
+            rewrite_utf8 (start_, end_, flags_, locale_, utf8_regex_))
+        {
+            // The rewritten regex matches bytes, any case folding has
+            // been done already.
+            return parse (utf8_regex_.c_str (),
+                utf8_regex_.c_str () + utf8_regex_.size (), id_,
+                unique_id_, dfa_state_,
+                static_cast<regex_flags> (flags_ & ~(utf8 | icase)), locale_,
+                node_ptr_vector_, macromap_, map_, seen_BOL_assertion_,
+                seen_EOL_assertion_);
+        }
+
         node *root_ = 0;
         state state_ (start_, end_, flags_, locale_);
         token lhs_token_;
@@ -139,6 +155,21 @@ private:
     typedef std::stack<token> token_stack;
     typedef node::node_stack tree_node_stack;
 
+    // Only char based rules can be compiled for UTF-8 input.
+    static bool rewrite_utf8 (const char *start_, const char * const end_,
+        const regex_flags flags_, const std::locale &locale_,
+        std::string &regex_)
+    {
+        regex_ = utf8_regex::rewrite (start_, end_, flags_, locale_);
+        return true;
+    }
+
+    static bool rewrite_utf8 (const wchar_t *, const wchar_t * const,
+        const regex_flags, const std::locale &, std::wstring &)
+    {
+        return false;
+    }
+
     static void reduce (token_stack &token_stack_,
         const macro_map &macromap_, node_ptr_vector &node_vector_ptr_,
         tree_node_stack &tree_node_stack_)
@@ -0,0 +1,534 @@
+// utf8_regex.hpp
+// Copyright (c) 2007-2009 Ben Hanson (http://www.benhanson.net/)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file licence_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#ifndef BOOST_LEXER_UTF8_REGEX_HPP
+#define BOOST_LEXER_UTF8_REGEX_HPP
+
+#include <algorithm>
+#include <boost/cstdint.hpp>
+#include <boost/integer_traits.hpp>
+#include "../consts.hpp"
+#include "../runtime_error.hpp"
+#include "../size_t.hpp"
+#include <sstream>
+#include <string>
+#include "tokeniser/re_tokeniser.hpp"
+#include <utility>
+#include <vector>
+
+namespace boost
+{
+namespace lexer
+{
+namespace detail
+{
+// With the utf8 flag, the regexes of char based rules are written over
+// Unicode code points (and encoded as UTF-8). rewrite () turns such a regex
+// into the equivalent regex over the bytes of the UTF-8 encoding of the
+// matched text, so that the DFA runs directly on UTF-8 input using the
+// usual 256 entry lookup tables:
+//
+//   - literal code points become the sequence of their UTF-8 bytes,
+//   - charsets (including '.' and negated charsets) become an alternation
+//     of byte range sequences matching exactly the UTF-8 encoding of the
+//     code points in the charset (surrogates are never matched),
+//   - \xhhhh escapes denote code points.
+//
+// The regex is tokenised as a wchar_t regex, so case insensitive matching
+// uses the ctype<wchar_t> facet of the rules locale. On platforms with a 16
+// bit wchar_t, code points outside the BMP can only be matched by negated
+// charsets (and '.').
+class utf8_regex
+{
+public:
+    typedef std::string string;
+
+    static string rewrite (const char *start_, const char * const end_,
+        const regex_flags flags_, const std::locale &locale_)
+    {
+        const std::wstring wregex_ = decode (start_, end_);
+        wtokeniser::state state_ (wregex_.c_str (),
+            wregex_.c_str () + wregex_.size (), flags_, locale_);
+        wtokeniser::token_map map_;
+        std::vector<const wstring_token *> charsets_;
+        wtokeniser::num_token token_;
+        string regex_;
+
+        for (;;)
+        {
+            wtokeniser::next (state_, map_, token_);
+
+            switch (token_._type)
+            {
+            case wtokeniser::num_token::END:
+                return regex_;
+            case wtokeniser::num_token::CHARSET:
+                if (token_._id == bol_token)
+                {
+                    regex_ += '^';
+                }
+                else if (token_._id == eol_token)
+                {
+                    regex_ += '$';
+                }
+                else
+                {
+                    if (charsets_.size () != map_.size ())
+                    {
+                        index_charsets (map_, charsets_);
+                    }
+
+                    charset (*charsets_[token_._id], regex_);
+                }
+
+                break;
+            case wtokeniser::num_token::MACRO:
+            {
+                regex_ += '{';
+
+                for (const wchar_t *name_ = token_._macro; *name_; ++name_)
+                {
+                    regex_ += static_cast<char> (*name_);
+                }
+
+                regex_ += '}';
+                break;
+            }
+            case wtokeniser::num_token::REPEATN:
+            case wtokeniser::num_token::AREPEATN:
+            {
+                std::ostringstream ss_;
+
+                ss_ << '{' << token_._min;
+
+                if (token_._comma)
+                {
+                    ss_ << ',';
+
+                    if (token_._max)
+                    {
+                        ss_ << token_._max;
+                    }
+                }
+
+                ss_ << '}';
+
+                if (token_._type == wtokeniser::num_token::AREPEATN)
+                {
+                    ss_ << '?';
+                }
+
+                regex_ += ss_.str ();
+                break;
+            }
+            case wtokeniser::num_token::OPENPAREN:
+                regex_ += '(';
+                break;
+            case wtokeniser::num_token::CLOSEPAREN:
+                regex_ += ')';
+                break;
+            case wtokeniser::num_token::OR:
+                regex_ += '|';
+                break;
+            case wtokeniser::num_token::OPT:
+                regex_ += '?';
+                break;
+            case wtokeniser::num_token::AOPT:
+                regex_ += "??";
+                break;
+            case wtokeniser::num_token::ZEROORMORE:
+                regex_ += '*';
+                break;
+            case wtokeniser::num_token::AZEROORMORE:
+                regex_ += "*?";
+                break;
+            case wtokeniser::num_token::ONEORMORE:
+                regex_ += '+';
+                break;
+            case wtokeniser::num_token::AONEORMORE:
+                regex_ += "+?";
+                break;
+            default:
+                throw runtime_error ("Internal error utf8_regex::rewrite");
+                break;
+            }
+        }
+    }
+
+    typedef std::pair<boost::uint32_t, boost::uint32_t> range;
+    typedef std::vector<range> range_vector;
+    typedef std::pair<unsigned char, unsigned char> byte_range;
+    typedef std::vector<byte_range> sequence;
+    typedef std::vector<sequence> sequence_vector;
+
+    // Append the sequences of byte ranges matching exactly the UTF-8
+    // encoding of the code points first_ to last_ (which must not contain
+    // surrogates).
+    static void sequences (const boost::uint32_t first_,
+        const boost::uint32_t last_, sequence_vector &sequences_)
+    {
+        static const boost::uint32_t max_[] = {0x7f, 0x7ff, 0xffff};
+
+        // split at the boundaries of the encoded length
+        for (std::size_t i_ = 0; i_ < 3; ++i_)
+        {
+            if (first_ <= max_[i_] && last_ > max_[i_])
+            {
+                sequences (first_, max_[i_], sequences_);
+                sequences (max_[i_] + 1, last_, sequences_);
+                return;
+            }
+        }
+
+        const std::size_t length_ = encoded_length (first_);
+
+        // split until every byte of the encoding covers a range on its own
+        for (std::size_t i_ = 1; i_ < length_; ++i_)
+        {
+            const boost::uint32_t mask_ = (1u << (6 * i_)) - 1;
+
+            if ((first_ & ~mask_) != (last_ & ~mask_))
+            {
+                if ((first_ & mask_) != 0)
+                {
+                    sequences (first_, first_ | mask_, sequences_);
+                    sequences ((first_ | mask_) + 1, last_, sequences_);
+                    return;
+                }
+
+                if ((last_ & mask_) != mask_)
+                {
+                    sequences (first_, (last_ & ~mask_) - 1, sequences_);
+                    sequences (last_ & ~mask_, last_, sequences_);
+                    return;
+                }
+            }
+        }
+
+        unsigned char lo_[4];
+        unsigned char hi_[4];
+
+        encode (first_, lo_);
+        encode (last_, hi_);
+        sequences_.push_back (sequence ());
+
+        for (std::size_t i_ = 0; i_ < length_; ++i_)
+        {
+            sequences_.back ().push_back (byte_range (lo_[i_], hi_[i_]));
+        }
+    }
+
+    static std::size_t encoded_length (const boost::uint32_t cp_)
+    {
+        return cp_ < 0x80 ? 1 : cp_ < 0x800 ? 2 : cp_ < 0x10000 ? 3 : 4;
+    }
+
+    static void encode (const boost::uint32_t cp_, unsigned char *out_)
+    {
+        switch (encoded_length (cp_))
+        {
+        case 1:
+            out_[0] = static_cast<unsigned char> (cp_);
+            break;
+        case 2:
+            out_[0] = static_cast<unsigned char> (0xc0 | (cp_ >> 6));
+            out_[1] = static_cast<unsigned char> (0x80 | (cp_ & 0x3f));
+            break;
+        case 3:
+            out_[0] = static_cast<unsigned char> (0xe0 | (cp_ >> 12));
+            out_[1] = static_cast<unsigned char> (0x80 | ((cp_ >> 6) & 0x3f));
+            out_[2] = static_cast<unsigned char> (0x80 | (cp_ & 0x3f));
+            break;
+        default:
+            out_[0] = static_cast<unsigned char> (0xf0 | (cp_ >> 18));
+            out_[1] = static_cast<unsigned char> (0x80 | ((cp_ >> 12) & 0x3f));
+            out_[2] = static_cast<unsigned char> (0x80 | ((cp_ >> 6) & 0x3f));
+            out_[3] = static_cast<unsigned char> (0x80 | (cp_ & 0x3f));
+            break;
+        }
+    }
+
+private:
+    typedef basic_re_tokeniser<wchar_t> wtokeniser;
+    typedef wtokeniser::string_token wstring_token;
+
+    enum {max_code_point = 0x10ffff};
+
+    // Decode the UTF-8 encoded regex, rejecting overlong encodings,
+    // surrogates and code points beyond U+10FFFF.
+    static std::wstring decode (const char *start_, const char * const end_)
+    {
+        const char * const begin_ = start_;
+        std::wstring wregex_;
+
+        wregex_.reserve (end_ - start_);
+
+        while (start_ < end_)
+        {
+            const unsigned char ch_ = static_cast<unsigned char> (*start_);
+            std::size_t length_ = 0;
+            boost::uint32_t cp_ = 0;
+
+            if (ch_ < 0x80)
+            {
+                length_ = 1;
+                cp_ = ch_;
+            }
+            else if (ch_ >= 0xc2 && ch_ <= 0xdf)
+            {
+                length_ = 2;
+                cp_ = ch_ & 0x1f;
+            }
+            else if (ch_ >= 0xe0 && ch_ <= 0xef)
+            {
+                length_ = 3;
+                cp_ = ch_ & 0x0f;
+            }
+            else if (ch_ >= 0xf0 && ch_ <= 0xf4)
+            {
+                length_ = 4;
+                cp_ = ch_ & 0x07;
+            }
+
+            bool valid_ = length_ != 0 &&
+                static_cast<std::size_t> (end_ - start_) >= length_;
+
+            for (std::size_t i_ = 1; valid_ && i_ < length_; ++i_)
+            {
+                const unsigned char next_ =
+                    static_cast<unsigned char> (start_[i_]);
+
+                valid_ = (next_ & 0xc0) == 0x80;
+                cp_ = (cp_ << 6) | (next_ & 0x3f);
+            }
+
+            if (!valid_ || encoded_length (cp_) != length_ ||
+                (cp_ >= 0xd800 && cp_ <= 0xdfff) ||
+                cp_ > static_cast<boost::uint32_t> (max_code_point) ||
+                cp_ > static_cast<boost::uint32_t>
+                    (boost::integer_traits<wchar_t>::const_max))
+            {
+                std::ostringstream ss_;
+
+                ss_ << "Invalid UTF-8 sequence at index " <<
+                    start_ - begin_ << '.';
+                throw runtime_error (ss_.str ().c_str ());
+            }
+
+            wregex_ += static_cast<wchar_t> (cp_);
+            start_ += length_;
+        }
+
+        return wregex_;
+    }
+
+    static void index_charsets (const wtokeniser::token_map &map_,
+        std::vector<const wstring_token *> &charsets_)
+    {
+        charsets_.resize (map_.size ());
+
+        for (wtokeniser::token_map::const_iterator iter_ = map_.begin (),
+            end_ = map_.end (); iter_ != end_; ++iter_)
+        {
+            charsets_[iter_->second] = &iter_->first;
+        }
+    }
+
+    // The code point ranges of the charset, excluding surrogates.
+    static void ranges (const wstring_token &token_, range_vector &ranges_)
+    {
+        std::vector<boost::uint32_t> chars_;
+
+        chars_.reserve (token_._charset.size ());
+
+        for (std::wstring::const_iterator iter_ = token_._charset.begin (),
+            end_ = token_._charset.end (); iter_ != end_; ++iter_)
+        {
+            // wchar_t may be signed
+            if (*iter_ >= 0 &&
+                static_cast<boost::uint32_t> (*iter_) <=
+                static_cast<boost::uint32_t> (max_code_point))
+            {
+                chars_.push_back (static_cast<boost::uint32_t> (*iter_));
+            }
+        }
+
+        std::sort (chars_.begin (), chars_.end ());
+
+        range_vector set_;
+
+        for (std::vector<boost::uint32_t>::const_iterator iter_ =
+            chars_.begin (), end_ = chars_.end (); iter_ != end_; ++iter_)
+        {
+            if (!set_.empty () && *iter_ <= set_.back ().second + 1)
+            {
+                set_.back ().second = (std::max) (set_.back ().second,
+                    *iter_);
+            }
+            else
+            {
+                set_.push_back (range (*iter_, *iter_));
+            }
+        }
+
+        if (token_._negated)
+        {
+            range_vector negated_;
+            boost::uint32_t next_ = 0;
+
+            for (range_vector::const_iterator iter_ = set_.begin (),
+                end_ = set_.end (); iter_ != end_; ++iter_)
+            {
+                if (iter_->first > next_)
+                {
+                    negated_.push_back (range (next_, iter_->first - 1));
+                }
+
+                next_ = iter_->second + 1;
+            }
+
+            if (next_ <= static_cast<boost::uint32_t> (max_code_point))
+            {
+                negated_.push_back (range (next_,
+                    static_cast<boost::uint32_t> (max_code_point)));
+            }
+
+            set_.swap (negated_);
+        }
+
+        for (range_vector::const_iterator iter_ = set_.begin (),
+            end_ = set_.end (); iter_ != end_; ++iter_)
+        {
+            if (iter_->first < 0xd800 && iter_->second >= 0xd800)
+            {
+                ranges_.push_back (range (iter_->first, 0xd7ff));
+            }
+            else if (iter_->first < 0xd800 || iter_->first > 0xdfff)
+            {
+                ranges_.push_back (*iter_);
+                continue;
+            }
+
+            if (iter_->second > 0xdfff)
+            {
+                ranges_.push_back (range ((std::max) (iter_->first,
+                    static_cast<boost::uint32_t> (0xe000)), iter_->second));
+            }
+        }
+    }
+
+    static void append_byte (const unsigned char ch_, string &regex_)
+    {
+        static const char digits_[] = "0123456789abcdef";
+
+        regex_ += "\\x";
+        regex_ += digits_[ch_ >> 4];
+        regex_ += digits_[ch_ & 0xf];
+    }
+
+    static void append_byte_range (const byte_range &range_,
+        string &regex_)
+    {
+        if (range_.first == range_.second)
+        {
+            append_byte (range_.first, regex_);
+        }
+        else
+        {
+            regex_ += '[';
+            append_byte (range_.first, regex_);
+            regex_ += '-';
+            append_byte (range_.second, regex_);
+            regex_ += ']';
+        }
+    }
+
+    // Append the regex matching the UTF-8 encoding of the code points in
+    // the charset: the single byte encodings form one charset, all the
+    // longer ones an alternative each.
+    static void charset (const wstring_token &token_, string &regex_)
+    {
+        range_vector ranges_;
+        sequence_vector sequences_;
+
+        ranges (token_, ranges_);
+
+        for (range_vector::const_iterator iter_ = ranges_.begin (),
+            end_ = ranges_.end (); iter_ != end_; ++iter_)
+        {
+            sequences (iter_->first, iter_->second, sequences_);
+        }
+
+        if (sequences_.empty ())
+        {
+            throw runtime_error ("Charsets matching no UTF-8 encoded "
+                "code point are not allowed.");
+        }
+
+        string ascii_;
+        std::vector<string> alternatives_;
+
+        for (sequence_vector::const_iterator iter_ = sequences_.begin (),
+            end_ = sequences_.end (); iter_ != end_; ++iter_)
+        {
+            if (iter_->size () == 1)
+            {
+                append_byte ((*iter_)[0].first, ascii_);
+
+                if ((*iter_)[0].first != (*iter_)[0].second)
+                {
+                    ascii_ += '-';
+                    append_byte ((*iter_)[0].second, ascii_);
+                }
+            }
+            else
+            {
+                string alternative_;
+
+                for (sequence::const_iterator byte_iter_ = iter_->begin (),
+                    byte_end_ = iter_->end (); byte_iter_ != byte_end_;
+                    ++byte_iter_)
+                {
+                    append_byte_range (*byte_iter_, alternative_);
+                }
+
+                alternatives_.push_back (alternative_);
+            }
+        }
+
+        if (!ascii_.empty ())
+        {
+            alternatives_.insert (alternatives_.begin (),
+                '[' + ascii_ + ']');
+        }
+
+        if (alternatives_.size () == 1 && !ascii_.empty ())
+        {
+            regex_ += alternatives_.front ();
+            return;
+        }
+
+        regex_ += '(';
+
+        for (std::vector<string>::const_iterator iter_ =
+            alternatives_.begin (), end_ = alternatives_.end ();
+            iter_ != end_; ++iter_)
+        {
+            if (iter_ != alternatives_.begin ())
+            {
+                regex_ += '|';
+            }
+
+            regex_ += *iter_;
+        }
+
+        regex_ += ')';
+    }
+};
+}
+}
+}
+
+#endif
@@ -15,9 +15,10 @@ namespace boost
 namespace lexer
 {
 // IMPORTANT! This won't work if you don't enable RTTI!
+// Version 2 adds the literal chains of the DFAs.
 template<typename CharT, class Archive>
 void serialise (basic_state_machine<CharT> &sm_, Archive &ar_,
-    unsigned int version_ = 1)
+    unsigned int version_ = 2)
 {
     detail::internals &internals_ = const_cast<detail::internals &>
         (sm_.data ());
@@ -26,6 +27,16 @@ void serialise (basic_state_machine<CharT> &sm_, Archive &ar_,
     ar_ & *internals_._lookup;
     ar_ & internals_._dfa_alphabet;
     ar_ & *internals_._dfa;
+
+    if (version_ >= 2)
+    {
+        ar_ & *internals_._literals;
+    }
+    else if (Archive::is_loading::value)
+    {
+        internals_._literals.clear ();
+    }
+
     ar_ & internals_._seen_BOL_assertion;
     ar_ & internals_._seen_EOL_assertion;
 }
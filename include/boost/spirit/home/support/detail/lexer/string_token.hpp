@@ -68,7 +68,10 @@ struct basic_string_token
     {
         const std::size_t max_chars_ = sizeof (CharT) == 1 ?
             num_chars : num_wchar_ts;
-        CharT curr_char_ = (std::numeric_limits<CharT>::min)();
+        // wide chars range from 0 to max_chars_ - 1, even if wchar_t is
+        // signed
+        CharT curr_char_ = sizeof (CharT) == 1 ?
+            (std::numeric_limits<CharT>::min)() : 0;
         string temp_;
         const CharT *curr_ = _charset.c_str ();
         const CharT *chars_end_ = curr_ + _charset.size ();
@@ -0,0 +1,724 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+    http://spirit.sourceforge.net/
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(SPIRIT_PERFECT_HASH_OCTOBER_16_2016_0230PM)
+#define SPIRIT_PERFECT_HASH_OCTOBER_16_2016_0230PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+#include <string>
+#include <vector>
+
+#if !defined(BOOST_SPIRIT_PERFECT_HASH_MAX_DISPLACEMENT)
+#define BOOST_SPIRIT_PERFECT_HASH_MAX_DISPLACEMENT 32
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//  Minimal perfect hashing of a read-only symbol table (the frozen Lookups
+//  of Qi and X3).
+//
+//  The keys are hashed by prefixes of fixed lengths. With b the length of
+//  the shortest key, the prefix lengths (levels) are b, 2b, 4b, ... (at
+//  most perfect_hash_levels of them) and a key is filed under the longest
+//  of its prefixes that is a level: with b = 2, "const" is filed under
+//  "cons" and "constexpr" under "constexp". The shorter level prefixes of
+//  a key are entered as well, only marking that longer keys start there.
+//
+//  A lookup hashes the input level by level (FNV-1a over case folded
+//  characters, so that each level goes on from the hash of the previous
+//  one) and stops at the first prefix no key starts with; if the input is
+//  not a symbol, that is usually after a single probe. The keys filed
+//  under the prefixes found are then verified, longest first. The first
+//  one matching is the longest match.
+//
+//  The table is built with "hash and displace": the distinct hashes are
+//  distributed over (number of hashes / 2) buckets and, largest bucket
+//  first, each bucket gets the smallest displacement moving all of its
+//  hashes to free slots. There are exactly as many slots as distinct
+//  hashes. Keys hashing to the same value (like "if" and "IF", as the hash
+//  ignores case) share a slot and are verified one after the other.
+//
+//  The search for a displacement is bounded (by
+//  BOOST_SPIRIT_PERFECT_HASH_MAX_DISPLACEMENT times the number of slots).
+//  Should some bucket not find one, no table is built and lookups verify
+//  every key instead, longest match first, as for comparisons the hash
+//  cannot follow.
+//
+//  The building blocks are constexpr in C++14, so that a table can be
+//  computed at compile time (see x3::static_perfect_hash).
+///////////////////////////////////////////////////////////////////////////////
+namespace boost { namespace spirit { namespace detail
+{
+    typedef boost::uint32_t perfect_hash_index;
+
+    perfect_hash_index const perfect_hash_npos = perfect_hash_index(-1);
+    perfect_hash_index const perfect_hash_levels = 7;
+    perfect_hash_index const perfect_hash_marker = 0x80000000u;
+    boost::uint64_t const perfect_hash_basis = UINT64_C(0xcbf29ce484222325);
+
+    // ASCII and Latin-1 upper case letters are hashed as lower case
+    inline BOOST_CXX14_CONSTEXPR boost::uint32_t
+    perfect_hash_fold(boost::uint32_t ch)
+    {
+        if ((ch - 'A') < 26u || ((ch - 0xc0u) < 0x1fu && ch != 0xd7u))
+            return ch + 0x20;
+        return ch;
+    }
+
+    template <typename Char>
+    inline BOOST_CXX14_CONSTEXPR boost::uint64_t
+    perfect_hash_next(boost::uint64_t h, Char ch)
+    {
+        typedef typename make_unsigned<Char>::type uchar;
+        return (h ^ perfect_hash_fold(static_cast<boost::uint32_t>(
+            static_cast<uchar>(ch)))) * UINT64_C(0x100000001b3);
+    }
+
+    inline BOOST_CXX14_CONSTEXPR boost::uint64_t
+    perfect_hash_mix(boost::uint64_t h)
+    {
+        h ^= h >> 32;
+        h *= UINT64_C(0xff51afd7ed558ccd);
+        return h ^ (h >> 32);
+    }
+
+    // map x to [0, n) without a division
+    inline BOOST_CXX14_CONSTEXPR perfect_hash_index
+    perfect_hash_reduce(boost::uint32_t x, perfect_hash_index n)
+    {
+        return perfect_hash_index((boost::uint64_t(x) * n) >> 32);
+    }
+
+    // m is the perfect_hash_mix of the hash
+    inline BOOST_CXX14_CONSTEXPR perfect_hash_index
+    perfect_hash_bucket(boost::uint64_t m, perfect_hash_index buckets)
+    {
+        return perfect_hash_reduce(boost::uint32_t(m >> 32), buckets);
+    }
+
+    inline BOOST_CXX14_CONSTEXPR perfect_hash_index
+    perfect_hash_slot(boost::uint64_t m, boost::uint32_t displacement
+      , perfect_hash_index slots)
+    {
+        m ^= displacement * UINT64_C(0x9e3779b97f4a7c15);
+        return perfect_hash_reduce(boost::uint32_t(
+            (m * UINT64_C(0xd6e8feb86659fd93)) >> 32), slots);
+    }
+
+    // the level a key of the given size is filed under
+    inline BOOST_CXX14_CONSTEXPR perfect_hash_index
+    perfect_hash_level(perfect_hash_index size, perfect_hash_index base)
+    {
+        perfect_hash_index level = 0;
+        while (level + 1 < perfect_hash_levels
+            && (boost::uint64_t(base) << (level + 1)) <= size)
+        {
+            ++level;
+        }
+        return level;
+    }
+
+    // the hashes of the level prefixes of a key, returns their number
+    template <typename Char>
+    inline BOOST_CXX14_CONSTEXPR perfect_hash_index
+    perfect_hash_prefixes(Char const* key, perfect_hash_index size
+      , perfect_hash_index base, boost::uint64_t* hashes)
+    {
+        perfect_hash_index const levels = perfect_hash_level(size, base) + 1;
+        boost::uint64_t h = perfect_hash_basis;
+        perfect_hash_index i = 0;
+        for (perfect_hash_index level = 0; level != levels; ++level)
+        {
+            for (; i != (base << level); ++i)
+                h = perfect_hash_next(h, key[i]);
+            hashes[level] = h;
+        }
+        return levels;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Building the table
+    ///////////////////////////////////////////////////////////////////////////
+    struct perfect_hash_shape
+    {
+        perfect_hash_index slots;       // number of slots (distinct hashes)
+        perfect_hash_index buckets;     // number of displacements
+    };
+
+    // number of indices of scratch space needed to hash n prefixes
+    inline BOOST_CXX14_CONSTEXPR std::size_t
+    perfect_hash_scratch(std::size_t n)
+    {
+        return 6 * n + 2;
+    }
+
+    inline BOOST_CXX14_CONSTEXPR void
+    perfect_hash_sift(boost::uint64_t const* hashes, perfect_hash_index* order
+      , perfect_hash_index root, perfect_hash_index n)
+    {
+        for (;;)
+        {
+            perfect_hash_index child = 2 * root + 1;
+            if (child >= n)
+                return;
+            if (child + 1 < n && hashes[order[child]] < hashes[order[child + 1]])
+                ++child;
+            if (!(hashes[order[root]] < hashes[order[child]]))
+                return;
+            perfect_hash_index const tmp = order[root];
+            order[root] = order[child];
+            order[child] = tmp;
+            root = child;
+        }
+    }
+
+    // heap sort by hash (std::sort is not constexpr)
+    inline BOOST_CXX14_CONSTEXPR void
+    perfect_hash_sort(boost::uint64_t const* hashes, perfect_hash_index* order
+      , perfect_hash_index n)
+    {
+        for (perfect_hash_index i = n / 2; i-- != 0;)
+            perfect_hash_sift(hashes, order, i, n);
+        for (perfect_hash_index i = n; i-- > 1;)
+        {
+            perfect_hash_index const tmp = order[0];
+            order[0] = order[i];
+            order[i] = tmp;
+            perfect_hash_sift(hashes, order, 0, i);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Given n hashes, compute the displacements (one per bucket) and the
+    //  slot of each hash: order lists the hashes slot by slot, those of slot
+    //  p (all equal) being order[slots[p]] ... order[slots[p + 1] - 1].
+    //
+    //      order:      n indices
+    //      slots:      n + 1 indices
+    //      disp:       n displacements
+    //      scratch:    perfect_hash_scratch(n) indices
+    //
+    //  Returns no buckets (and no slots) if a bucket finds no displacement.
+    ///////////////////////////////////////////////////////////////////////////
+    inline BOOST_CXX14_CONSTEXPR perfect_hash_shape
+    build_perfect_hash(boost::uint64_t const* hashes, perfect_hash_index n
+      , perfect_hash_index* order, perfect_hash_index* slots
+      , boost::uint32_t* disp, perfect_hash_index* scratch)
+    {
+        perfect_hash_shape shape = { 0, 0 };
+        slots[0] = 0;
+        if (n == 0)
+            return shape;
+
+        perfect_hash_index* sorted = scratch;               // n
+        perfect_hash_index* first = sorted + n;             // n + 1
+        perfect_hash_index* bucket_end = first + n + 1;     // n
+        perfect_hash_index* members = bucket_end + n;       // n
+        perfect_hash_index* group_of = members + n;         // n
+        perfect_hash_index* trial = group_of + n;           // n + 1
+
+        for (perfect_hash_index i = 0; i != n; ++i)
+            sorted[i] = i;
+        perfect_hash_sort(hashes, sorted, n);
+
+        // group equal hashes
+        perfect_hash_index m = 0;
+        for (perfect_hash_index i = 0; i != n; ++i)
+        {
+            if (i == 0 || hashes[sorted[i]] != hashes[sorted[i - 1]])
+                first[m++] = i;
+        }
+        first[m] = n;
+
+        // distribute the groups over the buckets (counting sort)
+        perfect_hash_index const buckets = (m + 1) / 2;
+        for (perfect_hash_index b = 0; b != buckets; ++b)
+        {
+            bucket_end[b] = 0;
+            disp[b] = 0;
+        }
+        for (perfect_hash_index g = 0; g != m; ++g)
+        {
+            ++bucket_end[perfect_hash_bucket(
+                perfect_hash_mix(hashes[sorted[first[g]]]), buckets)];
+        }
+
+        perfect_hash_index max_size = 0;
+        perfect_hash_index start = 0;
+        for (perfect_hash_index b = 0; b != buckets; ++b)
+        {
+            perfect_hash_index const size = bucket_end[b];
+            if (size > max_size)
+                max_size = size;
+            bucket_end[b] = start;
+            start += size;
+        }
+        for (perfect_hash_index g = 0; g != m; ++g)
+        {
+            members[bucket_end[perfect_hash_bucket(
+                perfect_hash_mix(hashes[sorted[first[g]]]), buckets)]++] = g;
+        }
+
+        // displace the buckets, the largest first
+        for (perfect_hash_index p = 0; p != m; ++p)
+            group_of[p] = perfect_hash_npos;
+
+        boost::uint64_t const max_tries =
+            boost::uint64_t(BOOST_SPIRIT_PERFECT_HASH_MAX_DISPLACEMENT) * m;
+        boost::uint32_t const tries = max_tries > 0xffffffffu ?
+            0xffffffffu : boost::uint32_t(max_tries);
+
+        for (perfect_hash_index size = max_size; size != 0; --size)
+        {
+            for (perfect_hash_index b = 0; b != buckets; ++b)
+            {
+                perfect_hash_index const begin = b ? bucket_end[b - 1] : 0;
+                if (bucket_end[b] - begin != size)
+                    continue;
+
+                boost::uint32_t d = 0;
+                for (; d != tries; ++d)
+                {
+                    perfect_hash_index k = 0;
+                    for (; k != size; ++k)
+                    {
+                        perfect_hash_index const p = perfect_hash_slot(
+                            perfect_hash_mix(hashes[sorted[first[members[begin + k]]]])
+                          , d, m);
+                        if (group_of[p] != perfect_hash_npos)
+                            break;
+                        perfect_hash_index j = 0;
+                        while (j != k && trial[j] != p)
+                            ++j;
+                        if (j != k)
+                            break;
+                        trial[k] = p;
+                    }
+
+                    if (k == size)
+                    {
+                        for (k = 0; k != size; ++k)
+                            group_of[trial[k]] = members[begin + k];
+                        disp[b] = d;
+                        break;
+                    }
+                }
+                if (d == tries)
+                    return shape;       // give up
+            }
+        }
+
+        // list the hashes slot by slot
+        perfect_hash_index k = 0;
+        for (perfect_hash_index p = 0; p != m; ++p)
+        {
+            slots[p] = k;
+            perfect_hash_index const g = group_of[p];
+            for (perfect_hash_index i = first[g]; i != first[g + 1]; ++i)
+                order[k++] = sorted[i];
+        }
+        slots[m] = n;
+
+        shape.slots = m;
+        shape.buckets = buckets;
+        return shape;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  From the slots of the prefixes to the slots of the keys. Prefix i
+    //  belongs to key prefix_key[i], or'ed with perfect_hash_marker if the
+    //  key is not filed under it. Lists the keys filed in each slot, longest
+    //  first (equally long ones in their original order: the first of equal
+    //  keys wins, just like with add), and flags the slots longer keys go
+    //  on from.
+    //
+    //      keys:       one index per key
+    //      key_slots:  slots + 1 indices
+    //      longer:     slots flags
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Flag>
+    inline BOOST_CXX14_CONSTEXPR void
+    perfect_hash_layout(perfect_hash_index const* prefix_key
+      , perfect_hash_index const* sizes, perfect_hash_index const* order
+      , perfect_hash_index const* prefix_slots, perfect_hash_index slots
+      , perfect_hash_index* keys, perfect_hash_index* key_slots, Flag* longer)
+    {
+        perfect_hash_index k = 0;
+        for (perfect_hash_index p = 0; p != slots; ++p)
+        {
+            key_slots[p] = k;
+            longer[p] = false;
+            for (perfect_hash_index i = prefix_slots[p]; i != prefix_slots[p + 1]; ++i)
+            {
+                perfect_hash_index const key = prefix_key[order[i]];
+                if (key & perfect_hash_marker)
+                {
+                    longer[p] = true;
+                    continue;
+                }
+
+                perfect_hash_index j = k++;
+                for (; j != key_slots[p]; --j)
+                {
+                    perfect_hash_index const prev = keys[j - 1];
+                    if (sizes[prev] > sizes[key]
+                        || (sizes[prev] == sizes[key] && prev < key))
+                    {
+                        break;
+                    }
+                    keys[j] = prev;
+                }
+                keys[j] = key;
+            }
+        }
+        key_slots[slots] = k;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Looking up the longest key matching a prefix of [first, last). The
+    //  Table provides:
+    //
+    //      char_type
+    //      perfect_hash_index base() const;            // shortest key
+    //      perfect_hash_index levels() const;
+    //      perfect_hash_index buckets() const;
+    //      boost::uint32_t displacement(perfect_hash_index bucket) const;
+    //      perfect_hash_index slots() const;           // distinct hashes
+    //      boost::uint64_t slot_hash(perfect_hash_index slot) const;
+    //      bool slot_longer(perfect_hash_index slot) const;
+    //      perfect_hash_index slot_begin(perfect_hash_index slot) const;
+    //      perfect_hash_index entries() const;
+    //      perfect_hash_index size(perfect_hash_index entry) const;
+    //      char_type const* key(perfect_hash_index entry) const;
+    //
+    //  filter(ch) is what gets hashed, equal(ch, key_ch) verifies a char.
+    //  Returns the matching entry (and advances first past the match) or
+    //  perfect_hash_npos.
+    ///////////////////////////////////////////////////////////////////////////
+    struct perfect_hash_pass_through
+    {
+        template <typename Char>
+        Char operator()(Char ch) const
+        {
+            return ch;
+        }
+    };
+
+    template <typename Iterator, typename Char, typename Equal>
+    inline bool perfect_hash_match(Iterator& i, Iterator const& last
+      , Char const* key, perfect_hash_index size, Equal const& equal)
+    {
+        for (; size != 0; --size, ++i, ++key)
+        {
+            if (i == last || !equal(*i, *key))
+                return false;
+        }
+        return true;
+    }
+
+    // Verifying every key: for comparisons the hash cannot follow (case
+    // insensitive matching in encodings beyond Latin-1), or if no table
+    // could be built.
+    template <typename Table, typename Iterator, typename Equal>
+    inline perfect_hash_index perfect_hash_scan(Table const& table
+      , Iterator& first, Iterator const& last, Equal const& equal)
+    {
+        perfect_hash_index found = perfect_hash_npos;
+        perfect_hash_index longest = 0;
+        Iterator latest = first;
+
+        for (perfect_hash_index e = 0; e != table.entries(); ++e)
+        {
+            perfect_hash_index const size = table.size(e);
+            Iterator i = first;
+            if (size > longest
+                && perfect_hash_match(i, last, table.key(e), size, equal))
+            {
+                found = e;
+                longest = size;
+                latest = i;
+            }
+        }
+
+        if (found != perfect_hash_npos)
+            first = latest;
+        return found;
+    }
+
+    template <typename Table, typename Iterator, typename Filter, typename Equal>
+    inline perfect_hash_index perfect_hash_find(Table const& table
+      , Iterator& first, Iterator const& last
+      , Filter const& filter, Equal const& equal)
+    {
+        typedef typename Table::char_type char_type;
+
+        // no table could be built
+        if (table.buckets() == 0)
+            return perfect_hash_scan(table, first, last, equal);
+
+        // go down the levels, as far as keys go
+        perfect_hash_index found[perfect_hash_levels] = { 0 };
+        perfect_hash_index nfound = 0;
+
+        Iterator i = first;
+        boost::uint64_t h = perfect_hash_basis;
+        perfect_hash_index len = 0;
+        for (perfect_hash_index level = 0; level != table.levels(); ++level)
+        {
+            perfect_hash_index const size = table.base() << level;
+            for (; len != size && i != last; ++len, ++i)
+                h = perfect_hash_next(h, char_type(filter(*i)));
+            if (len != size)
+                break;
+
+            boost::uint64_t const m = perfect_hash_mix(h);
+            perfect_hash_index const slot = perfect_hash_slot(m
+              , table.displacement(perfect_hash_bucket(m, table.buckets()))
+              , table.slots());
+            if (table.slot_hash(slot) != h)
+                break;
+
+            found[nfound++] = slot;
+            if (!table.slot_longer(slot))
+                break;
+        }
+
+        // verify the keys filed under the prefixes found, longest first
+        while (nfound != 0)
+        {
+            perfect_hash_index const slot = found[--nfound];
+            for (perfect_hash_index e = table.slot_begin(slot)
+              , end = table.slot_begin(slot + 1); e != end; ++e)
+            {
+                Iterator j = first;
+                if (perfect_hash_match(j, last, table.key(e), table.size(e), equal))
+                {
+                    first = j;
+                    return e;
+                }
+            }
+        }
+        return perfect_hash_npos;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  A table built at run time, from the contents of another Lookup
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename T>
+    struct perfect_hash_table
+    {
+        typedef Char char_type;
+        typedef T value_type;
+
+        perfect_hash_table()
+          : base_(0), levels_(0), buckets_(0), slots_(0)
+        {
+        }
+
+        // build the table from anything providing for_each(f(str, val))
+        template <typename Lookup>
+        void assign(Lookup const& lookup)
+        {
+            clear();
+            lookup.for_each(collector(*this));
+            build();
+        }
+
+        void clear()
+        {
+            chars_.clear();
+            entries_.clear();
+            values_.clear();
+            disp_.clear();
+            slots_info_.clear();
+            base_ = levels_ = buckets_ = slots_ = 0;
+        }
+
+        template <typename Iterator, typename Filter, typename Equal>
+        T* find(Iterator& first, Iterator last
+          , Filter const& filter, Equal const& equal) const
+        {
+            perfect_hash_index const e =
+                perfect_hash_find(*this, first, last, filter, equal);
+            return e == perfect_hash_npos ? 0 : value(e);
+        }
+
+        template <typename Iterator, typename Equal>
+        T* scan(Iterator& first, Iterator last, Equal const& equal) const
+        {
+            perfect_hash_index const e =
+                perfect_hash_scan(*this, first, last, equal);
+            return e == perfect_hash_npos ? 0 : value(e);
+        }
+
+        // values are not part of the table's structure; like the data of
+        // tst, they are handed out mutable
+        T* value(perfect_hash_index e) const
+        {
+            return const_cast<T*>(&values_[e]);
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for (perfect_hash_index e = 0; e != entries(); ++e)
+                f(std::basic_string<Char>(key(e), size(e)), values_[e]);
+        }
+
+        // the Table interface of perfect_hash_find
+        perfect_hash_index base() const { return base_; }
+        perfect_hash_index levels() const { return levels_; }
+        perfect_hash_index buckets() const { return buckets_; }
+        boost::uint32_t displacement(perfect_hash_index b) const { return disp_[b]; }
+        perfect_hash_index slots() const { return slots_; }
+        boost::uint64_t slot_hash(perfect_hash_index p) const { return slots_info_[p].hash; }
+        bool slot_longer(perfect_hash_index p) const { return slots_info_[p].longer; }
+        perfect_hash_index slot_begin(perfect_hash_index p) const { return slots_info_[p].begin; }
+        perfect_hash_index entries() const { return perfect_hash_index(entries_.size()); }
+        perfect_hash_index size(perfect_hash_index e) const { return entries_[e].size; }
+        Char const* key(perfect_hash_index e) const { return chars_.data() + entries_[e].offset; }
+
+    private:
+
+        struct entry_info
+        {
+            perfect_hash_index offset;  // of the key in chars_
+            perfect_hash_index size;    // of the key
+        };
+
+        struct slot_info
+        {
+            boost::uint64_t hash;       // of the prefix of the slot
+            perfect_hash_index begin;   // the first entry filed under it
+            bool longer;                // whether longer keys start with it
+        };
+
+        struct collector
+        {
+            collector(perfect_hash_table& table)
+              : table(table)
+            {
+            }
+
+            template <typename String>
+            void operator()(String const& s, T const& val) const
+            {
+                if (s.empty())
+                    return;
+                entry_info const entry = {
+                    perfect_hash_index(table.chars_.size())
+                  , perfect_hash_index(s.size()) };
+                table.chars_.append(s.begin(), s.end());
+                table.entries_.push_back(entry);
+                table.values_.push_back(val);
+            }
+
+            perfect_hash_table& table;
+        };
+
+        void build()
+        {
+            perfect_hash_index const n = perfect_hash_index(entries_.size());
+            if (n == 0)
+                return;
+
+            std::vector<perfect_hash_index> sizes(n);
+            perfect_hash_index max_size = 0;
+            base_ = entries_[0].size;
+            for (perfect_hash_index i = 0; i != n; ++i)
+            {
+                sizes[i] = entries_[i].size;
+                if (sizes[i] < base_)
+                    base_ = sizes[i];
+                if (sizes[i] > max_size)
+                    max_size = sizes[i];
+            }
+            levels_ = perfect_hash_level(max_size, base_) + 1;
+
+            // the level prefixes of the keys
+            std::vector<boost::uint64_t> hashes;
+            std::vector<perfect_hash_index> prefix_key;
+            hashes.reserve(2 * n);
+            prefix_key.reserve(2 * n);
+            for (perfect_hash_index i = 0; i != n; ++i)
+            {
+                boost::uint64_t prefixes[perfect_hash_levels] = { 0 };
+                perfect_hash_index const levels =
+                    perfect_hash_prefixes(key(i), sizes[i], base_, prefixes);
+                for (perfect_hash_index level = 0; level != levels; ++level)
+                {
+                    hashes.push_back(prefixes[level]);
+                    prefix_key.push_back(
+                        level + 1 == levels ? i : (i | perfect_hash_marker));
+                }
+            }
+
+            perfect_hash_index const nprefixes = perfect_hash_index(hashes.size());
+            std::vector<perfect_hash_index> order(nprefixes);
+            std::vector<perfect_hash_index> prefix_slots(nprefixes + 1);
+            std::vector<perfect_hash_index> scratch(perfect_hash_scratch(nprefixes));
+            disp_.resize(nprefixes);
+
+            perfect_hash_shape const shape = build_perfect_hash(
+                &hashes[0], nprefixes, &order[0], &prefix_slots[0]
+              , &disp_[0], &scratch[0]);
+            buckets_ = shape.buckets;
+            slots_ = shape.slots;
+            disp_.resize(buckets_);
+            if (buckets_ == 0)
+                return;     // the entries stay as they are, to be scanned
+
+            std::vector<perfect_hash_index> keys(n);
+            std::vector<perfect_hash_index> key_slots(slots_ + 1);
+            std::vector<char> longer(slots_);
+            perfect_hash_layout(&prefix_key[0], &sizes[0], &order[0]
+              , &prefix_slots[0], slots_, &keys[0], &key_slots[0], &longer[0]);
+
+            slots_info_.resize(slots_ + 1);
+            for (perfect_hash_index p = 0; p != slots_; ++p)
+            {
+                slots_info_[p].hash = hashes[order[prefix_slots[p]]];
+                slots_info_[p].begin = key_slots[p];
+                slots_info_[p].longer = longer[p] != 0;
+            }
+            slots_info_[slots_].hash = 0;
+            slots_info_[slots_].begin = n;
+            slots_info_[slots_].longer = false;
+
+            // lay out the entries slot by slot
+            std::vector<entry_info> entries;
+            std::vector<T> values;
+            entries.reserve(n);
+            values.reserve(n);
+            for (perfect_hash_index k = 0; k != n; ++k)
+            {
+                entries.push_back(entries_[keys[k]]);
+                values.push_back(values_[keys[k]]);
+            }
+            entries_.swap(entries);
+            values_.swap(values);
+        }
+
+        std::basic_string<Char> chars_;         // all the keys
+        std::vector<entry_info> entries_;
+        std::vector<T> values_;                 // by entry
+        std::vector<boost::uint32_t> disp_;     // by bucket
+        std::vector<slot_info> slots_info_;     // slots + 1
+        perfect_hash_index base_;
+        perfect_hash_index levels_;
+        perfect_hash_index buckets_;
+        perfect_hash_index slots_;
+    };
+}}}
+
+#endif
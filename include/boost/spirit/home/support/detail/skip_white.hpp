@@ -0,0 +1,83 @@
+/*=============================================================================
+    Copyright (c) 2001-2011 Joel de Guzman
+    Copyright (c) 2001-2011 Hartmut Kaiser
+    http://spirit.sourceforge.net/
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(SPIRIT_SKIP_WHITE_OCTOBER_16_2016_0500PM)
+#define SPIRIT_SKIP_WHITE_OCTOBER_16_2016_0500PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <cstddef>
+#include <boost/cstdint.hpp>
+#include <boost/spirit/home/support/detail/digit_block.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Skipping runs of white space in 8 bit character input, 8 characters at
+//  a time (SIMD within a register, see digit_block.hpp).
+//
+//  Only the standard white space characters (' ', '\t', '\n', '\v', '\f'
+//  and '\r') are skipped. These are white space in every encoding and
+//  locale, so the space skippers of Qi and X3 use this to get past the
+//  bulk of the blanks, leaving any other character (including locale or
+//  encoding specific white space) to the skip parser itself.
+///////////////////////////////////////////////////////////////////////////////
+namespace boost { namespace spirit { namespace detail
+{
+    inline bool is_standard_white(char ch)
+    {
+        unsigned char const uch = static_cast<unsigned char>(ch);
+        return uch == ' ' || static_cast<unsigned char>(uch - '\t') < 5;
+    }
+
+    // high bit of each byte set if the byte is standard white space
+    inline boost::uint64_t white_block(boost::uint64_t w)
+    {
+        boost::uint64_t const lows = UINT64_C(0x0101010101010101);
+        boost::uint64_t const highs = UINT64_C(0x8080808080808080);
+        boost::uint64_t const low7 = w & ~highs;
+
+        // ' ': no bit left after xor'ing with 0x20
+        boost::uint64_t const x = w ^ (lows * ' ');
+        boost::uint64_t const space = ~(((x & ~highs) + ~highs) | x);
+
+        // '\t' ... '\r': >= '\t' and not > '\r' (bytes < 0x80 only)
+        boost::uint64_t const control = (low7 + lows * (0x80 - '\t'))
+            & ~(low7 + lows * (0x7f - '\r')) & ~w;
+
+        return (space | control) & highs;
+    }
+
+    // returns the first character of [first, last) that is not standard
+    // white space, or last
+    inline char const* skip_white(char const* first, char const* last)
+    {
+        boost::uint64_t const highs = UINT64_C(0x8080808080808080);
+        while (static_cast<std::size_t>(last - first) >= digit_block_size)
+        {
+            boost::uint64_t other = ~white_block(load_digit_block(first)) & highs;
+            if (other != 0)
+            {
+                // the first character ended up in the low byte
+                while ((other & 0x80) == 0)
+                {
+                    other >>= 8;
+                    ++first;
+                }
+                return first;
+            }
+            first += digit_block_size;
+        }
+
+        while (first != last && is_standard_white(*first))
+            ++first;
+        return first;
+    }
+}}}
+
+#endif
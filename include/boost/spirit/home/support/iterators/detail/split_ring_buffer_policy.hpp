@@ -0,0 +1,176 @@
+//  Copyright (c) 2001 Daniel C. Nuffer
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(BOOST_SPIRIT_ITERATOR_SPLIT_RING_BUFFER_POLICY_OCT_16_2026_1130PM)
+#define BOOST_SPIRIT_ITERATOR_SPLIT_RING_BUFFER_POLICY_OCT_16_2026_1130PM
+
+#include <boost/spirit/home/support/iterators/multi_pass_fwd.hpp>
+#include <boost/spirit/home/support/iterators/detail/multi_pass.hpp>
+#include <boost/spirit/home/support/iterators/detail/buf_id_check_policy.hpp>
+#include <boost/assert.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace boost { namespace spirit { namespace iterator_policies
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  class split_ring_buffer
+    //
+    //  Implementation of the StoragePolicy used by multi_pass
+    //  This stores the last N elements read from the input in a circular
+    //  buffer allocated once, the buffer never grows. Every iterator keeps
+    //  the (absolute) number of the element it refers to. As long as there
+    //  is only one iterator nothing is stored at all.
+    //
+    //  It is up to the user to ensure that N is big enough for the look
+    //  ahead needed by the grammar. Dereferencing or incrementing an
+    //  iterator referring to an element which has been dropped from the
+    //  buffer throws an illegal_backtracking exception.
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <std::size_t N>
+    struct split_ring_buffer
+    {
+        BOOST_STATIC_ASSERT(N > 0);
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Value>
+        class unique //: public detail::default_storage_policy
+        {
+        protected:
+            unique() : queued_position(0) {}
+
+            unique(unique const& x)
+              : queued_position(x.queued_position) {}
+
+            void swap(unique& x)
+            {
+                boost::swap(queued_position, x.queued_position);
+            }
+
+            // This is called when the iterator is dereferenced.  It's a
+            // template method so we can recover the type of the multi_pass
+            // iterator and call get_input.
+            template <typename MultiPass>
+            static typename MultiPass::reference
+            dereference(MultiPass const& mp)
+            {
+                shared<Value>& data = *mp.shared();
+
+                if (mp.queued_position == data.queue_end)
+                    return MultiPass::get_input(mp);
+
+                check_position(mp);
+                return data.queued_elements[mp.queued_position % N];
+            }
+
+            // This is called when the iterator is incremented. It's a template
+            // method so we can recover the type of the multi_pass iterator
+            // and call is_unique and advance_input.
+            template <typename MultiPass>
+            static void increment(MultiPass& mp)
+            {
+                shared<Value>& data = *mp.shared();
+
+                if (mp.queued_position == data.queue_end)
+                {
+                    if (MultiPass::is_unique(mp))
+                    {
+                        // nobody can go back to the current element, so
+                        // there is no need to store it
+                        data.queue_begin = data.queue_end + 1;
+                    }
+                    else
+                    {
+                        if (data.queued_elements.empty())
+                            data.queued_elements.resize(N);
+
+                        // drop the oldest element if the buffer is full
+                        if (data.queue_end - data.queue_begin == N)
+                            ++data.queue_begin;
+
+                        data.queued_elements[data.queue_end % N] =
+                            MultiPass::get_input(mp);
+                    }
+                    ++data.queue_end;
+                    MultiPass::advance_input(mp);
+                }
+                else
+                {
+                    check_position(mp);
+                }
+                ++mp.queued_position;
+            }
+
+            // called to forcibly clear the queue, all elements before the
+            // given iterator are dropped
+            template <typename MultiPass>
+            static void clear_queue(MultiPass& mp)
+            {
+                if (mp.queued_position > mp.shared()->queue_begin)
+                    mp.shared()->queue_begin = mp.queued_position;
+            }
+
+            // called to determine whether the iterator is an eof iterator
+            template <typename MultiPass>
+            static bool is_eof(MultiPass const& mp)
+            {
+                return mp.queued_position == mp.shared()->queue_end
+                    && MultiPass::input_at_eof(mp);
+            }
+
+            // called by operator==
+            template <typename MultiPass>
+            static bool equal_to(MultiPass const& mp, MultiPass const& x)
+            {
+                return mp.queued_position == x.queued_position;
+            }
+
+            // called by operator<
+            template <typename MultiPass>
+            static bool less_than(MultiPass const& mp, MultiPass const& x)
+            {
+                return mp.queued_position < x.queued_position;
+            }
+
+            template <typename MultiPass>
+            static void destroy(MultiPass&) {}
+
+        private:
+            template <typename MultiPass>
+            static void check_position(MultiPass const& mp)
+            {
+                if (mp.queued_position < mp.shared()->queue_begin)
+                    boost::throw_exception(illegal_backtracking());
+            }
+
+        protected:
+            mutable std::size_t queued_position;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Value>
+        struct shared
+        {
+            shared() : queue_begin(0), queue_end(0) {}
+
+            typedef std::vector<Value> queue_type;
+            queue_type queued_elements;
+
+            // the numbers of the oldest element still stored and of the
+            // element following the newest one
+            std::size_t queue_begin;
+            std::size_t queue_end;
+        };
+
+    }; // split_ring_buffer
+
+}}}
+
+#endif
+
@@ -37,6 +37,7 @@ namespace boost { namespace spirit {
         // storage policies
         struct split_std_deque;
         template<std::size_t N> struct fixed_size_queue;
+        template<std::size_t N> struct split_ring_buffer;
 
         // policy combiner
 #if defined(BOOST_SPIRIT_DEBUG)
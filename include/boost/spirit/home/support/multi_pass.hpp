@@ -30,6 +30,7 @@
 //  Storage policies
 #include <boost/spirit/home/support/iterators/detail/fixed_size_queue_policy.hpp>
 #include <boost/spirit/home/support/iterators/detail/split_std_deque_policy.hpp>
+#include <boost/spirit/home/support/iterators/detail/split_ring_buffer_policy.hpp>
 
 //  Main multi_pass iterator 
 #include <boost/spirit/home/support/iterators/detail/combine_policies.hpp>
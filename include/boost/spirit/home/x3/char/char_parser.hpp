@@ -11,6 +11,9 @@
 #include <boost/spirit/home/x3/core/skip_over.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
 #include <boost/spirit/home/x3/support/no_case.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/utility/enable_if.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -37,4 +40,20 @@ namespace boost { namespace spirit { namespace x3
     };
 }}}
 
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Parser>
+    struct first_set<Parser
+      , typename enable_if<is_base_of<char_parser<Parser>, Parser>>::type>
+    {
+        static bool const is_known = true;
+
+        template <typename Char, typename Context>
+        static bool may_start(Parser const& p, Char ch, Context const& context)
+        {
+            return p.test(ch, context);
+        }
+    };
+}}}}
+
 #endif
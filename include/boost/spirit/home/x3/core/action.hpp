@@ -12,6 +12,7 @@
 #include <boost/spirit/home/x3/support/traits/make_attribute.hpp>
 #include <boost/spirit/home/x3/core/call.hpp>
 #include <boost/spirit/home/x3/nonterminal/detail/transform_attribute.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 #include <boost/range/iterator_range.hpp>
 
 namespace boost { namespace spirit { namespace x3
@@ -113,4 +114,11 @@ namespace boost { namespace spirit { namespace x3
     }
 }}}
 
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject, typename Action>
+    struct first_set<x3::action<Subject, Action>>
+        : subject_first_set<x3::action<Subject, Action>> {};
+}}}}
+
 #endif
@@ -0,0 +1,256 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_PARALLEL_PARSE_OCT_16_2016_0900PM)
+#define BOOST_SPIRIT_X3_PARALLEL_PARSE_OCT_16_2016_0900PM
+
+#include <boost/spirit/home/x3/core/parse.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+//
+//  parallel_parse and parallel_phrase_parse parse a record oriented input,
+//  i.e. records each followed by a delimiter (the last delimiter is
+//  optional), into a container of records:
+//
+//      std::vector<row> rows;
+//      x3::parallel_phrase_parse(first, last, row_, x3::eol, x3::blank, rows);
+//
+//  The input is cut into chunks at delimiters, and the chunks are parsed on
+//  a pool of threads, each into its own container. The containers are then
+//  appended to the attribute in input order, so that the result is the same
+//  as that of a sequential parse. For this the input must be random access
+//  (a contiguous buffer), and the delimiter must not match anywhere inside
+//  a record: the chunks are cut at the first delimiter matching (without
+//  skipping) at or after the cut points.
+//
+//  When a record fails to parse, false is returned and first is left at the
+//  beginning of the first record that failed (or the first error the
+//  skipper and delimiter leave behind), with the records before it in the
+//  attribute. Since the chunks are subranges of the input, iterators seen
+//  by semantic actions and error handlers are absolute positions. An
+//  exception thrown by the earliest failing chunk (e.g. an
+//  expectation_failure not handled by a rule) is rethrown.
+//
+//  Records are parsed concurrently: the parsers, and whatever they reach
+//  through the context, must allow it. Share an x3::concurrent_error_handler
+//  (rather than an x3::error_handler) between the records; an x3::arena
+//  can't be shared, so give each record its own (or none).
+//
+//  thread_count defaults to std::thread::hardware_concurrency().
+//
+//  This header is not included by x3.hpp (it brings in <thread> and
+//  <atomic>), include it explicitly.
+//
+///////////////////////////////////////////////////////////////////////////////
+namespace boost { namespace spirit { namespace x3
+{
+    namespace detail
+    {
+        // chunks are no smaller than this, except for the last
+        std::size_t const parallel_parse_min_chunk = 16384;
+
+        // records and their delimiters, up to the end of the chunk
+        template <typename Iterator, typename Record, typename Delimiter
+          , typename Context, typename Container>
+        bool parse_records(
+            Iterator& first, Iterator last
+          , Record const& record, Delimiter const& delimiter
+          , Context const& context, Container& attr)
+        {
+            typedef typename traits::container_value<Container>::type value_type;
+            for (;;)
+            {
+                x3::skip_over(first, last, context);
+                if (first == last)
+                    return true;
+
+                Iterator const save = first;
+                value_type val;
+                if (!record.parse(first, last, context, unused, val))
+                    return false;
+                traits::push_back(attr, std::move(val));
+
+                if (!delimiter.parse(first, last, context, unused, unused))
+                {
+                    x3::skip_over(first, last, context);
+                    return first == last;
+                }
+                if (first == save)
+                    return false; // neither the record nor the delimiter moved
+            }
+        }
+
+        // the end of the first delimiter matching at or after pos
+        template <typename Iterator, typename Delimiter>
+        Iterator find_delimiter(
+            Iterator pos, Iterator last, Delimiter const& delimiter)
+        {
+            for (; pos != last; ++pos)
+            {
+                Iterator i = pos;
+                if (delimiter.parse(i, last, unused, unused, unused) && i != pos)
+                    return i;
+            }
+            return last;
+        }
+
+        template <typename Iterator, typename Record, typename Delimiter
+          , typename Context, typename Container>
+        bool parallel_parse_main(
+            Iterator& first, Iterator last
+          , Record const& record, Delimiter const& delimiter
+          , Context const& context, Container& attr
+          , std::size_t thread_count)
+        {
+            static_assert(std::is_base_of<std::random_access_iterator_tag
+              , typename std::iterator_traits<Iterator>::iterator_category>::value
+              , "parallel_parse needs random access iterators");
+
+            if (thread_count == 0)
+                thread_count = (std::max)(1u, std::thread::hardware_concurrency());
+
+            // a few chunks per thread, so that threads finishing early
+            // pick up the slack
+            std::size_t const size = last - first;
+            std::size_t chunks = (std::min)(
+                thread_count * 4, size / parallel_parse_min_chunk);
+            if (chunks < 2)
+                return parse_records(first, last, record, delimiter, context, attr);
+
+            std::vector<Iterator> bounds(1, first);
+            for (std::size_t i = 1; i != chunks; ++i)
+            {
+                Iterator cut = first + (size * i / chunks);
+                if (cut < bounds.back())
+                    cut = bounds.back();
+                Iterator bound = find_delimiter(cut, last, delimiter);
+                if (bound == last)
+                    break;
+                if (bound != bounds.back())
+                    bounds.push_back(bound);
+            }
+            bounds.push_back(last);
+            chunks = bounds.size() - 1;
+
+            struct chunk
+            {
+                Iterator where;
+                bool ok = false;
+                std::exception_ptr error;
+                Container attr;
+            };
+            std::vector<chunk> parts(chunks);
+
+            // the earliest failing chunk: later chunks need not be parsed
+            std::atomic<std::size_t> failed(chunks);
+            std::atomic<std::size_t> next(0);
+
+            auto work = [&]()
+            {
+                for (std::size_t i; (i = next++) < chunks;)
+                {
+                    if (i > failed.load())
+                        continue;
+
+                    chunk& part = parts[i];
+                    part.where = bounds[i];
+                    try
+                    {
+                        part.ok = parse_records(part.where, bounds[i + 1]
+                          , record, delimiter, context, part.attr);
+                    }
+                    catch (...)
+                    {
+                        part.error = std::current_exception();
+                    }
+
+                    if (!part.ok)
+                    {
+                        std::size_t f = failed.load();
+                        while (i < f && !failed.compare_exchange_weak(f, i))
+                            ;
+                    }
+                }
+            };
+
+            std::vector<std::thread> pool;
+            std::size_t const threads = (std::min)(thread_count, chunks);
+            for (std::size_t i = 1; i < threads; ++i)
+                pool.emplace_back(work);
+            work();
+            for (auto& t : pool)
+                t.join();
+
+            std::size_t const end = failed.load();
+            for (std::size_t i = 0; i != chunks && i <= end; ++i)
+            {
+                chunk& part = parts[i];
+                traits::append(attr
+                  , std::make_move_iterator(part.attr.begin())
+                  , std::make_move_iterator(part.attr.end()));
+            }
+
+            if (end == chunks)
+            {
+                first = last;
+                return true;
+            }
+            if (parts[end].error)
+                std::rethrow_exception(parts[end].error);
+            first = parts[end].where;
+            return false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename Record, typename Delimiter
+      , typename Attribute>
+    inline bool
+    parallel_parse(
+        Iterator& first
+      , Iterator last
+      , Record const& record
+      , Delimiter const& delimiter
+      , Attribute& attr
+      , std::size_t thread_count = 0)
+    {
+        return detail::parallel_parse_main(first, last
+          , as_parser(record), as_parser(delimiter), unused, attr, thread_count);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename Record, typename Delimiter
+      , typename Skipper, typename Attribute>
+    inline bool
+    parallel_phrase_parse(
+        Iterator& first
+      , Iterator last
+      , Record const& record
+      , Delimiter const& delimiter
+      , Skipper const& s
+      , Attribute& attr
+      , std::size_t thread_count = 0)
+    {
+        static_assert(!std::is_same<Skipper, unused_type>::value,
+            "Error! Skipper cannot be unused_type.");
+
+        auto skipper_ctx = make_context<skipper_tag>(as_parser(s));
+        return detail::parallel_parse_main(first, last
+          , as_parser(record), as_parser(delimiter), skipper_ctx, attr
+          , thread_count);
+    }
+}}}
+
+#endif
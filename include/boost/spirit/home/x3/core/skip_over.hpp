@@ -10,6 +10,9 @@
 #include <boost/spirit/home/x3/support/unused.hpp>
 #include <boost/spirit/home/x3/support/context.hpp>
 #include <boost/spirit/home/x3/support/traits/attribute_category.hpp>
+#include <boost/spirit/home/x3/support/traits/is_contiguous_iterator.hpp>
+#include <boost/spirit/home/x3/char/char_class_tags.hpp>
+#include <boost/spirit/home/support/detail/skip_white.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/not.hpp>
 #include <boost/type_traits/remove_cv.hpp>
@@ -18,6 +21,12 @@
 
 namespace boost { namespace spirit { namespace x3
 {
+    template <typename Encoding, typename Tag>
+    struct char_class;
+
+    template <typename Left, typename Right>
+    struct alternative;
+
     ///////////////////////////////////////////////////////////////////////////
     // Move the /first/ iterator to the first non-matching position
     // given a skip-parser. The function is a no-op if unused_type or
@@ -58,14 +67,65 @@ namespace boost { namespace spirit { namespace x3
             return unused_skipper.skipper;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Skippers starting with a space parser (space, ascii::space,
+        // space | comment, ...) get past runs of blanks in contiguous 8 bit
+        // input without invoking the skipper for every single character.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Skipper>
+        struct is_space_skipper
+          : mpl::false_ {};
+
+        template <typename Encoding>
+        struct is_space_skipper<char_class<Encoding, space_tag>>
+          : mpl::true_ {};
+
+        template <typename Left, typename Right>
+        struct is_space_skipper<alternative<Left, Right>>
+          : is_space_skipper<Left> {};
+
+        template <typename Iterator>
+        struct is_white_iterator
+          : mpl::bool_<
+                traits::is_contiguous_iterator<Iterator>::value
+             && sizeof(typename std::iterator_traits<Iterator>::value_type) == 1
+            > {};
+
         template <typename Iterator, typename Skipper>
         inline void skip_over(
-            Iterator& first, Iterator const& last, Skipper const& skipper)
+            Iterator& first, Iterator const& last, Skipper const& skipper
+          , mpl::false_)
         {
             while (skipper.parse(first, last, unused, unused, unused))
                 /***/;
         }
 
+        template <typename Iterator, typename Skipper>
+        inline void skip_over(
+            Iterator& first, Iterator const& last, Skipper const& skipper
+          , mpl::true_)
+        {
+            do
+            {
+                if (first != last)
+                {
+                    char const* p = reinterpret_cast<char const*>(
+                        traits::to_address(first));
+                    first += spirit::detail::skip_white(p, p + (last - first)) - p;
+                }
+            }
+            while (skipper.parse(first, last, unused, unused, unused));
+        }
+
+        template <typename Iterator, typename Skipper>
+        inline void skip_over(
+            Iterator& first, Iterator const& last, Skipper const& skipper)
+        {
+            detail::skip_over(first, last, skipper, mpl::bool_<
+                is_space_skipper<Skipper>::value
+             && is_white_iterator<Iterator>::value>());
+        }
+
         template <typename Iterator>
         inline void skip_over(Iterator&, Iterator const&, unused_type)
         {
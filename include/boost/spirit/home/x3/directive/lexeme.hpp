@@ -11,6 +11,7 @@
 #include <boost/spirit/home/x3/support/unused.hpp>
 #include <boost/spirit/home/x3/core/skip_over.hpp>
 #include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/utility/enable_if.hpp>
 
@@ -75,4 +76,11 @@ namespace boost { namespace spirit { namespace x3
     auto const lexeme = lexeme_gen{};
 }}}
 
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject>
+    struct first_set<x3::lexeme_directive<Subject>>
+        : subject_first_set<x3::lexeme_directive<Subject>> {};
+}}}}
+
 #endif
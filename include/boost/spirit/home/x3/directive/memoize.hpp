@@ -0,0 +1,242 @@
+/*=============================================================================
+    Copyright (c) 2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_MEMOIZE_OCT_16_2016_1000AM)
+#define BOOST_SPIRIT_X3_MEMOIZE_OCT_16_2016_1000AM
+
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
+#include <boost/spirit/home/x3/support/traits/move_to.hpp>
+#include <boost/spirit/home/x3/support/utility/memo_table.hpp>
+#include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <memory>
+
+namespace boost { namespace spirit { namespace x3
+{
+    template <typename ID, typename Attribute, bool force_attribute>
+    struct rule;
+
+    namespace detail
+    {
+        // the key of a memoized parser: rules are keyed on their ID (so
+        // memoize[r] shares results wherever it appears), other parsers on
+        // the memoize directive (and its copies)
+        template <typename ID>
+        struct memo_rule_key
+        {
+            static char const key;
+        };
+
+        template <typename ID>
+        char const memo_rule_key<ID>::key = 0;
+
+        template <typename Subject>
+        std::shared_ptr<void const> make_memo_key(Subject const&)
+        {
+            return std::make_shared<char const>(0);
+        }
+
+        template <typename ID, typename Attribute, bool force_attribute>
+        std::shared_ptr<void const>
+        make_memo_key(rule<ID, Attribute, force_attribute> const&)
+        {
+            return std::shared_ptr<void const>(
+                &memo_rule_key<ID>::key, [](void const*) {});
+        }
+
+        // one key per context and attribute type the memoized parser is
+        // called with (they parse differently)
+        template <typename Context, typename Attribute>
+        struct memo_kind
+        {
+            static char const key;
+        };
+
+        template <typename Context, typename Attribute>
+        char const memo_kind<Context, Attribute>::key = 0;
+
+        // a container attribute gets the memoized elements appended, like
+        // it would if the subject parsed into it
+        template <typename Value, typename Attribute>
+        void memo_move_to(Value& value, Attribute& attr, mpl::true_)
+        {
+            traits::append(attr, traits::begin(value), traits::end(value));
+        }
+
+        template <typename Value, typename Attribute>
+        void memo_move_to(Value& value, Attribute& attr, mpl::false_)
+        {
+            traits::move_to(value, attr);
+        }
+
+        template <typename Value, typename Attribute>
+        void memo_move_to(Value& value, Attribute& attr)
+        {
+            memo_move_to(value, attr, mpl::and_<
+                traits::is_container<Value>, traits::is_container<Attribute>>());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // memoize directive: records the result of its subject, at each input
+    // position it is tried at, in the memo table of the context (see
+    // support/utility/memo_table.hpp), and reuses it when tried there
+    // again. Without a memo table in the context, it simply parses its
+    // subject.
+    //
+    // The results of memoize[r], r a rule, are shared by all memoize[r]
+    // (of rules with the same ID).
+    //
+    // Like a rule, the subject parses into an attribute of its own, which
+    // is then passed to the caller. Semantic actions of the subject are
+    // not run again when the result is reused.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct memoize_directive : unary_parser<Subject, memoize_directive<Subject>>
+    {
+        typedef unary_parser<Subject, memoize_directive<Subject> > base_type;
+        static bool const is_pass_through_unary = true;
+        static bool const handles_container = Subject::handles_container;
+
+        typedef Subject subject_type;
+        memoize_directive(Subject const& subject)
+          : base_type(subject)
+          , key(detail::make_memo_key(subject)) {}
+
+        template <typename Iterator, typename Context
+          , typename RContext, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, RContext& rcontext, Attribute& attr) const
+        {
+            return parse_memo(first, last, context, rcontext, attr
+              , x3::get<memo_tag>(context));
+        }
+
+        std::shared_ptr<void const> key;
+
+    private:
+
+        template <typename Iterator, typename Context
+          , typename RContext, typename Attribute>
+        bool parse_memo(Iterator& first, Iterator const& last
+          , Context const& context, RContext& rcontext, Attribute& attr
+          , unused_type) const
+        {
+            return this->subject.parse(first, last, context, rcontext, attr);
+        }
+
+        template <typename Iterator, typename Context
+          , typename RContext, typename Attribute, typename Table>
+        bool parse_memo(Iterator& first, Iterator const& last
+          , Context const& context, RContext& rcontext, Attribute& attr
+          , Table const& table) const
+        {
+            typedef typename
+                traits::attribute_of<Subject, Context>::type
+            attribute_type;
+
+            typedef mpl::bool_<
+                is_same<unused_type, typename remove_const<Attribute>::type>::value
+             || is_same<unused_type, attribute_type>::value>
+            is_unused;
+
+            return parse_memo(first, last, context, rcontext, attr
+              , table.get(), is_unused());
+        }
+
+        template <typename Iterator, typename Context
+          , typename RContext, typename Attribute>
+        bool parse_memo(Iterator& first, Iterator const& last
+          , Context const& context, RContext& rcontext, Attribute& attr
+          , memo_table<Iterator>& memo, mpl::true_) const
+        {
+            void const* const kind = &detail::memo_kind<Context, unused_type>::key;
+            if (auto const* e = memo.find(key.get(), kind, first))
+            {
+                if (e->matched)
+                    first = memo.position(e->end);
+                return e->matched;
+            }
+
+            Iterator i = first;
+            bool const matched = this->subject.parse(i, last, context, rcontext, attr);
+
+            auto& e = memo.store(key.get(), kind, first);
+            e.matched = matched;
+            e.end = memo.offset(i);
+            if (matched)
+                first = i;
+            return matched;
+        }
+
+        template <typename Iterator, typename Context
+          , typename RContext, typename Attribute>
+        bool parse_memo(Iterator& first, Iterator const& last
+          , Context const& context, RContext& rcontext, Attribute& attr
+          , memo_table<Iterator>& memo, mpl::false_) const
+        {
+            typedef typename
+                traits::attribute_of<Subject, Context>::type
+            attribute_type;
+
+            void const* const kind = &detail::memo_kind<Context, attribute_type>::key;
+            if (auto const* e = memo.find(key.get(), kind, first))
+            {
+                if (!e->matched)
+                    return false;
+
+                attribute_type value =
+                    *static_cast<attribute_type const*>(e->value.get());
+                detail::memo_move_to(value, attr);
+                first = memo.position(e->end);
+                return true;
+            }
+
+            Iterator i = first;
+            attribute_type value = attribute_type();
+            bool const matched = this->subject.parse(i, last, context, rcontext, value);
+
+            auto& e = memo.store(key.get(), kind, first);
+            e.matched = matched;
+            e.end = memo.offset(i);
+            if (!matched)
+                return false;
+
+            e.value = std::make_shared<attribute_type>(value);
+            detail::memo_move_to(value, attr);
+            first = i;
+            return true;
+        }
+    };
+
+    struct memoize_gen
+    {
+        template <typename Subject>
+        memoize_directive<typename extension::as_parser<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_parser(subject) };
+        }
+    };
+
+    auto const memoize = memoize_gen{};
+}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject>
+    struct first_set<x3::memoize_directive<Subject>>
+        : subject_first_set<x3::memoize_directive<Subject>> {};
+}}}}
+
+#endif
@@ -9,6 +9,7 @@
 
 #include <boost/spirit/home/x3/support/unused.hpp>
 #include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -48,4 +49,11 @@ namespace boost { namespace spirit { namespace x3
     auto const omit = omit_gen{};
 }}}
 
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject>
+    struct first_set<x3::omit_directive<Subject>>
+        : subject_first_set<x3::omit_directive<Subject>> {};
+}}}}
+
 #endif
@@ -10,6 +10,7 @@
 #include <boost/spirit/home/x3/core/skip_over.hpp>
 #include <boost/spirit/home/x3/core/parser.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 #include <boost/range/iterator_range.hpp>
 
 namespace boost { namespace spirit { namespace x3
@@ -67,4 +68,11 @@ namespace boost { namespace spirit { namespace x3
     auto const raw = raw_gen{};
 }}}
 
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject>
+    struct first_set<x3::raw_directive<Subject>>
+        : subject_first_set<x3::raw_directive<Subject>> {};
+}}}}
+
 #endif
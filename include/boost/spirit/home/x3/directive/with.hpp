@@ -12,6 +12,19 @@
 
 namespace boost { namespace spirit { namespace x3
 {
+    namespace detail
+    {
+        // what is set up for the duration of the parse when a value is
+        // injected with ID: nothing by default (arena.hpp makes an injected
+        // arena the current arena)
+        template <typename ID>
+        struct with_scope
+        {
+            template <typename T>
+            explicit with_scope(T const&) {}
+        };
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // with directive injects a value into the context prior to parsing.
     ///////////////////////////////////////////////////////////////////////////
@@ -55,6 +68,7 @@ namespace boost { namespace spirit { namespace x3
         bool parse(Iterator& first, Iterator const& last
           , Context const& context, RContext& rcontext, Attribute& attr) const
         {
+            detail::with_scope<ID> scope(this->val);
             return this->subject.parse(
                 first, last
               , make_context<ID>(this->val, context)
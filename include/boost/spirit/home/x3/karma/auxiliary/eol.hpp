@@ -0,0 +1,37 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_EOL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_EOL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/karma/detail/generate_to.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // eol generates a newline
+    ///////////////////////////////////////////////////////////////////////////
+    struct eol_generator : generator<eol_generator>
+    {
+        typedef unused_type attribute_type;
+        static bool const has_attribute = false;
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const&) const
+        {
+            return spirit::karma::detail::generate_to(sink, '\n') &&
+                   karma::delimit_out(sink, context);
+        }
+    };
+
+    auto const eol = eol_generator{};
+}}}}
+
+#endif
@@ -0,0 +1,59 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_EPS_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_EPS_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // eps generates nothing (but the delimiter) and always succeeds,
+    // eps(b) succeeds if b is true.
+    ///////////////////////////////////////////////////////////////////////////
+    struct semantic_predicate : generator<semantic_predicate>
+    {
+        typedef unused_type attribute_type;
+        static bool const has_attribute = false;
+
+        semantic_predicate(bool predicate)
+          : predicate(predicate) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const&) const
+        {
+            return predicate && karma::delimit_out(sink, context);
+        }
+
+        bool predicate;
+    };
+
+    struct eps_generator : generator<eps_generator>
+    {
+        typedef unused_type attribute_type;
+        static bool const has_attribute = false;
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const&) const
+        {
+            return karma::delimit_out(sink, context);
+        }
+
+        semantic_predicate operator()(bool predicate) const
+        {
+            return { predicate };
+        }
+    };
+
+    auto const eps = eps_generator{};
+}}}}
+
+#endif
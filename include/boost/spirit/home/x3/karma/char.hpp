@@ -0,0 +1,13 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_CHAR_HPP_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_CHAR_HPP_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/char/char.hpp>
+
+#endif
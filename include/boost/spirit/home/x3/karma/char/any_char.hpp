@@ -0,0 +1,50 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_ANY_CHAR_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_ANY_CHAR_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/char/char_generator.hpp>
+#include <boost/spirit/home/x3/karma/char/literal_char.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    template <typename Encoding>
+    struct any_char : char_generator<any_char<Encoding>>
+    {
+        typedef typename Encoding::char_type char_type;
+        typedef Encoding encoding;
+        typedef char_type attribute_type;
+        static bool const has_attribute = true;
+
+        template <typename Attribute>
+        bool test(Attribute const& attr, char_type& ch) const
+        {
+            ch = char_type(attr);
+            return true;
+        }
+
+        // It is not possible (doesn't make sense) to use char_ without
+        // providing any attribute, as the generator doesn't 'know' what
+        // character to output.
+        bool test(unused_type, char_type&) const = delete;
+
+        template <typename Char>
+        literal_char<Encoding> operator()(Char ch) const
+        {
+            return { ch };
+        }
+
+        template <typename Char>
+        literal_char<Encoding> operator()(const Char (&ch)[2]) const
+        {
+            return { ch[0] };
+        }
+    };
+}}}}
+
+#endif
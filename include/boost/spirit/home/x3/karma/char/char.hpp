@@ -0,0 +1,118 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_CHAR_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_CHAR_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/char/any_char.hpp>
+#include <boost/spirit/home/x3/karma/char/literal_char.hpp>
+#include <boost/spirit/home/support/char_encoding/standard.hpp>
+#include <boost/spirit/home/support/char_encoding/standard_wide.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    namespace standard
+    {
+        typedef any_char<char_encoding::standard> char_type;
+        auto const char_ = char_type{};
+
+        inline literal_char<char_encoding::standard, unused_type>
+        lit(char ch)
+        {
+            return { ch };
+        }
+    }
+
+    using standard::char_type;
+    using standard::char_;
+    using standard::lit;
+
+#ifndef BOOST_SPIRIT_NO_STANDARD_WIDE
+    namespace standard_wide
+    {
+        typedef any_char<char_encoding::standard_wide> char_type;
+        auto const char_ = char_type{};
+
+        inline literal_char<char_encoding::standard_wide, unused_type>
+        lit(wchar_t ch)
+        {
+            return { ch };
+        }
+    }
+
+    using standard_wide::lit;
+#endif
+
+    namespace extension
+    {
+        template <>
+        struct as_generator<char>
+        {
+            typedef literal_char<
+                char_encoding::standard, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(char ch)
+            {
+                return { ch };
+            }
+        };
+
+#ifndef BOOST_SPIRIT_NO_STANDARD_WIDE
+        template <>
+        struct as_generator<wchar_t>
+        {
+            typedef literal_char<
+                char_encoding::standard_wide, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(wchar_t ch)
+            {
+                return { ch };
+            }
+        };
+#endif
+
+        template <>
+        struct as_generator<char [2]>
+        {
+            typedef literal_char<
+                char_encoding::standard, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(char const ch[])
+            {
+                return { ch[0] };
+            }
+        };
+
+#ifndef BOOST_SPIRIT_NO_STANDARD_WIDE
+        template <>
+        struct as_generator<wchar_t [2]>
+        {
+            typedef literal_char<
+                char_encoding::standard_wide, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(wchar_t const ch[] )
+            {
+                return { ch[0] };
+            }
+        };
+#endif
+    }
+}}}}
+
+#endif
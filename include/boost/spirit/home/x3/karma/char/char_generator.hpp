@@ -0,0 +1,49 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_CHAR_GENERATOR_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_CHAR_GENERATOR_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/x3/karma/support/case_modifier.hpp>
+#include <boost/spirit/home/x3/karma/support/optional_value.hpp>
+#include <boost/spirit/home/karma/detail/generate_to.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The base class for the single character generators: Derived::test()
+    // yields the character to generate from the attribute (or fails).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Derived>
+    struct char_generator : generator<Derived>
+    {
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            typedef typename Derived::encoding encoding;
+            typedef char_conversion<encoding, Context> conversion;
+
+            // fail if it's an uninitialized optional
+            typename Derived::char_type ch = 0;
+            if (!detail::has_optional_value(attr) ||
+                !this->derived().test(detail::optional_value(attr), ch))
+            {
+                return false;
+            }
+
+            return spirit::karma::detail::generate_to(sink, ch
+                  , typename conversion::encoding()
+                  , typename conversion::tag()) &&
+                   karma::delimit_out(sink, context);
+        }
+    };
+}}}}
+
+#endif
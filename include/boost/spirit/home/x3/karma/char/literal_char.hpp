@@ -0,0 +1,63 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_LITERAL_CHAR_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_LITERAL_CHAR_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/char/char_generator.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    // A literal character: lit('x') generates its character without an
+    // attribute, char_('x') takes an attribute and fails unless the attribute
+    // is that character.
+    template <typename Encoding, typename Attribute = typename Encoding::char_type>
+    struct literal_char : char_generator<literal_char<Encoding, Attribute>>
+    {
+        typedef typename Encoding::char_type char_type;
+        typedef Encoding encoding;
+        typedef Attribute attribute_type;
+        static bool const has_attribute =
+            !is_same<unused_type, attribute_type>::value;
+
+        template <typename Char>
+        literal_char(Char ch)
+          : ch(static_cast<char_type>(ch)) {}
+
+        template <typename Attribute_>
+        bool test(Attribute_ const& attr, char_type& ch_) const
+        {
+            ch_ = ch;
+            return matches(attr, mpl::bool_<has_attribute>());
+        }
+
+        bool test(unused_type, char_type& ch_) const
+        {
+            ch_ = ch;
+            return true;
+        }
+
+        template <typename Attribute_>
+        bool matches(Attribute_ const& attr, mpl::true_) const
+        {
+            return ch == char_type(attr);
+        }
+
+        // lit() ignores the attribute supplied
+        template <typename Attribute_>
+        bool matches(Attribute_ const&, mpl::false_) const
+        {
+            return true;
+        }
+
+        char_type ch;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,109 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_ACTION_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_ACTION_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/utility/is_callable.hpp>
+#include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/spirit/home/x3/core/action.hpp>
+#include <boost/spirit/home/x3/core/call.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/utility/declval.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The semantic action of a generator is invoked before its subject: it
+    // may provide (or modify) the attribute to generate, using _attr(ctx),
+    // or fail the generator, using _pass(ctx) (both as for X3 parsers).
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename Attribute, typename Attribute_>
+        inline Attribute make_action_attribute(Attribute_ const& attr)
+        {
+            return Attribute(attr);
+        }
+
+        template <typename Attribute>
+        inline Attribute make_action_attribute(unused_type)
+        {
+            return Attribute();
+        }
+    }
+
+    template <typename Subject, typename Action>
+    struct action : unary_generator<Subject, action<Subject, Action>>
+    {
+        typedef unary_generator<Subject, action<Subject, Action>> base_type;
+        static bool const is_pass_through_unary = true;
+        static bool const has_action = true;
+
+        action(Subject const& subject, Action f)
+          : base_type(subject), f(f) {}
+
+        template <typename Context>
+        struct action_attribute
+          : remove_const<typename
+                traits::attribute_of<Subject, Context>::type> {};
+
+        template <typename Context>
+        struct action_context
+        {
+            typedef decltype(make_context<attr_context_tag>(
+                boost::declval<typename action_attribute<Context>::type&>()
+              , make_context<parse_pass_context_tag>(
+                    boost::declval<bool&>(), boost::declval<Context const&>())))
+            type;
+        };
+
+        // the action wants to see the attribute, hand it a copy
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate_main(OutputIterator& sink, Context const& context
+          , Attribute const& attr_, mpl::true_) const
+        {
+            typedef typename action_attribute<Context>::type attribute_type;
+            attribute_type attr =
+                detail::make_action_attribute<attribute_type>(attr_);
+
+            bool pass = true;
+            auto pass_context = make_context<parse_pass_context_tag>(
+                pass, context);
+            auto attr_context = make_context<attr_context_tag>(
+                attr, pass_context);
+            f(attr_context);
+
+            return pass && this->subject.generate(sink, context, attr);
+        }
+
+        // the action doesn't take the context, the attribute is passed on
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate_main(OutputIterator& sink, Context const& context
+          , Attribute const& attr, mpl::false_) const
+        {
+            f();
+            return this->subject.generate(sink, context, attr);
+        }
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            typedef typename action_context<Context>::type context_type;
+            return generate_main(sink, context, attr
+              , is_callable<Action(context_type const&)>());
+        }
+
+        Action f;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,59 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_DELIMIT_OUT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_DELIMIT_OUT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/utility/declval.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    // the delimiter is stored in the context under this tag
+    struct delimiter_tag;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Generate the delimiter (if any) after the output of a primitive
+    // generator. The function is a no-op if unused_type is passed as the
+    // delimiter.
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename OutputIterator, typename Delimiter>
+        inline bool delimit_out(OutputIterator& sink, Delimiter const& d)
+        {
+            return d.generate(sink, unused, unused);
+        }
+
+        template <typename OutputIterator>
+        inline bool delimit_out(OutputIterator&, unused_type)
+        {
+            return true;
+        }
+    }
+
+    template <typename OutputIterator, typename Context>
+    inline bool delimit_out(OutputIterator& sink, Context const& context)
+    {
+        return detail::delimit_out(sink, x3::get<delimiter_tag>(context));
+    }
+
+    template <typename Context>
+    struct has_delimiter
+      : mpl::not_<is_same<unused_type
+          , typename remove_cv<typename remove_reference<
+                decltype(x3::get<delimiter_tag>(boost::declval<Context>()))
+            >::type>::type>> {};
+}}}}
+
+#endif
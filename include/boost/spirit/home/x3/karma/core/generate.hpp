@@ -0,0 +1,200 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_GENERATE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_GENERATE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/utility/declval.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The sink handed to the generators: the output iterator of Spirit.Karma
+    // wrapping the user supplied one, providing just the services needed by
+    // the properties of the generator. Rules require all of them (their
+    // definition is not known where they are referenced), so this is the
+    // type to use with BOOST_SPIRIT_KARMA_INSTANTIATE by default.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator
+      , int Properties = generator_properties::all_properties>
+    using output_iterator = spirit::karma::detail::output_iterator<
+        OutputIterator, mpl::int_<Properties>>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Attribute>
+    inline bool
+    generate_main(
+        OutputIterator& sink_
+      , Generator const& g
+      , Attribute const& attr)
+    {
+        // If you get an error no matching function for call to 'as_generator'
+        // here, then g is not a generator or there is no suitable conversion
+        // from g to a generator.
+        typedef typename extension::as_generator<Generator>::value_type
+            generator_type;
+
+        output_iterator<OutputIterator, generator_type::properties> sink(sink_);
+        return as_generator(g).generate(sink, unused, attr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Attribute>
+    inline bool
+    generate(
+        OutputIterator& sink
+      , Generator const& g
+      , Attribute const& attr)
+    {
+        return generate_main(sink, g, attr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Attribute>
+    inline bool
+    generate(
+        OutputIterator const& sink_
+      , Generator const& g
+      , Attribute const& attr)
+    {
+        OutputIterator sink = sink_;
+        return generate_main(sink, g, attr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator>
+    inline bool
+    generate(
+        OutputIterator& sink
+      , Generator const& g)
+    {
+        return generate_main(sink, g, unused);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator>
+    inline bool
+    generate(
+        OutputIterator const& sink_
+      , Generator const& g)
+    {
+        OutputIterator sink = sink_;
+        return generate_main(sink, g, unused);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class delimit_flag
+    {
+        predelimit,         // force predelimiting in generate_delimited()
+        dont_predelimit     // inhibit predelimiting in generate_delimited()
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Delimiter
+      , typename Attribute>
+    inline bool
+    generate_delimited_main(
+        OutputIterator& sink_
+      , Generator const& g
+      , Delimiter const& d
+      , Attribute const& attr
+      , delimit_flag pre_delimit = delimit_flag::dont_predelimit)
+    {
+        // If you get an error no matching function for call to 'as_generator'
+        // here, for either g or d, then g or d is not a generator or there is
+        // no suitable conversion from g to a generator.
+        typedef typename extension::as_generator<Generator>::value_type
+            generator_type;
+        typedef typename extension::as_generator<Delimiter>::value_type
+            delimiter_type;
+
+        output_iterator<OutputIterator
+          , generator_type::properties | delimiter_type::properties>
+        sink(sink_);
+
+        auto const& delimiter = as_generator(d);
+        if (pre_delimit == delimit_flag::predelimit &&
+            !detail::delimit_out(sink, delimiter))
+        {
+            return false;
+        }
+
+        auto delimiter_ctx = make_context<delimiter_tag>(delimiter);
+        return as_generator(g).generate(sink, delimiter_ctx, attr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Delimiter
+      , typename Attribute>
+    inline bool
+    generate_delimited(
+        OutputIterator& sink
+      , Generator const& g
+      , Delimiter const& d
+      , Attribute const& attr
+      , delimit_flag pre_delimit = delimit_flag::dont_predelimit)
+    {
+        return generate_delimited_main(sink, g, d, attr, pre_delimit);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Delimiter
+      , typename Attribute>
+    inline bool
+    generate_delimited(
+        OutputIterator const& sink_
+      , Generator const& g
+      , Delimiter const& d
+      , Attribute const& attr
+      , delimit_flag pre_delimit = delimit_flag::dont_predelimit)
+    {
+        OutputIterator sink = sink_;
+        return generate_delimited_main(sink, g, d, attr, pre_delimit);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Delimiter>
+    inline bool
+    generate_delimited(
+        OutputIterator& sink
+      , Generator const& g
+      , Delimiter const& d
+      , delimit_flag pre_delimit = delimit_flag::dont_predelimit)
+    {
+        return generate_delimited_main(sink, g, d, unused, pre_delimit);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename OutputIterator, typename Generator, typename Delimiter>
+    inline bool
+    generate_delimited(
+        OutputIterator const& sink_
+      , Generator const& g
+      , Delimiter const& d
+      , delimit_flag pre_delimit = delimit_flag::dont_predelimit)
+    {
+        OutputIterator sink = sink_;
+        return generate_delimited_main(sink, g, d, unused, pre_delimit);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Delimiter>
+    struct generate_delimited_context
+    {
+        typedef decltype(
+            make_context<delimiter_tag>(
+                as_generator(boost::declval<Delimiter const&>())))
+        type;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,176 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_GENERATOR_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_GENERATOR_OCT_17_2016_0900AM
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_base_of.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/has_attribute.hpp>
+#include <boost/spirit/home/karma/generator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    // The generators are the Spirit.Karma generators without Boost.Proto:
+    // every generator is an object of its own type, and expressions are
+    // built by plain operator overloads on these objects (as for X3 parsers).
+    //
+    // Requirement: g.generate(sink, context, attr) -> bool
+    //
+    //  g:          a generator
+    //  sink:       the output iterator (always a wrapped
+    //              spirit::karma::detail::output_iterator, see generate.hpp)
+    //  context:    the context chain (delimiter, rule attribute etc.)
+    //  attr:       the attribute to generate from (unused if none)
+    //
+    // The properties are those of spirit::karma::generator_properties, they
+    // tell which services (buffering, counting, disabling) the wrapped
+    // output iterator has to provide for the whole expression.
+
+    typedef spirit::karma::generator_properties generator_properties;
+
+    template <typename Subject, typename Action>
+    struct action;
+
+    struct generator_base {};
+
+    template <typename Derived>
+    struct generator : generator_base
+    {
+        typedef Derived derived_type;
+        static bool const handles_container = false;
+        static bool const is_pass_through_unary = false;
+        static bool const has_action = false;
+        static int const properties = generator_properties::no_properties;
+
+        Derived const& derived() const
+        {
+            return *static_cast<Derived const*>(this);
+        }
+
+        template <typename Action>
+        action<Derived, Action> operator[](Action f) const
+        {
+            return { this->derived(), f };
+        }
+    };
+
+    struct unary_category;
+    struct binary_category;
+
+    template <typename Subject, typename Derived>
+    struct unary_generator : generator<Derived>
+    {
+        typedef unary_category category;
+        typedef Subject subject_type;
+        static bool const has_action = Subject::has_action;
+        static int const properties = Subject::properties;
+
+        unary_generator(Subject const& subject)
+            : subject(subject) {}
+
+        unary_generator const& get_unary() const { return *this; }
+
+        Subject subject;
+    };
+
+    template <typename Left, typename Right, typename Derived>
+    struct binary_generator : generator<Derived>
+    {
+        typedef binary_category category;
+        typedef Left left_type;
+        typedef Right right_type;
+        static bool const has_action =
+            left_type::has_action || right_type::has_action;
+        static int const properties =
+            left_type::properties | right_type::properties;
+
+        binary_generator(Left const& left, Right const& right)
+            : left(left), right(right) {}
+
+        binary_generator const& get_binary() const { return *this; }
+
+        Left left;
+        Right right;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // as_generator: convert a type, T, into a generator.
+    ///////////////////////////////////////////////////////////////////////////
+    namespace extension
+    {
+        template <typename T, typename Enable = void>
+        struct as_generator {};
+
+        template <>
+        struct as_generator<unused_type>
+        {
+            typedef unused_type type;
+            typedef unused_type value_type;
+            static type call(unused_type)
+            {
+                return unused;
+            }
+        };
+
+        template <typename Derived>
+        struct as_generator<Derived
+            , typename enable_if<is_base_of<generator_base, Derived>>::type>
+        {
+            typedef Derived const& type;
+            typedef Derived value_type;
+            static type call(Derived const& g)
+            {
+                return g;
+            }
+        };
+
+        template <typename Derived>
+        struct as_generator<generator<Derived>>
+        {
+            typedef Derived const& type;
+            typedef Derived value_type;
+            static type call(generator<Derived> const& g)
+            {
+                return g.derived();
+            }
+        };
+    }
+
+    template <typename T>
+    inline typename extension::as_generator<T>::type
+    as_generator(T const& x)
+    {
+        return extension::as_generator<T>::call(x);
+    }
+
+    template <typename Derived>
+    inline Derived const&
+    as_generator(generator<Derived> const& g)
+    {
+        return g.derived();
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject, typename Derived, typename Context>
+    struct has_attribute<x3::karma::unary_generator<Subject, Derived>, Context>
+        : has_attribute<Subject, Context> {};
+
+    template <typename Left, typename Right, typename Derived, typename Context>
+    struct has_attribute<
+            x3::karma::binary_generator<Left, Right, Derived>, Context>
+        : mpl::bool_<has_attribute<Left, Context>::value ||
+                has_attribute<Right, Context>::value> {};
+}}}}
+
+#endif
@@ -0,0 +1,22 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_DIRECTIVE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_DIRECTIVE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/directive/left_alignment.hpp>
+#include <boost/spirit/home/x3/karma/directive/right_alignment.hpp>
+#include <boost/spirit/home/x3/karma/directive/center_alignment.hpp>
+#include <boost/spirit/home/x3/karma/directive/maxwidth.hpp>
+#include <boost/spirit/home/x3/karma/directive/buffer.hpp>
+#include <boost/spirit/home/x3/karma/directive/omit.hpp>
+#include <boost/spirit/home/x3/karma/directive/delimit.hpp>
+#include <boost/spirit/home/x3/karma/directive/verbatim.hpp>
+#include <boost/spirit/home/x3/karma/directive/upper_lower_case.hpp>
+#include <boost/spirit/home/x3/karma/directive/repeat.hpp>
+
+#endif
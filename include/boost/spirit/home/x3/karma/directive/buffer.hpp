@@ -0,0 +1,63 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_BUFFER_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_BUFFER_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // buffer[g]: the output of g is emitted only if g succeeds
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct buffer_directive : unary_generator<Subject, buffer_directive<Subject>>
+    {
+        typedef unary_generator<Subject, buffer_directive<Subject>> base_type;
+        static bool const is_pass_through_unary = true;
+        static int const properties = generator_properties::countingbuffer |
+            Subject::properties;
+
+        buffer_directive(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            // wrap the given output iterator to avoid output as long as the
+            // embedded generator (subject) fails
+            spirit::karma::detail::enable_buffering<OutputIterator>
+                buffering(sink);
+            bool r = false;
+            {
+                spirit::karma::detail::disable_counting<OutputIterator>
+                    nocounting(sink);
+                r = this->subject.generate(sink, context, attr);
+            }
+            if (r)
+                buffering.buffer_copy();
+            return r;
+        }
+    };
+
+    struct buffer_gen
+    {
+        template <typename Subject>
+        buffer_directive<typename extension::as_generator<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject) };
+        }
+    };
+
+    auto const buffer = buffer_gen{};
+}}}}
+
+#endif
@@ -0,0 +1,84 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_CENTER_ALIGNMENT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_CENTER_ALIGNMENT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/directive/detail/alignment.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+#include <boost/spirit/home/support/attributes_fwd.hpp>
+#include <algorithm>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // center[g]: the output of g is surrounded by the padding, the field
+    // width is split evenly
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Padding>
+    struct center_alignment : detail::alignment_directive<
+        Subject, Padding, center_alignment<Subject, Padding>>
+    {
+        typedef detail::alignment_directive<
+            Subject, Padding, center_alignment<Subject, Padding>> base_type;
+        static int const properties = generator_properties::countingbuffer |
+            Subject::properties | Padding::properties;
+
+        center_alignment(Subject const& subject, unsigned int width
+              , Padding const& padding)
+          : base_type(subject, width, padding) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            // wrap the given output iterator to allow generating both the
+            // paddings
+            spirit::karma::detail::enable_buffering<OutputIterator>
+                buffering(sink, this->width);
+            bool r = false;
+
+            // first generate the embedded output
+            {
+                spirit::karma::detail::disable_counting<OutputIterator>
+                    nocounting(sink);
+                r = this->subject.generate(sink, context, attr);
+            }   // re-enable counting
+
+            buffering.disable();    // do not perform buffering any more
+
+            // the whole field is known now, let the sink prepare for it
+            spirit::traits::reserve_sink(sink, (std::max)(
+                std::size_t(this->width), buffering.buffer_size()));
+
+            // generate the left padding
+            spirit::karma::detail::enable_counting<OutputIterator>
+                counting(sink);
+
+            std::size_t const pre =
+                this->width - (buffering.buffer_size() + this->width)/2;
+            while (r && counting.count() < pre)
+                r = this->padding.generate(sink, unused, unused);
+
+            if (r)
+            {
+                // copy the embedded output to the target output iterator
+                buffering.buffer_copy();
+
+                // generate the right padding
+                while (r && counting.count() < this->width)
+                    r = this->padding.generate(sink, unused, unused);
+            }
+            return r;
+        }
+    };
+
+    auto const center = detail::alignment_gen<center_alignment>{};
+}}}}
+
+#endif
@@ -0,0 +1,82 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_DELIMIT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_DELIMIT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/x3/karma/directive/detail/alignment.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // delimit[g]: g is delimited by spaces, delimit(d)[g]: g is delimited
+    // by the generator d (both replace the current delimiter, if any)
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Delimiter>
+    struct delimit_directive : unary_generator<Subject
+      , delimit_directive<Subject, Delimiter>>
+    {
+        typedef unary_generator<Subject, delimit_directive<Subject, Delimiter>>
+            base_type;
+        static bool const is_pass_through_unary = true;
+        static int const properties =
+            Subject::properties | Delimiter::properties;
+
+        delimit_directive(Subject const& subject, Delimiter const& delimiter)
+          : base_type(subject), delimiter(delimiter) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            return this->subject.generate(sink
+              , make_context<delimiter_tag>(delimiter, context), attr);
+        }
+
+        Delimiter delimiter;
+    };
+
+    struct delimit_gen
+    {
+        template <typename Delimiter>
+        struct delimit_gen_lvl1
+        {
+            template <typename Subject>
+            delimit_directive<
+                typename extension::as_generator<Subject>::value_type
+              , Delimiter>
+            operator[](Subject const& subject) const
+            {
+                return { as_generator(subject), delimiter };
+            }
+
+            Delimiter delimiter;
+        };
+
+        template <typename Subject>
+        delimit_directive<typename extension::as_generator<Subject>::value_type
+          , detail::default_padding_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject), detail::default_padding_type(' ') };
+        }
+
+        template <typename Delimiter>
+        delimit_gen_lvl1<typename extension::as_generator<Delimiter>::value_type>
+        operator()(Delimiter const& delimiter) const
+        {
+            return { as_generator(delimiter) };
+        }
+    };
+
+    auto const delimit = delimit_gen{};
+}}}}
+
+#endif
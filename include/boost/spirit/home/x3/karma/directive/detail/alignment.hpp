@@ -0,0 +1,105 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_ALIGNMENT_DETAIL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_ALIGNMENT_DETAIL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/char/literal_char.hpp>
+#include <boost/spirit/home/karma/detail/default_width.hpp>
+#include <boost/spirit/home/support/char_encoding/standard.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/utility/enable_if.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma {
+    namespace detail
+{
+    // the padding used if none is given: spaces
+    typedef literal_char<char_encoding::standard, unused_type>
+        default_padding_type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The directive objects of left_align, right_align and center:
+    //
+    //  xxx[g]          BOOST_KARMA_DEFAULT_FIELD_LENGTH wide, padded by spaces
+    //  xxx(w)[g]       w wide, padded by spaces
+    //  xxx(p)[g]       BOOST_KARMA_DEFAULT_FIELD_LENGTH wide, padded by p
+    //  xxx(w, p)[g]    w wide, padded by p
+    ///////////////////////////////////////////////////////////////////////////
+    template <template <typename, typename> class Directive, typename Padding>
+    struct alignment_gen_lvl1
+    {
+        template <typename Subject>
+        Directive<typename extension::as_generator<Subject>::value_type, Padding>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject), width, padding };
+        }
+
+        unsigned int width;
+        Padding padding;
+    };
+
+    template <template <typename, typename> class Directive>
+    struct alignment_gen
+    {
+        template <typename Subject>
+        Directive<typename extension::as_generator<Subject>::value_type
+          , default_padding_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject), BOOST_KARMA_DEFAULT_FIELD_LENGTH
+              , default_padding_type(' ') };
+        }
+
+        template <typename Width>
+        typename enable_if<is_integral<Width>
+          , alignment_gen_lvl1<Directive, default_padding_type>>::type
+        operator()(Width width) const
+        {
+            return { static_cast<unsigned int>(width)
+              , default_padding_type(' ') };
+        }
+
+        template <typename Padding>
+        typename disable_if<is_integral<Padding>
+          , alignment_gen_lvl1<Directive
+              , typename extension::as_generator<Padding>::value_type>>::type
+        operator()(Padding const& padding) const
+        {
+            return { BOOST_KARMA_DEFAULT_FIELD_LENGTH, as_generator(padding) };
+        }
+
+        template <typename Padding>
+        alignment_gen_lvl1<Directive
+          , typename extension::as_generator<Padding>::value_type>
+        operator()(unsigned int width, Padding const& padding) const
+        {
+            return { width, as_generator(padding) };
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The base of the alignment directives: the subject, the width and the
+    // padding generator. The padding is generated without delimiting.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Padding, typename Derived>
+    struct alignment_directive : unary_generator<Subject, Derived>
+    {
+        typedef unary_generator<Subject, Derived> base_type;
+        static bool const is_pass_through_unary = true;
+
+        alignment_directive(Subject const& subject, unsigned int width
+              , Padding const& padding)
+          : base_type(subject), width(width), padding(padding) {}
+
+        unsigned int width;
+        Padding padding;
+    };
+}}}}}
+
+#endif
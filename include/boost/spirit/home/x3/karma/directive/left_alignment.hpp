@@ -0,0 +1,56 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_LEFT_ALIGNMENT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_LEFT_ALIGNMENT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/directive/detail/alignment.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // left_align[g]: the output of g is followed by the padding until the
+    // field width is reached
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Padding>
+    struct left_alignment : detail::alignment_directive<
+        Subject, Padding, left_alignment<Subject, Padding>>
+    {
+        typedef detail::alignment_directive<
+            Subject, Padding, left_alignment<Subject, Padding>> base_type;
+        static int const properties = generator_properties::counting |
+            Subject::properties | Padding::properties;
+
+        left_alignment(Subject const& subject, unsigned int width
+              , Padding const& padding)
+          : base_type(subject, width, padding) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            // wrap the given output iterator to allow counting
+            spirit::karma::detail::enable_counting<OutputIterator>
+                counting(sink);
+
+            // first generate the underlying output
+            bool r = this->subject.generate(sink, context, attr);
+
+            // pad the output until the max width is reached
+            while (r && counting.count() < this->width)
+                r = this->padding.generate(sink, unused, unused);
+
+            return r;
+        }
+    };
+
+    auto const left_align = detail::alignment_gen<left_alignment>{};
+}}}}
+
+#endif
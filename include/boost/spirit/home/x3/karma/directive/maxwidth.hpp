@@ -0,0 +1,124 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_MAXWIDTH_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_MAXWIDTH_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+#include <boost/spirit/home/karma/detail/default_width.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    namespace detail
+    {
+        template <typename OutputIterator, typename RestIterator>
+        bool buffer_copy_rest(
+            spirit::karma::detail::enable_buffering<OutputIterator>& buff
+          , std::size_t start_at, RestIterator* dest)
+        {
+            return buff.buffer_copy_rest(*dest, start_at);
+        }
+
+        template <typename OutputIterator>
+        bool buffer_copy_rest(
+            spirit::karma::detail::enable_buffering<OutputIterator>&
+          , std::size_t, unused_type)
+        {
+            return true;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // maxwidth[g], maxwidth(w)[g]: the output of g is truncated to the
+    // maximal width (BOOST_KARMA_DEFAULT_FIELD_MAXWIDTH if not given).
+    // maxwidth(w, rest)[g]: the truncated output is written to the output
+    // iterator rest (which is held by reference).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Rest = unused_type>
+    struct maxwidth_directive : unary_generator<Subject
+      , maxwidth_directive<Subject, Rest>>
+    {
+        typedef unary_generator<Subject, maxwidth_directive<Subject, Rest>>
+            base_type;
+        static bool const is_pass_through_unary = true;
+        static int const properties = generator_properties::countingbuffer |
+            Subject::properties;
+
+        maxwidth_directive(Subject const& subject, unsigned int width
+              , Rest rest = Rest())
+          : base_type(subject), width(width), rest(rest) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            // wrap the given output iterator to allow buffering, but disable
+            // counting
+            spirit::karma::detail::enable_buffering<OutputIterator>
+                buffering(sink);
+
+            // generate the underlying output and copy the embedded
+            // output to the target output iterator applying the given
+            // maxwidth
+            bool r = false;
+            {
+                spirit::karma::detail::disable_counting<OutputIterator>
+                    nocounting(sink);
+                r = this->subject.generate(sink, context, attr);
+            }   // re-enable counting
+
+            return r && buffering.buffer_copy(width) &&
+                   detail::buffer_copy_rest(buffering, width, rest);
+        }
+
+        unsigned int width;
+        Rest rest;
+    };
+
+    struct maxwidth_gen
+    {
+        template <typename Subject>
+        maxwidth_directive<typename extension::as_generator<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject), BOOST_KARMA_DEFAULT_FIELD_MAXWIDTH };
+        }
+
+        template <typename Rest>
+        struct maxwidth_gen_lvl1
+        {
+            template <typename Subject>
+            maxwidth_directive<
+                typename extension::as_generator<Subject>::value_type, Rest>
+            operator[](Subject const& subject) const
+            {
+                return { as_generator(subject), width, rest };
+            }
+
+            unsigned int width;
+            Rest rest;
+        };
+
+        maxwidth_gen_lvl1<unused_type>
+        operator()(unsigned int width) const
+        {
+            return { width, unused };
+        }
+
+        template <typename RestIterator>
+        maxwidth_gen_lvl1<RestIterator*>
+        operator()(unsigned int width, RestIterator& rest) const
+        {
+            return { width, &rest };
+        }
+    };
+
+    auto const maxwidth = maxwidth_gen{};
+}}}}
+
+#endif
@@ -0,0 +1,78 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_OMIT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_OMIT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // omit[g] consumes the attribute of g without generating anything,
+    // skip[g] neither consumes an attribute nor generates anything.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct omit_directive : unary_generator<Subject, omit_directive<Subject>>
+    {
+        typedef unary_generator<Subject, omit_directive<Subject>> base_type;
+        static bool const is_pass_through_unary = true;
+        static int const properties = generator_properties::no_properties;
+
+        omit_directive(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator&, Context const&, Attribute const&) const
+        {
+            return true;
+        }
+    };
+
+    template <typename Subject>
+    struct skip_directive : unary_generator<Subject, skip_directive<Subject>>
+    {
+        typedef unary_generator<Subject, skip_directive<Subject>> base_type;
+        typedef unused_type attribute_type;
+        static bool const has_attribute = false;
+        static int const properties = generator_properties::no_properties;
+
+        skip_directive(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator&, Context const&, Attribute const&) const
+        {
+            return true;
+        }
+    };
+
+    struct omit_gen
+    {
+        template <typename Subject>
+        omit_directive<typename extension::as_generator<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject) };
+        }
+    };
+
+    struct skip_gen
+    {
+        template <typename Subject>
+        skip_directive<typename extension::as_generator<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject) };
+        }
+    };
+
+    auto const omit = omit_gen{};
+    auto const skip = skip_gen{};
+}}}}
+
+#endif
@@ -0,0 +1,142 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_REPEAT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_REPEAT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/x3/directive/repeat.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/operator/kleene.hpp>
+#include <boost/spirit/home/x3/karma/operator/detail/container.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // repeat[g]: as *g
+    // repeat(n)[g], repeat(min, max)[g], repeat(min, inf)[g]: at least min
+    // items of the container attribute have to be generated, the rest is
+    // generated up to the maximum. Without an attribute g is generated the
+    // minimal number of times.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename RepeatCountLimit>
+    struct repeat_directive : unary_generator<Subject
+      , repeat_directive<Subject, RepeatCountLimit>>
+    {
+        typedef unary_generator<Subject
+          , repeat_directive<Subject, RepeatCountLimit>> base_type;
+        static bool const handles_container = true;
+
+        repeat_directive(Subject const& subject
+              , RepeatCountLimit const& repeat_limit_)
+          : base_type(subject), repeat_limit(repeat_limit_) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            auto first = traits::begin(attr);
+            auto last = traits::end(attr);
+
+            // generate the minimal required amount of output
+            typename RepeatCountLimit::type i{};
+            for (/**/; !repeat_limit.got_min(i); ++i, ++first)
+            {
+                if (first == last || !detail::generate_item(
+                        this->subject, sink, context, *first))
+                {
+                    return false;
+                }
+            }
+
+            // generate some more up to the maximum specified
+            for (/**/; first != last && !repeat_limit.got_max(i); ++first)
+            {
+                if (detail::generate_item(this->subject, sink, context, *first))
+                    ++i;
+            }
+            return spirit::karma::detail::sink_is_good(sink);
+        }
+
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const
+        {
+            typename RepeatCountLimit::type i{};
+            for (/**/; !repeat_limit.got_min(i); ++i)
+            {
+                if (!this->subject.generate(sink, context, unused))
+                    return false;
+            }
+            return spirit::karma::detail::sink_is_good(sink);
+        }
+
+        RepeatCountLimit repeat_limit;
+    };
+
+    using x3::inf_type;
+    using x3::inf;
+
+    struct repeat_gen
+    {
+        template <typename Subject>
+        kleene<typename extension::as_generator<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject) };
+        }
+
+        template <typename T>
+        struct repeat_gen_lvl1
+        {
+            template <typename Subject>
+            repeat_directive<
+                typename extension::as_generator<Subject>::value_type, T>
+            operator[](Subject const& subject) const
+            {
+                return { as_generator(subject), repeat_limit };
+            }
+
+            T repeat_limit;
+        };
+
+        template <typename T>
+        repeat_gen_lvl1<x3::detail::exact_count<T>>
+        operator()(T const exact) const
+        {
+            return { x3::detail::exact_count<T>{exact} };
+        }
+
+        template <typename T>
+        repeat_gen_lvl1<x3::detail::finite_count<T>>
+        operator()(T const min_val, T const max_val) const
+        {
+            return { x3::detail::finite_count<T>{min_val, max_val} };
+        }
+
+        template <typename T>
+        repeat_gen_lvl1<x3::detail::infinite_count<T>>
+        operator()(T const min_val, inf_type const&) const
+        {
+            return { x3::detail::infinite_count<T>{min_val} };
+        }
+    };
+
+    auto const repeat = repeat_gen{};
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject, typename RepeatCountLimit, typename Context>
+    struct attribute_of<
+            x3::karma::repeat_directive<Subject, RepeatCountLimit>, Context>
+      : build_container<typename attribute_of<Subject, Context>::type> {};
+}}}}
+
+#endif
@@ -0,0 +1,74 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_RIGHT_ALIGNMENT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_RIGHT_ALIGNMENT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/directive/detail/alignment.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+#include <boost/spirit/home/support/attributes_fwd.hpp>
+#include <algorithm>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // right_align[g]: the padding is generated before the output of g until
+    // the field width is reached
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename Padding>
+    struct right_alignment : detail::alignment_directive<
+        Subject, Padding, right_alignment<Subject, Padding>>
+    {
+        typedef detail::alignment_directive<
+            Subject, Padding, right_alignment<Subject, Padding>> base_type;
+        static int const properties = generator_properties::countingbuffer |
+            Subject::properties | Padding::properties;
+
+        right_alignment(Subject const& subject, unsigned int width
+              , Padding const& padding)
+          : base_type(subject, width, padding) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            // wrap the given output iterator to allow left padding
+            spirit::karma::detail::enable_buffering<OutputIterator>
+                buffering(sink, this->width);
+            bool r = false;
+
+            // first generate the embedded output
+            {
+                spirit::karma::detail::disable_counting<OutputIterator>
+                    nocounting(sink);
+                r = this->subject.generate(sink, context, attr);
+            }   // re-enable counting
+
+            buffering.disable();    // do not perform buffering any more
+
+            // the whole field is known now, let the sink prepare for it
+            spirit::traits::reserve_sink(sink, (std::max)(
+                std::size_t(this->width), buffering.buffer_size()));
+
+            // generate the left padding
+            spirit::karma::detail::enable_counting<OutputIterator>
+                counting(sink, buffering.buffer_size());
+            while (r && counting.count() < this->width)
+                r = this->padding.generate(sink, unused, unused);
+
+            // copy the buffered output to the target output iterator
+            if (r)
+                buffering.buffer_copy();
+            return r;
+        }
+    };
+
+    auto const right_align = detail::alignment_gen<right_alignment>{};
+}}}}
+
+#endif
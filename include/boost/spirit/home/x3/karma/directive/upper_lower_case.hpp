@@ -0,0 +1,59 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_UPPER_LOWER_CASE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_UPPER_LOWER_CASE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/support/case_modifier.hpp>
+#include <boost/spirit/home/support/char_class.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // upper[g], lower[g]: all characters generated by g (including the
+    // digits of numbers) are converted to upper or lower case
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject, typename CaseTag>
+    struct case_directive : unary_generator<Subject
+      , case_directive<Subject, CaseTag>>
+    {
+        typedef unary_generator<Subject, case_directive<Subject, CaseTag>>
+            base_type;
+        static bool const is_pass_through_unary = true;
+
+        case_directive(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            CaseTag const tag = CaseTag();
+            return this->subject.generate(sink
+              , make_context<case_modifier_tag>(tag, context), attr);
+        }
+    };
+
+    template <typename CaseTag>
+    struct case_gen
+    {
+        template <typename Subject>
+        case_directive<typename extension::as_generator<Subject>::value_type
+          , CaseTag>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject) };
+        }
+    };
+
+    auto const upper = case_gen<spirit::tag::upper>{};
+    auto const lower = case_gen<spirit::tag::lower>{};
+}}}}
+
+#endif
@@ -0,0 +1,88 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_VERBATIM_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_VERBATIM_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // verbatim[g]: g is generated without delimiting, the current delimiter
+    // is emitted once afterwards. no_delimit[g]: g is generated without
+    // delimiting and without the trailing delimiter.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct verbatim_directive : unary_generator<Subject
+      , verbatim_directive<Subject>>
+    {
+        typedef unary_generator<Subject, verbatim_directive<Subject>>
+            base_type;
+        static bool const is_pass_through_unary = true;
+
+        verbatim_directive(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            return this->subject.generate(sink
+                  , make_context<delimiter_tag>(unused, context), attr) &&
+                   karma::delimit_out(sink, context);
+        }
+    };
+
+    template <typename Subject>
+    struct no_delimit_directive : unary_generator<Subject
+      , no_delimit_directive<Subject>>
+    {
+        typedef unary_generator<Subject, no_delimit_directive<Subject>>
+            base_type;
+        static bool const is_pass_through_unary = true;
+
+        no_delimit_directive(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            return this->subject.generate(sink
+              , make_context<delimiter_tag>(unused, context), attr);
+        }
+    };
+
+    struct verbatim_gen
+    {
+        template <typename Subject>
+        verbatim_directive<typename extension::as_generator<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject) };
+        }
+    };
+
+    struct no_delimit_gen
+    {
+        template <typename Subject>
+        no_delimit_directive<
+            typename extension::as_generator<Subject>::value_type>
+        operator[](Subject const& subject) const
+        {
+            return { as_generator(subject) };
+        }
+    };
+
+    auto const verbatim = verbatim_gen{};
+    auto const no_delimit = no_delimit_gen{};
+}}}}
+
+#endif
@@ -0,0 +1,210 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_RULE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_RULE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/x3/core/call.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/preprocessor/cat.hpp>
+#include <boost/preprocessor/variadic/to_seq.hpp>
+#include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/detail/workaround.hpp>
+
+#if !defined(BOOST_SPIRIT_X3_NO_RTTI)
+#include <typeinfo>
+#endif
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    template <typename ID, typename Attribute = unused_type>
+    struct rule;
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The attribute handed to the right hand side of a rule: the
+        // attribute passed in if it has the declared type, a converted copy
+        // otherwise (or a default constructed one if there is none).
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Attribute, typename ActualAttribute>
+        struct make_rule_attribute
+        {
+            typedef Attribute type;
+            static Attribute call(ActualAttribute const& attr)
+            {
+                return Attribute(attr);
+            }
+        };
+
+        template <typename Attribute>
+        struct make_rule_attribute<Attribute, Attribute>
+        {
+            typedef Attribute const& type;
+            static Attribute const& call(Attribute const& attr)
+            {
+                return attr;
+            }
+        };
+
+        template <typename Attribute>
+        struct make_rule_attribute<Attribute, unused_type>
+        {
+            typedef Attribute type;
+            static Attribute call(unused_type)
+            {
+                return Attribute();
+            }
+        };
+
+        template <typename ActualAttribute>
+        struct make_rule_attribute<unused_type, ActualAttribute>
+        {
+            typedef unused_type type;
+            static unused_type call(ActualAttribute const&)
+            {
+                return unused;
+            }
+        };
+
+        template <>
+        struct make_rule_attribute<unused_type, unused_type>
+        {
+            typedef unused_type type;
+            static unused_type call(unused_type)
+            {
+                return unused;
+            }
+        };
+    }
+
+    // default generate_rule implementation
+    template <typename ID, typename Attribute, typename OutputIterator
+      , typename Context, typename ActualAttribute>
+    inline bool
+    generate_rule(
+        rule<ID, Attribute> /* rule_ */
+      , OutputIterator& sink
+      , Context const& context, ActualAttribute const& attr)
+    {
+        static_assert(!is_same<decltype(get<ID>(context)), unused_type>::value,
+            "BOOST_SPIRIT_KARMA_DEFINE undefined for this rule.");
+        return get<ID>(context).generate(sink, context, attr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The right hand side of a rule, the attribute of the rule is available
+    // to its semantic actions as _val(ctx).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ID, typename RHS, typename Attribute>
+    struct rule_definition
+      : generator<rule_definition<ID, RHS, Attribute>>
+    {
+        typedef rule_definition<ID, RHS, Attribute> this_type;
+        typedef ID id;
+        typedef RHS rhs_type;
+        typedef rule<ID, Attribute> lhs_type;
+        typedef Attribute attribute_type;
+
+        static bool const has_attribute =
+            !is_same<Attribute, unused_type>::value;
+        static bool const handles_container =
+            traits::is_container<Attribute>::value;
+        static int const properties = generator_properties::all_properties;
+
+        rule_definition(RHS const& rhs, char const* name)
+          : rhs(rhs), name(name) {}
+
+        template <typename OutputIterator, typename Context
+          , typename ActualAttribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , ActualAttribute const& attr) const
+        {
+            typedef detail::make_rule_attribute<Attribute, ActualAttribute>
+                make_attribute;
+
+            typename make_attribute::type attr_ = make_attribute::call(attr);
+            return rhs.generate(sink
+              , make_context<rule_val_context_tag>(attr_, context), attr_);
+        }
+
+        RHS rhs;
+        char const* name;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A rule requires all the services of the output iterator: its
+    // definition may be compiled separately (see BOOST_SPIRIT_KARMA_DEFINE
+    // and BOOST_SPIRIT_KARMA_INSTANTIATE), so the type of the sink can't
+    // depend on it.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ID, typename Attribute>
+    struct rule : generator<rule<ID, Attribute>>
+    {
+        typedef ID id;
+        typedef Attribute attribute_type;
+        static bool const has_attribute =
+            !is_same<Attribute, unused_type>::value;
+        static bool const handles_container =
+            traits::is_container<Attribute>::value;
+        static int const properties = generator_properties::all_properties;
+
+#if !defined(BOOST_SPIRIT_X3_NO_RTTI)
+        rule() : name(typeid(rule).name()) {}
+#else
+        rule() : name("unnamed") {}
+#endif
+
+        rule(char const* name)
+          : name(name) {}
+
+        template <typename RHS>
+        rule_definition<
+            ID, typename extension::as_generator<RHS>::value_type, Attribute>
+        operator=(RHS const& rhs) const
+        {
+            return { as_generator(rhs), name };
+        }
+
+        template <typename OutputIterator, typename Context
+          , typename ActualAttribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , ActualAttribute const& attr) const
+        {
+            typedef detail::make_rule_attribute<Attribute, ActualAttribute>
+                make_attribute;
+
+            typename make_attribute::type attr_ = make_attribute::call(attr);
+            return generate_rule(*this, sink, context, attr_);
+        }
+
+        char const* name;
+    };
+
+#define BOOST_SPIRIT_KARMA_DECLARE_(r, data, rule_type)                             template <typename OutputIterator, typename Context, typename Attribute>        bool generate_rule(                                                                 rule_type rule_                                                               , OutputIterator& sink                                                          , Context const& context, Attribute const& attr);                             /***/
+
+#define BOOST_SPIRIT_KARMA_DECLARE(...) BOOST_PP_SEQ_FOR_EACH(                      BOOST_SPIRIT_KARMA_DECLARE_, _, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))          /***/
+
+#if BOOST_WORKAROUND(BOOST_MSVC, < 1910)
+#define BOOST_SPIRIT_KARMA_DEFINE_(r, data, rule_name)                              using BOOST_PP_CAT(rule_name, _synonym) = decltype(rule_name);                  template <typename OutputIterator, typename Context, typename Attribute>        inline bool generate_rule(                                                          BOOST_PP_CAT(rule_name, _synonym) /* rule_ */                                 , OutputIterator& sink                                                          , Context const& context, Attribute const& attr)                              {                                                                                   static auto const def_ = (rule_name = BOOST_PP_CAT(rule_name, _def));           return def_.generate(sink, context, attr);                                  }                                                                               /***/
+#else
+#define BOOST_SPIRIT_KARMA_DEFINE_(r, data, rule_name)                              template <typename OutputIterator, typename Context, typename Attribute>        inline bool generate_rule(                                                          decltype(rule_name) /* rule_ */                                               , OutputIterator& sink                                                          , Context const& context, Attribute const& attr)                              {                                                                                   static auto const def_ = (rule_name = BOOST_PP_CAT(rule_name, _def));           return def_.generate(sink, context, attr);                                  }                                                                               /***/
+#endif
+
+#define BOOST_SPIRIT_KARMA_DEFINE(...) BOOST_PP_SEQ_FOR_EACH(                       BOOST_SPIRIT_KARMA_DEFINE_, _, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))           /***/
+
+// OutputIterator is the sink type seen by the generators, i.e.
+// boost::spirit::x3::karma::output_iterator<Iterator> for the output
+// iterator, Iterator, passed to generate() (see generate.hpp).
+#define BOOST_SPIRIT_KARMA_INSTANTIATE(rule_type, OutputIterator, Context)          template bool generate_rule<OutputIterator, Context                               , rule_type::attribute_type>(                                                     rule_type rule_                                                               , OutputIterator& sink                                                          , Context const& context, rule_type::attribute_type const& attr);             /***/
+
+}}}}
+
+#endif
@@ -0,0 +1,122 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_BOOL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_BOOL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/x3/karma/support/case_modifier.hpp>
+#include <boost/spirit/home/x3/karma/support/optional_value.hpp>
+#include <boost/spirit/home/karma/numeric/bool_policies.hpp>
+#include <boost/spirit/home/karma/numeric/detail/bool_utils.hpp>
+#include <boost/spirit/home/support/char_encoding/standard.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    template <typename T, typename BoolPolicies>
+    struct literal_bool_generator;
+
+    // The boolean generators use the policies of Spirit.Karma, see
+    // spirit::karma::bool_policies.
+    template <typename T, typename BoolPolicies = spirit::karma::bool_policies<T>>
+    struct bool_generator : generator<bool_generator<T, BoolPolicies>>
+    {
+        typedef T attribute_type;
+        static bool const has_attribute = true;
+
+        bool_generator() = default;
+        bool_generator(BoolPolicies const& policies)
+          : policies(policies) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            if (!detail::has_optional_value(attr))
+                return false;       // fail if it's an uninitialized optional
+
+            return insert_bool(sink, context
+              , T(detail::optional_value(attr)), policies);
+        }
+
+        // It is not possible (doesn't make sense) to use boolean generators
+        // without providing any attribute, as the generator doesn't 'know'
+        // what to output.
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const = delete;
+
+        literal_bool_generator<T, BoolPolicies> operator()(T b) const
+        {
+            return { b, policies };
+        }
+
+        template <typename OutputIterator, typename Context>
+        static bool insert_bool(OutputIterator& sink, Context const& context
+          , T b, BoolPolicies const& policies)
+        {
+            typedef char_conversion<char_encoding::standard, Context>
+                conversion;
+            typedef spirit::karma::bool_inserter<T, BoolPolicies
+              , typename conversion::encoding, typename conversion::tag>
+            inserter_type;
+
+            return inserter_type::call(sink, b, policies) &&
+                   karma::delimit_out(sink, context);
+        }
+
+        BoolPolicies policies;
+    };
+
+    // A literal boolean: true_ and false_ generate their value, failing if
+    // an attribute is supplied and differs from it.
+    template <typename T, typename BoolPolicies>
+    struct literal_bool_generator
+      : generator<literal_bool_generator<T, BoolPolicies>>
+    {
+        typedef T attribute_type;
+        static bool const has_attribute = true;
+
+        literal_bool_generator(T b, BoolPolicies const& policies = BoolPolicies())
+          : b(b), policies(policies) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            if (!detail::has_optional_value(attr) ||
+                b != T(detail::optional_value(attr)))
+            {
+                return false;
+            }
+            return bool_generator<T, BoolPolicies>::insert_bool(
+                sink, context, b, policies);
+        }
+
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const
+        {
+            return bool_generator<T, BoolPolicies>::insert_bool(
+                sink, context, b, policies);
+        }
+
+        T b;
+        BoolPolicies policies;
+    };
+
+    typedef bool_generator<bool> bool_type;
+    bool_type const bool_ = {};
+
+    literal_bool_generator<bool, spirit::karma::bool_policies<bool>> const
+        true_ = { true };
+    literal_bool_generator<bool, spirit::karma::bool_policies<bool>> const
+        false_ = { false };
+}}}}
+
+#endif
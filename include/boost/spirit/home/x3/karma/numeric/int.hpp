@@ -0,0 +1,203 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_INT_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_INT_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/x3/karma/support/case_modifier.hpp>
+#include <boost/spirit/home/x3/karma/support/optional_value.hpp>
+#include <boost/spirit/home/karma/numeric/detail/numeric_utils.hpp>
+#include <boost/spirit/home/support/char_encoding/standard.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/mpl/if.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    namespace detail
+    {
+        // the integer is written by the inserters of Spirit.Karma, which
+        // convert radix 10 and 16 without the usual digit loop
+        template <unsigned Radix, bool force_sign
+          , typename OutputIterator, typename Context, typename T>
+        inline bool insert_int(OutputIterator& sink, Context const& context
+          , T n)
+        {
+            typedef char_conversion<char_encoding::standard, Context>
+                conversion;
+            typedef spirit::karma::int_inserter<Radix
+              , typename conversion::encoding, typename conversion::tag>
+            inserter_type;
+
+            return spirit::karma::sign_inserter::call(sink
+                      , spirit::traits::test_zero(n)
+                      , spirit::traits::test_negative(n), force_sign) &&
+                   inserter_type::call(sink
+                      , spirit::traits::get_absolute_value(n)) &&
+                   karma::delimit_out(sink, context);
+        }
+    }
+
+    template <typename T, unsigned Radix = 10, bool force_sign = false
+      , bool no_attribute = false>
+    struct literal_int_generator;
+
+    template <typename T, unsigned Radix = 10, bool force_sign = false>
+    struct int_generator : generator<int_generator<T, Radix, force_sign>>
+    {
+        static_assert(Radix == 2 || Radix == 8 || Radix == 10 || Radix == 16,
+            "Error Unsupported Radix");
+
+        typedef T attribute_type;
+        static bool const has_attribute = true;
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            if (!detail::has_optional_value(attr))
+                return false;       // fail if it's an uninitialized optional
+
+            return detail::insert_int<Radix, force_sign>(sink, context
+              , T(detail::optional_value(attr)));
+        }
+
+        // It is not possible (doesn't make sense) to use numeric generators
+        // without providing any attribute, as the generator doesn't 'know'
+        // what to output.
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const = delete;
+
+        literal_int_generator<T, Radix, force_sign> operator()(T n) const
+        {
+            return { n };
+        }
+    };
+
+    // A literal integer: lit(42) generates its value without an attribute,
+    // int_(42) takes an attribute and fails unless the attribute is that
+    // value.
+    template <typename T, unsigned Radix, bool force_sign, bool no_attribute>
+    struct literal_int_generator
+      : generator<literal_int_generator<T, Radix, force_sign, no_attribute>>
+    {
+        typedef typename mpl::if_c<no_attribute, unused_type, T>::type
+            attribute_type;
+        static bool const has_attribute = !no_attribute;
+
+        literal_int_generator(T n)
+          : n(n) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            if (!detail::has_optional_value(attr) ||
+                n != T(detail::optional_value(attr)))
+            {
+                return false;
+            }
+            return detail::insert_int<Radix, force_sign>(sink, context, n);
+        }
+
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const
+        {
+            return detail::insert_int<Radix, force_sign>(sink, context, n);
+        }
+
+        T n;
+    };
+
+    typedef int_generator<short> short_type;
+    short_type const short_ = {};
+
+    typedef int_generator<int> int_type;
+    int_type const int_ = {};
+
+    typedef int_generator<long> long_type;
+    long_type const long_ = {};
+
+    typedef int_generator<long long> long_long_type;
+    long_long_type const long_long = {};
+
+    typedef int_generator<unsigned short> ushort_type;
+    ushort_type const ushort_ = {};
+
+    typedef int_generator<unsigned int> uint_type;
+    uint_type const uint_ = {};
+
+    typedef int_generator<unsigned long> ulong_type;
+    ulong_type const ulong_ = {};
+
+    typedef int_generator<unsigned long long> ulong_long_type;
+    ulong_long_type const ulong_long = {};
+
+    typedef int_generator<unsigned, 2> bin_type;
+    bin_type const bin = {};
+
+    typedef int_generator<unsigned, 8> oct_type;
+    oct_type const oct = {};
+
+    typedef int_generator<unsigned, 16> hex_type;
+    hex_type const hex = {};
+
+    inline literal_int_generator<short, 10, false, true>
+    lit(short n)
+    {
+        return { n };
+    }
+
+    inline literal_int_generator<int, 10, false, true>
+    lit(int n)
+    {
+        return { n };
+    }
+
+    inline literal_int_generator<long, 10, false, true>
+    lit(long n)
+    {
+        return { n };
+    }
+
+    inline literal_int_generator<long long, 10, false, true>
+    lit(long long n)
+    {
+        return { n };
+    }
+
+    inline literal_int_generator<unsigned short, 10, false, true>
+    lit(unsigned short n)
+    {
+        return { n };
+    }
+
+    inline literal_int_generator<unsigned int, 10, false, true>
+    lit(unsigned int n)
+    {
+        return { n };
+    }
+
+    inline literal_int_generator<unsigned long, 10, false, true>
+    lit(unsigned long n)
+    {
+        return { n };
+    }
+
+    inline literal_int_generator<unsigned long long, 10, false, true>
+    lit(unsigned long long n)
+    {
+        return { n };
+    }
+
+}}}}
+
+#endif
@@ -0,0 +1,78 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_REAL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_REAL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/x3/karma/support/case_modifier.hpp>
+#include <boost/spirit/home/x3/karma/support/optional_value.hpp>
+#include <boost/spirit/home/karma/numeric/real_policies.hpp>
+#include <boost/spirit/home/karma/numeric/detail/real_utils.hpp>
+#include <boost/spirit/home/support/char_encoding/standard.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    // The floating point generators use the policies (and the inserters) of
+    // Spirit.Karma: spirit::karma::real_policies, shortest_real_policies or
+    // any user defined policies derived from them work unchanged.
+    template <typename T, typename RealPolicies = spirit::karma::real_policies<T>>
+    struct real_generator : generator<real_generator<T, RealPolicies>>
+    {
+        typedef T attribute_type;
+        static bool const has_attribute = true;
+
+        real_generator() = default;
+        real_generator(RealPolicies const& policies)
+          : policies(policies) {}
+
+        template <typename OutputIterator, typename Context>
+        bool insert_real(OutputIterator& sink, Context const& context
+          , T n) const
+        {
+            typedef char_conversion<char_encoding::standard, Context>
+                conversion;
+            typedef spirit::karma::real_inserter<T, RealPolicies
+              , typename conversion::encoding, typename conversion::tag>
+            inserter_type;
+
+            return inserter_type::call(sink, n, policies) &&
+                   karma::delimit_out(sink, context);
+        }
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            if (!detail::has_optional_value(attr))
+                return false;       // fail if it's an uninitialized optional
+
+            return insert_real(sink, context, T(detail::optional_value(attr)));
+        }
+
+        // It is not possible (doesn't make sense) to use numeric generators
+        // without providing any attribute, as the generator doesn't 'know'
+        // what to output.
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const = delete;
+
+        RealPolicies policies;
+    };
+
+    typedef real_generator<float> float_type;
+    float_type const float_ = {};
+
+    typedef real_generator<double> double_type;
+    double_type const double_ = {};
+
+    typedef real_generator<long double> long_double_type;
+    long_double_type const long_double = {};
+}}}}
+
+#endif
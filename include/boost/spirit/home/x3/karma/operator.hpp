@@ -0,0 +1,20 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_OPERATOR_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_OPERATOR_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/operator/sequence.hpp>
+#include <boost/spirit/home/x3/karma/operator/alternative.hpp>
+#include <boost/spirit/home/x3/karma/operator/kleene.hpp>
+#include <boost/spirit/home/x3/karma/operator/plus.hpp>
+#include <boost/spirit/home/x3/karma/operator/list.hpp>
+#include <boost/spirit/home/x3/karma/operator/optional.hpp>
+#include <boost/spirit/home/x3/karma/operator/and_predicate.hpp>
+#include <boost/spirit/home/x3/karma/operator/not_predicate.hpp>
+
+#endif
@@ -0,0 +1,57 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_ALTERNATIVE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_ALTERNATIVE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/operator/detail/alternative.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // a | b: the first element succeeding generates the output
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Left, typename Right>
+    struct alternative : binary_generator<Left, Right, alternative<Left, Right>>
+    {
+        typedef binary_generator<Left, Right, alternative<Left, Right>>
+            base_type;
+        static int const properties = base_type::properties |
+            generator_properties::countingbuffer;
+
+        alternative(Left const& left, Right const& right)
+            : base_type(left, right) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            return detail::generate_alternative(this->left, sink, context, attr)
+                || detail::generate_alternative(this->right, sink, context, attr);
+        }
+    };
+
+    template <typename Left, typename Right>
+    inline alternative<
+        typename extension::as_generator<Left>::value_type
+      , typename extension::as_generator<Right>::value_type>
+    operator|(Left const& left, Right const& right)
+    {
+        return { as_generator(left), as_generator(right) };
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Left, typename Right, typename Context>
+    struct attribute_of<x3::karma::alternative<Left, Right>, Context>
+        : x3::karma::detail::attribute_of_alternative<Left, Right, Context> {};
+}}}}
+
+#endif
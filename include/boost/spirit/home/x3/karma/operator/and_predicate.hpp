@@ -0,0 +1,48 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_AND_PREDICATE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_AND_PREDICATE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // &a: succeeds if a succeeds, but doesn't emit any output
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct and_predicate : unary_generator<Subject, and_predicate<Subject>>
+    {
+        typedef unary_generator<Subject, and_predicate<Subject>> base_type;
+        static bool const is_pass_through_unary = true;
+        static int const properties = base_type::properties |
+            generator_properties::disabling;
+
+        and_predicate(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            // inhibits output
+            spirit::karma::detail::disable_output<OutputIterator> disable(sink);
+            return this->subject.generate(sink, context, attr);
+        }
+    };
+
+    template <typename Subject>
+    inline and_predicate<typename extension::as_generator<Subject>::value_type>
+    operator&(Subject const& subject)
+    {
+        return { as_generator(subject) };
+    }
+}}}}
+
+#endif
@@ -0,0 +1,218 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_ALTERNATIVE_DETAIL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_ALTERNATIVE_DETAIL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/has_attribute.hpp>
+#include <boost/spirit/home/x3/support/traits/is_variant.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+#include <boost/variant/variant.hpp>
+#include <boost/variant/get.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/contains.hpp>
+#include <boost/mpl/copy_if.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/insert_range.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/vector.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    template <typename Left, typename Right>
+    struct alternative;
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace karma {
+    namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Generate one element of an alternative. An element without attribute
+    // is always tried, a variant attribute selects the elements whose
+    // attribute is the type currently held, any other attribute is handed
+    // to the element as is.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative_variant(Component const& component
+      , OutputIterator& sink, Context const& context, Attribute const& attr
+      , mpl::true_)
+    {
+        typedef typename traits::attribute_of<Component, Context>::type
+            attribute_type;
+
+        attribute_type const* p = boost::get<attribute_type>(&attr);
+        return p && component.generate(sink, context, *p);
+    }
+
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative_variant(Component const&, OutputIterator&
+      , Context const&, Attribute const&, mpl::false_)
+    {
+        return false;       // the variant can't hold the element's attribute
+    }
+
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative_element(Component const& component
+      , OutputIterator& sink, Context const& context, Attribute const& attr
+      , mpl::true_ /*is_variant*/)
+    {
+        typedef typename traits::attribute_of<Component, Context>::type
+            attribute_type;
+        typedef typename mpl::contains<
+            typename Attribute::types, attribute_type>::type is_alternative;
+
+        return generate_alternative_variant(
+            component, sink, context, attr, is_alternative());
+    }
+
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative_element(Component const& component
+      , OutputIterator& sink, Context const& context, Attribute const& attr
+      , mpl::false_ /*is_variant*/)
+    {
+        return component.generate(sink, context, attr);
+    }
+
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative_attribute(Component const& component
+      , OutputIterator& sink, Context const& context, Attribute const& attr
+      , mpl::true_ /*has_attribute*/)
+    {
+        return generate_alternative_element(component, sink, context, attr
+          , typename traits::is_variant<Attribute>::type());
+    }
+
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative_attribute(Component const& component
+      , OutputIterator& sink, Context const& context, Attribute const&
+      , mpl::false_ /*has_attribute*/)
+    {
+        return component.generate(sink, context, unused);
+    }
+
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative_element(Component const& component
+      , OutputIterator& sink, Context const& context, Attribute const& attr)
+    {
+        typedef mpl::bool_<
+            traits::has_attribute<Component, Context>::value> has_attribute;
+
+        return generate_alternative_attribute(
+            component, sink, context, attr, has_attribute());
+    }
+
+    template <typename Component, typename OutputIterator, typename Context>
+    bool generate_alternative_element(Component const& component
+      , OutputIterator& sink, Context const& context, unused_type)
+    {
+        return component.generate(sink, context, unused);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The output of an element is buffered: it's emitted only if the element
+    // succeeds. Counting is disabled meanwhile, the buffer is counted when
+    // it is copied.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Component, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_alternative(Component const& component
+      , OutputIterator& sink, Context const& context, Attribute const& attr)
+    {
+        spirit::karma::detail::enable_buffering<OutputIterator> buffering(sink);
+        bool r = false;
+        {
+            spirit::karma::detail::disable_counting<OutputIterator>
+                nocounting(sink);
+            r = generate_alternative_element(component, sink, context, attr);
+        }
+        if (r)
+            buffering.buffer_copy();
+        return r;
+    }
+
+    // avoid double buffering
+    template <typename L, typename R, typename OutputIterator
+      , typename Context, typename Attribute>
+    bool generate_alternative(alternative<L, R> const& component
+      , OutputIterator& sink, Context const& context, Attribute const& attr)
+    {
+        return component.generate(sink, context, attr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The attribute of an alternative: a variant of all the attributes
+    // which are not unused.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename L, typename R, typename C>
+    struct get_alternative_types
+    {
+        typedef
+            mpl::vector<
+                typename traits::attribute_of<L, C>::type
+              , typename traits::attribute_of<R, C>::type
+            >
+        type;
+    };
+
+    template <typename LL, typename LR, typename R, typename C>
+    struct get_alternative_types<alternative<LL, LR>, R, C>
+      : mpl::push_back<typename get_alternative_types<LL, LR, C>::type
+          , typename traits::attribute_of<R, C>::type> {};
+
+    template <typename L, typename RL, typename RR, typename C>
+    struct get_alternative_types<L, alternative<RL, RR>, C>
+      : mpl::push_front<typename get_alternative_types<RL, RR, C>::type
+          , typename traits::attribute_of<L, C>::type> {};
+
+    template <typename LL, typename LR, typename RL, typename RR, typename C>
+    struct get_alternative_types<alternative<LL, LR>, alternative<RL, RR>, C>
+    {
+        typedef typename get_alternative_types<LL, LR, C>::type left;
+        typedef typename get_alternative_types<RL, RR, C>::type right;
+        typedef typename
+            mpl::insert_range<left, typename mpl::end<left>::type, right>::type
+        type;
+    };
+
+    template <typename L, typename R, typename C>
+    struct attribute_of_alternative
+    {
+        typedef typename get_alternative_types<L, R, C>::type all_types;
+
+        typedef typename
+            mpl::copy_if<
+                all_types
+              , mpl::not_<is_same<mpl::_1, unused_type>>
+              , mpl::back_inserter<mpl::vector<>>
+            >::type
+        filtered_types;
+
+        typedef typename
+            mpl::eval_if<
+                mpl::empty<filtered_types>
+              , mpl::identity<unused_type>
+              , make_variant_over<filtered_types>
+            >::type
+        type;
+    };
+}}}}}
+
+#endif
@@ -0,0 +1,49 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_CONTAINER_DETAIL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_CONTAINER_DETAIL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/traits/has_attribute.hpp>
+#include <boost/mpl/bool.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma {
+    namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Generate one item of a container attribute (used by the kleene, plus
+    // and list generators). A generator without attribute doesn't see the
+    // item, it is just invoked once for it.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Item>
+    bool generate_item(Generator const& g, OutputIterator& sink
+      , Context const& context, Item const& item, mpl::true_)
+    {
+        return g.generate(sink, context, item);
+    }
+
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Item>
+    bool generate_item(Generator const& g, OutputIterator& sink
+      , Context const& context, Item const&, mpl::false_)
+    {
+        return g.generate(sink, context, unused);
+    }
+
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Item>
+    bool generate_item(Generator const& g, OutputIterator& sink
+      , Context const& context, Item const& item)
+    {
+        return generate_item(g, sink, context, item
+          , mpl::bool_<traits::has_attribute<Generator, Context>::value>());
+    }
+}}}}}
+
+#endif
@@ -0,0 +1,363 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_SEQUENCE_DETAIL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_SEQUENCE_DETAIL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/attribute_category.hpp>
+#include <boost/spirit/home/x3/support/traits/has_attribute.hpp>
+
+#include <boost/fusion/include/begin.hpp>
+#include <boost/fusion/include/end.hpp>
+#include <boost/fusion/include/advance.hpp>
+#include <boost/fusion/include/deref.hpp>
+#include <boost/fusion/include/size.hpp>
+#include <boost/fusion/include/iterator_range.hpp>
+#include <boost/fusion/include/as_deque.hpp>
+#include <boost/fusion/include/mpl.hpp>
+#include <boost/fusion/include/is_sequence.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/copy_if.hpp>
+#include <boost/mpl/empty.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/insert_range.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/push_back.hpp>
+#include <boost/mpl/push_front.hpp>
+#include <boost/mpl/size.hpp>
+#include <boost/mpl/vector.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    template <typename Left, typename Right>
+    struct sequence;
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace karma {
+    namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The number of attribute elements consumed by a generator in a sequence
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Generator, typename Context, typename Enable = void>
+    struct sequence_size
+    {
+        static int const value =
+            traits::has_attribute<Generator, Context>::value;
+    };
+
+    template <typename Generator, typename Context>
+    struct sequence_size_subject
+      : sequence_size<typename Generator::subject_type, Context> {};
+
+    template <typename Generator, typename Context>
+    struct sequence_size<Generator, Context
+      , typename enable_if_c<(Generator::is_pass_through_unary)>::type>
+      : sequence_size_subject<Generator, Context> {};
+
+    template <typename L, typename R, typename Context>
+    struct sequence_size<sequence<L, R>, Context>
+    {
+        static int const value =
+            sequence_size<L, Context>::value +
+            sequence_size<R, Context>::value;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The attribute handed to an element of a sequence: nothing for no
+    // elements, the element itself for a single one, the range otherwise.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Part, int Size = fusion::result_of::size<Part>::value>
+    struct pass_sequence_part
+    {
+        typedef Part const& type;
+        static Part const& call(Part const& part)
+        {
+            return part;
+        }
+    };
+
+    template <typename Part>
+    struct pass_sequence_part<Part, 0>
+    {
+        typedef unused_type type;
+        static unused_type call(Part const&)
+        {
+            return unused;
+        }
+    };
+
+    template <typename Part>
+    struct pass_sequence_part<Part, 1>
+    {
+        typedef typename fusion::result_of::deref<
+            typename fusion::result_of::begin<Part const>::type
+        >::type type;
+
+        static type call(Part const& part)
+        {
+            return fusion::deref(fusion::begin(part));
+        }
+    };
+
+    template <typename Attribute, typename Enable = void>
+    struct is_size_one_sequence : mpl::false_ {};
+
+    template <typename Attribute>
+    struct is_size_one_sequence<Attribute
+      , typename enable_if<fusion::traits::is_sequence<Attribute>>::type>
+      : mpl::bool_<fusion::result_of::size<Attribute>::value == 1> {};
+
+    template <typename Generator, typename Attribute, typename Enable = void>
+    struct pass_sequence_attribute
+      : mpl::if_<
+            is_size_one_sequence<Attribute>
+          , pass_sequence_part<Attribute, 1>
+          , pass_sequence_part<Attribute, -1>>::type {};
+
+    template <typename L, typename R, typename Attribute>
+    struct pass_sequence_attribute<sequence<L, R>, Attribute>
+      : pass_sequence_part<Attribute, -1> {};
+
+    template <typename Generator, typename Attribute>
+    struct pass_sequence_attribute_subject
+      : pass_sequence_attribute<typename Generator::subject_type, Attribute> {};
+
+    template <typename Generator, typename Attribute>
+    struct pass_sequence_attribute<Generator, Attribute
+      , typename enable_if_c<(Generator::is_pass_through_unary)>::type>
+      : pass_sequence_attribute_subject<Generator, Attribute> {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Split a fusion sequence attribute between the left and the right
+    // element of a sequence
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename L, typename R, typename Attribute, typename Context>
+    struct partition_attribute
+    {
+        static int const l_size = sequence_size<L, Context>::value;
+        static int const r_size = sequence_size<R, Context>::value;
+
+        static int constexpr actual_size =
+            fusion::result_of::size<Attribute>::value;
+        static int constexpr expected_size = l_size + r_size;
+
+        // If you got an error here, then you are trying to pass
+        // a fusion sequence with the wrong number of elements
+        // as that expected by the (sequence) generator.
+        static_assert(
+            actual_size >= expected_size
+          , "Size of the passed attribute is less than expected."
+        );
+        static_assert(
+            actual_size <= expected_size
+          , "Size of the passed attribute is bigger than expected."
+        );
+
+        typedef typename fusion::result_of::begin<Attribute const>::type
+            l_begin;
+        typedef typename fusion::result_of::advance_c<l_begin, l_size>::type
+            l_end;
+        typedef typename fusion::result_of::end<Attribute const>::type r_end;
+        typedef fusion::iterator_range<l_begin, l_end> l_part;
+        typedef fusion::iterator_range<l_end, r_end> r_part;
+        typedef pass_sequence_part<l_part, l_size> l_pass;
+        typedef pass_sequence_part<r_part, r_size> r_pass;
+
+        static l_part left(Attribute const& s)
+        {
+            auto i = fusion::begin(s);
+            return l_part(i, fusion::advance_c<l_size>(i));
+        }
+
+        static r_part right(Attribute const& s)
+        {
+            return r_part(
+                fusion::advance_c<l_size>(fusion::begin(s))
+              , fusion::end(s));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The attribute of a sequence: a fusion::deque of all the attributes
+    // which are not unused, a single attribute stands for itself.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename L, typename R, typename C>
+    struct get_sequence_types
+    {
+        typedef
+            mpl::vector<
+                typename traits::attribute_of<L, C>::type
+              , typename traits::attribute_of<R, C>::type
+            >
+        type;
+    };
+
+    template <typename LL, typename LR, typename R, typename C>
+    struct get_sequence_types<sequence<LL, LR>, R, C>
+      : mpl::push_back<typename get_sequence_types<LL, LR, C>::type
+          , typename traits::attribute_of<R, C>::type> {};
+
+    template <typename L, typename RL, typename RR, typename C>
+    struct get_sequence_types<L, sequence<RL, RR>, C>
+      : mpl::push_front<typename get_sequence_types<RL, RR, C>::type
+          , typename traits::attribute_of<L, C>::type> {};
+
+    template <typename LL, typename LR, typename RL, typename RR, typename C>
+    struct get_sequence_types<sequence<LL, LR>, sequence<RL, RR>, C>
+    {
+        typedef typename get_sequence_types<LL, LR, C>::type left;
+        typedef typename get_sequence_types<RL, RR, C>::type right;
+        typedef typename
+            mpl::insert_range<left, typename mpl::end<left>::type, right>::type
+        type;
+    };
+
+    template <typename L, typename R, typename C>
+    struct attribute_of_sequence
+    {
+        typedef typename get_sequence_types<L, R, C>::type all_types;
+
+        typedef typename
+            mpl::copy_if<
+                all_types
+              , mpl::not_<is_same<mpl::_1, unused_type>>
+              , mpl::back_inserter<mpl::vector<>>
+            >::type
+        filtered_types;
+
+        typedef typename
+            mpl::eval_if<
+                mpl::empty<filtered_types>
+              , mpl::identity<unused_type>
+              , mpl::if_c<mpl::size<filtered_types>::value == 1
+                  , typename mpl::front<filtered_types>::type
+                  , typename fusion::result_of::as_deque<filtered_types>::type>
+            >::type
+        type;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Generate the elements of a sequence from a container attribute: every
+    // element having an attribute consumes the next item of the container.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Iterator>
+    bool generate_sequence_element(Generator const& g, OutputIterator& sink
+      , Context const& context, Iterator& first, Iterator const& last
+      , mpl::true_)
+    {
+        if (first == last)
+            return false;       // not enough items in the container
+        return g.generate(sink, context, *first++);
+    }
+
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Iterator>
+    bool generate_sequence_element(Generator const& g, OutputIterator& sink
+      , Context const& context, Iterator&, Iterator const&, mpl::false_)
+    {
+        return g.generate(sink, context, unused);
+    }
+
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Iterator>
+    bool generate_sequence_elements(Generator const& g, OutputIterator& sink
+      , Context const& context, Iterator& first, Iterator const& last)
+    {
+        return generate_sequence_element(g, sink, context, first, last
+          , mpl::bool_<traits::has_attribute<Generator, Context>::value>());
+    }
+
+    template <typename L, typename R, typename OutputIterator
+      , typename Context, typename Iterator>
+    bool generate_sequence_elements(sequence<L, R> const& g
+      , OutputIterator& sink, Context const& context
+      , Iterator& first, Iterator const& last)
+    {
+        return generate_sequence_elements(g.left, sink, context, first, last)
+            && generate_sequence_elements(g.right, sink, context, first, last);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Only one of the elements has an attribute: it gets all of it
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Attribute, typename Category>
+    bool generate_sequence(Generator const& g, OutputIterator& sink
+      , Context const& context, Attribute const& attr, Category
+      , mpl::true_, mpl::false_)
+    {
+        typedef pass_sequence_attribute<
+            typename Generator::left_type, Attribute> l_pass;
+        return g.left.generate(sink, context, l_pass::call(attr))
+            && g.right.generate(sink, context, unused);
+    }
+
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Attribute, typename Category>
+    bool generate_sequence(Generator const& g, OutputIterator& sink
+      , Context const& context, Attribute const& attr, Category
+      , mpl::false_, mpl::true_)
+    {
+        typedef pass_sequence_attribute<
+            typename Generator::right_type, Attribute> r_pass;
+        return g.left.generate(sink, context, unused)
+            && g.right.generate(sink, context, r_pass::call(attr));
+    }
+
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Attribute, typename Category>
+    bool generate_sequence(Generator const& g, OutputIterator& sink
+      , Context const& context, Attribute const&, Category
+      , mpl::false_, mpl::false_)
+    {
+        return g.left.generate(sink, context, unused)
+            && g.right.generate(sink, context, unused);
+    }
+
+    // Both elements have an attribute: a fusion sequence is partitioned
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_sequence(Generator const& g, OutputIterator& sink
+      , Context const& context, Attribute const& attr
+      , traits::tuple_attribute, mpl::true_, mpl::true_)
+    {
+        typedef partition_attribute<typename Generator::left_type
+          , typename Generator::right_type, Attribute, Context> partition;
+        typedef typename partition::l_pass l_pass;
+        typedef typename partition::r_pass r_pass;
+
+        typename partition::l_part l_part = partition::left(attr);
+        typename partition::r_part r_part = partition::right(attr);
+
+        return g.left.generate(sink, context, l_pass::call(l_part))
+            && g.right.generate(sink, context, r_pass::call(r_part));
+    }
+
+    // ... and a container is walked
+    template <typename Generator, typename OutputIterator, typename Context
+      , typename Attribute>
+    bool generate_sequence(Generator const& g, OutputIterator& sink
+      , Context const& context, Attribute const& attr
+      , traits::container_attribute, mpl::true_, mpl::true_)
+    {
+        typename Attribute::const_iterator first = attr.begin();
+        typename Attribute::const_iterator last = attr.end();
+        return generate_sequence_elements(g, sink, context, first, last);
+    }
+}}}}}
+
+#endif
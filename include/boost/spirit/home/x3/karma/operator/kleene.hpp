@@ -0,0 +1,71 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_KLEENE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_KLEENE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/operator/detail/container.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // *a: generate every item of the container attribute. Items the subject
+    // fails to generate are skipped, the kleene fails only if the underlying
+    // output fails.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct kleene : unary_generator<Subject, kleene<Subject>>
+    {
+        typedef unary_generator<Subject, kleene<Subject>> base_type;
+        static bool const handles_container = true;
+
+        kleene(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            auto first = traits::begin(attr);
+            auto last = traits::end(attr);
+            for (/**/; first != last; ++first)
+                detail::generate_item(this->subject, sink, context, *first);
+
+            return spirit::karma::detail::sink_is_good(sink);
+        }
+
+        // There is no way to distinguish a failed generator from a
+        // generator to be skipped without an attribute, nothing is
+        // generated in this case.
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const&, unused_type) const
+        {
+            return spirit::karma::detail::sink_is_good(sink);
+        }
+    };
+
+    template <typename Subject>
+    inline kleene<typename extension::as_generator<Subject>::value_type>
+    operator*(Subject const& subject)
+    {
+        return { as_generator(subject) };
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject, typename Context>
+    struct attribute_of<x3::karma::kleene<Subject>, Context>
+        : build_container<
+            typename attribute_of<Subject, Context>::type> {};
+}}}}
+
+#endif
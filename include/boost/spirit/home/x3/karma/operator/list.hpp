@@ -0,0 +1,95 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_LIST_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_LIST_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/operator/detail/container.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // a % b: the items of the container attribute generated by a, separated
+    // by b. The separator is emitted only if the item following it succeeds,
+    // items failing to generate are skipped.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Left, typename Right>
+    struct list : binary_generator<Left, Right, list<Left, Right>>
+    {
+        typedef binary_generator<Left, Right, list<Left, Right>> base_type;
+        static bool const handles_container = true;
+        static int const properties = base_type::properties |
+            generator_properties::countingbuffer;
+
+        list(Left const& left, Right const& right)
+          : base_type(left, right) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            auto first = traits::begin(attr);
+            auto last = traits::end(attr);
+
+            // the first item succeeding starts the list
+            bool result = false;
+            while (!result && first != last)
+            {
+                result = detail::generate_item(
+                    this->left, sink, context, *first);
+                ++first;
+            }
+            if (!result)
+                return false;
+
+            for (/**/; first != last; ++first)
+            {
+                // wrap the given output iterator as the item might fail
+                spirit::karma::detail::enable_buffering<OutputIterator>
+                    buffering(sink);
+                {
+                    spirit::karma::detail::disable_counting<OutputIterator>
+                        nocounting(sink);
+
+                    if (!this->right.generate(sink, context, unused))
+                        return false;     // shouldn't happen
+
+                    if (!detail::generate_item(
+                            this->left, sink, context, *first))
+                    {
+                        continue;
+                    }
+                }
+                buffering.buffer_copy();
+            }
+            return spirit::karma::detail::sink_is_good(sink);
+        }
+    };
+
+    template <typename Left, typename Right>
+    inline list<
+        typename extension::as_generator<Left>::value_type
+      , typename extension::as_generator<Right>::value_type>
+    operator%(Left const& left, Right const& right)
+    {
+        return { as_generator(left), as_generator(right) };
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Left, typename Right, typename Context>
+    struct attribute_of<x3::karma::list<Left, Right>, Context>
+        : traits::build_container<
+            typename attribute_of<Left, Context>::type> {};
+}}}}
+
+#endif
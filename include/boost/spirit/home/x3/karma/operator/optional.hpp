@@ -0,0 +1,74 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_OPTIONAL_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_OPTIONAL_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/support/optional_value.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+#include <boost/optional/optional.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // -a: generate the attribute if there is one, always succeeds (unless
+    // the underlying output fails).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct optional : unary_generator<Subject, optional<Subject>>
+    {
+        typedef unary_generator<Subject, optional<Subject>> base_type;
+
+        optional(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            if (detail::has_optional_value(attr))
+            {
+                this->subject.generate(
+                    sink, context, detail::optional_value(attr));
+            }
+            return spirit::karma::detail::sink_is_good(sink);
+        }
+
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const
+        {
+            this->subject.generate(sink, context, unused);
+            return spirit::karma::detail::sink_is_good(sink);
+        }
+    };
+
+    template <typename Subject>
+    inline optional<typename extension::as_generator<Subject>::value_type>
+    operator-(Subject const& subject)
+    {
+        return { as_generator(subject) };
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject, typename Context>
+    struct attribute_of<x3::karma::optional<Subject>, Context>
+        : mpl::eval_if<
+            is_same<typename attribute_of<Subject, Context>::type, unused_type>
+          , mpl::identity<unused_type>
+          , mpl::identity<boost::optional<
+                typename attribute_of<Subject, Context>::type>>> {};
+}}}}
+
+#endif
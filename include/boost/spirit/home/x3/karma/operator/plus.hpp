@@ -0,0 +1,72 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_PLUS_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_PLUS_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/operator/detail/container.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // +a: as *a, but at least one item has to be generated
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Subject>
+    struct plus : unary_generator<Subject, plus<Subject>>
+    {
+        typedef unary_generator<Subject, plus<Subject>> base_type;
+        static bool const handles_container = true;
+
+        plus(Subject const& subject)
+          : base_type(subject) {}
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            bool result = false;
+            auto first = traits::begin(attr);
+            auto last = traits::end(attr);
+            for (/**/; first != last; ++first)
+            {
+                if (detail::generate_item(this->subject, sink, context, *first))
+                    result = true;
+            }
+            return result && spirit::karma::detail::sink_is_good(sink);
+        }
+
+        // Without an attribute the subject is generated once
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const
+        {
+            return this->subject.generate(sink, context, unused) &&
+                spirit::karma::detail::sink_is_good(sink);
+        }
+    };
+
+    template <typename Subject>
+    inline plus<typename extension::as_generator<Subject>::value_type>
+    operator+(Subject const& subject)
+    {
+        return { as_generator(subject) };
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Subject, typename Context>
+    struct attribute_of<x3::karma::plus<Subject>, Context>
+        : build_container<
+            typename attribute_of<Subject, Context>::type> {};
+}}}}
+
+#endif
@@ -0,0 +1,73 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_SEQUENCE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_SEQUENCE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/operator/detail/sequence.hpp>
+#include <boost/mpl/bool.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // a << b: the attribute is split between the elements having one. A
+    // fusion sequence is partitioned (as for X3 sequence parsers), a
+    // container hands its items to the elements in order, and an element
+    // which is the only one having an attribute gets the whole of it.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Left, typename Right>
+    struct sequence : binary_generator<Left, Right, sequence<Left, Right>>
+    {
+        typedef binary_generator<Left, Right, sequence<Left, Right>> base_type;
+
+        sequence(Left const& left, Right const& right)
+            : base_type(left, right) {}
+
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const
+        {
+            return this->left.generate(sink, context, unused)
+                && this->right.generate(sink, context, unused);
+        }
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            typedef typename traits::attribute_category<Attribute>::type
+                category;
+            typedef mpl::bool_<traits::has_attribute<Left, Context>::value>
+                l_has_attribute;
+            typedef mpl::bool_<traits::has_attribute<Right, Context>::value>
+                r_has_attribute;
+
+            return detail::generate_sequence(*this, sink, context, attr
+              , category(), l_has_attribute(), r_has_attribute());
+        }
+    };
+
+    template <typename Left, typename Right>
+    inline sequence<
+        typename extension::as_generator<Left>::value_type
+      , typename extension::as_generator<Right>::value_type>
+    operator<<(Left const& left, Right const& right)
+    {
+        return { as_generator(left), as_generator(right) };
+    }
+}}}}
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename Left, typename Right, typename Context>
+    struct attribute_of<x3::karma::sequence<Left, Right>, Context>
+        : x3::karma::detail::attribute_of_sequence<Left, Right, Context> {};
+}}}}
+
+#endif
@@ -0,0 +1,268 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_LITERAL_STRING_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_LITERAL_STRING_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generator.hpp>
+#include <boost/spirit/home/x3/karma/core/delimit_out.hpp>
+#include <boost/spirit/home/x3/karma/support/case_modifier.hpp>
+#include <boost/spirit/home/x3/karma/support/optional_value.hpp>
+#include <boost/spirit/home/karma/detail/string_generate.hpp>
+#include <boost/spirit/home/support/char_encoding/standard.hpp>
+#include <boost/spirit/home/support/char_encoding/standard_wide.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/add_reference.hpp>
+#include <boost/type_traits/add_const.hpp>
+#include <string>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    namespace detail
+    {
+        template <typename OutputIterator, typename Encoding
+          , typename Context, typename String>
+        inline bool string_generate(OutputIterator& sink
+          , Context const& context, String const& str)
+        {
+            typedef char_conversion<Encoding, Context> conversion;
+            return spirit::karma::detail::string_generate(sink, str
+                  , typename conversion::encoding()
+                  , typename conversion::tag()) &&
+                   karma::delimit_out(sink, context);
+        }
+
+        template <typename String, typename Attribute>
+        inline bool string_matches(String const& str, Attribute const& attr
+          , mpl::true_ /*has_attribute*/)
+        {
+            return has_optional_value(attr) && optional_value(attr) == str;
+        }
+
+        template <typename String>
+        inline bool string_matches(String const&, unused_type, mpl::true_)
+        {
+            return true;
+        }
+
+        // generators without attribute ignore the one supplied
+        template <typename String, typename Attribute>
+        inline bool string_matches(String const&, Attribute const&
+          , mpl::false_ /*has_attribute*/)
+        {
+            return true;
+        }
+    }
+
+    // A literal string: lit("abc") generates its string without an
+    // attribute, string("abc") takes an attribute and fails unless the
+    // attribute is that string.
+    template <typename String, typename Encoding,
+        typename Attribute = std::basic_string<typename Encoding::char_type>>
+    struct literal_string : generator<literal_string<String, Encoding, Attribute>>
+    {
+        typedef typename Encoding::char_type char_type;
+        typedef Encoding encoding;
+        typedef Attribute attribute_type;
+        static bool const has_attribute =
+            !is_same<unused_type, attribute_type>::value;
+
+        literal_string(typename add_reference< typename add_const<String>::type >::type str)
+          : str(str)
+        {}
+
+        template <typename OutputIterator, typename Context, typename Attribute_>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute_ const& attr) const
+        {
+            return detail::string_matches(str, attr
+                  , mpl::bool_<has_attribute>()) &&
+                detail::string_generate<OutputIterator, Encoding>(
+                    sink, context, str);
+        }
+
+        String str;
+    };
+
+    template <typename Encoding>
+    struct any_string : generator<any_string<Encoding>>
+    {
+        typedef typename Encoding::char_type char_type;
+        typedef Encoding encoding;
+        typedef std::basic_string<char_type> attribute_type;
+        static bool const has_attribute = true;
+        static bool const handles_container = true;
+
+        template <typename OutputIterator, typename Context, typename Attribute>
+        bool generate(OutputIterator& sink, Context const& context
+          , Attribute const& attr) const
+        {
+            if (!detail::has_optional_value(attr))
+                return false;       // fail if it's an uninitialized optional
+
+            return detail::string_generate<OutputIterator, Encoding>(
+                sink, context, detail::optional_value(attr));
+        }
+
+        // It is not possible (doesn't make sense) to use string without
+        // providing any attribute, as the generator doesn't 'know' what
+        // string to output.
+        template <typename OutputIterator, typename Context>
+        bool generate(OutputIterator& sink, Context const& context
+          , unused_type) const = delete;
+
+        literal_string<char_type const*, Encoding>
+        operator()(char_type const* s) const
+        {
+            return { s };
+        }
+
+        literal_string<std::basic_string<char_type>, Encoding>
+        operator()(std::basic_string<char_type> const& s) const
+        {
+            return { s };
+        }
+    };
+
+    namespace standard
+    {
+        typedef any_string<char_encoding::standard> string_type;
+        auto const string = string_type{};
+
+        inline literal_string<char const*, char_encoding::standard, unused_type>
+        lit(char const* s)
+        {
+            return { s };
+        }
+
+        inline literal_string<std::basic_string<char>, char_encoding::standard, unused_type>
+        lit(std::basic_string<char> const& s)
+        {
+            return { s };
+        }
+    }
+
+#ifndef BOOST_SPIRIT_NO_STANDARD_WIDE
+    namespace standard_wide
+    {
+        typedef any_string<char_encoding::standard_wide> string_type;
+        auto const string = string_type{};
+
+        inline literal_string<wchar_t const*, char_encoding::standard_wide, unused_type>
+        lit(wchar_t const* s)
+        {
+            return { s };
+        }
+
+        inline literal_string<std::basic_string<wchar_t>, char_encoding::standard_wide, unused_type>
+        lit(std::basic_string<wchar_t> const& s)
+        {
+            return { s };
+        }
+    }
+#endif
+
+    using standard::string_type;
+    using standard::string;
+    using standard::lit;
+#ifndef BOOST_SPIRIT_NO_STANDARD_WIDE
+    using standard_wide::lit;
+#endif
+
+    namespace extension
+    {
+        template <int N>
+        struct as_generator<char[N]>
+        {
+            typedef literal_string<
+                char const*, char_encoding::standard, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(char const* s)
+            {
+                return type(s);
+            }
+        };
+
+        template <int N>
+        struct as_generator<char const[N]> : as_generator<char[N]> {};
+
+#ifndef BOOST_SPIRIT_NO_STANDARD_WIDE
+        template <int N>
+        struct as_generator<wchar_t[N]>
+        {
+            typedef literal_string<
+                wchar_t const*, char_encoding::standard_wide, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(wchar_t const* s)
+            {
+                return type(s);
+            }
+        };
+
+        template <int N>
+        struct as_generator<wchar_t const[N]> : as_generator<wchar_t[N]> {};
+#endif
+
+        template <>
+        struct as_generator<char const*>
+        {
+            typedef literal_string<
+                char const*, char_encoding::standard, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(char const* s)
+            {
+                return type(s);
+            }
+        };
+
+        template <>
+        struct as_generator< std::basic_string<char> >
+        {
+            typedef literal_string<
+                std::basic_string<char>, char_encoding::standard, unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(std::basic_string<char> const& s)
+            {
+                return type(s);
+            }
+        };
+
+#ifndef BOOST_SPIRIT_NO_STANDARD_WIDE
+        template <>
+        struct as_generator< std::basic_string<wchar_t> >
+        {
+            typedef literal_string<
+                std::basic_string<wchar_t>, char_encoding::standard_wide
+              , unused_type>
+            type;
+
+            typedef type value_type;
+
+            static type call(std::basic_string<wchar_t> const& s)
+            {
+                return type(s);
+            }
+        };
+#endif
+    }
+}}}}
+
+#endif
@@ -0,0 +1,63 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_CASE_MODIFIER_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_CASE_MODIFIER_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/support/context.hpp>
+#include <boost/spirit/home/support/unused.hpp>
+#include <boost/spirit/home/support/char_class.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+#include <boost/utility/declval.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    // upper[] and lower[] store spirit::tag::upper or spirit::tag::lower in
+    // the context under this tag
+    struct case_modifier_tag;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The character encoding and the tag to hand to the Spirit.Karma
+    // inserters for the given context: both are spirit::unused_type (the
+    // characters are written as they are) unless a case modifier is active.
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename Tag>
+        struct case_tag
+        {
+            typedef Tag type;
+        };
+
+        template <>
+        struct case_tag<x3::unused_type>
+        {
+            typedef spirit::unused_type type;
+        };
+    }
+
+    template <typename Encoding, typename Context>
+    struct char_conversion
+    {
+        typedef typename detail::case_tag<
+            typename remove_cv<typename remove_reference<
+                decltype(x3::get<case_modifier_tag>(
+                    boost::declval<Context const&>()))
+            >::type>::type
+        >::type tag;
+
+        typedef typename mpl::if_<
+            is_same<tag, spirit::unused_type>, spirit::unused_type, Encoding
+        >::type encoding;
+    };
+}}}}
+
+#endif
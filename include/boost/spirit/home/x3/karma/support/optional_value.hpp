@@ -0,0 +1,47 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_OPTIONAL_VALUE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_OPTIONAL_VALUE_OCT_17_2016_0900AM
+
+#include <boost/optional/optional.hpp>
+
+namespace boost { namespace spirit { namespace x3 { namespace karma
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The primitive generators accept an optional attribute in place of the
+    // value: an uninitialized one fails the generator (as in Spirit.Karma).
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename T>
+        inline bool has_optional_value(T const&)
+        {
+            return true;
+        }
+
+        template <typename T>
+        inline bool has_optional_value(boost::optional<T> const& val)
+        {
+            return !!val;
+        }
+
+        template <typename T>
+        inline T const& optional_value(T const& val)
+        {
+            return val;
+        }
+
+        template <typename T>
+        inline T const& optional_value(boost::optional<T> const& val)
+        {
+            return *val;
+        }
+    }
+}}}}
+
+#endif
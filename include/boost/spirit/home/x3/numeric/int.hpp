@@ -10,6 +10,7 @@
 #include <boost/spirit/home/x3/core/parser.hpp>
 #include <boost/spirit/home/x3/core/skip_over.hpp>
 #include <boost/spirit/home/x3/support/numeric_utils/extract_int.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 #include <cstdint>
 
 namespace boost { namespace spirit { namespace x3
@@ -59,4 +60,22 @@ namespace boost { namespace spirit { namespace x3
 
 }}}
 
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    // a digit or a sign, unless no digits are needed
+    template <typename T, unsigned Radix, unsigned MinDigits, int MaxDigits>
+    struct first_set<int_parser<T, Radix, MinDigits, MaxDigits>>
+    {
+        static bool const is_known = MinDigits != 0;
+
+        template <typename Char, typename Context>
+        static bool may_start(
+            int_parser<T, Radix, MinDigits, MaxDigits> const&, Char ch, Context const&)
+        {
+            return MinDigits == 0 || ch == '-' || ch == '+'
+                || x3::detail::radix_traits<Radix>::is_valid(ch);
+        }
+    };
+}}}}
+
 #endif
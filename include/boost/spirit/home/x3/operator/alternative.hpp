@@ -26,8 +26,8 @@ namespace boost { namespace spirit { namespace x3
             Iterator& first, Iterator const& last
           , Context const& context, RContext& rcontext, unused_type) const
         {
-            return this->left.parse(first, last, context, rcontext, unused)
-               || this->right.parse(first, last, context, rcontext, unused);
+            return detail::parse_alternatives(
+                *this, first, last, context, rcontext, unused);
         }
 
         template <typename Iterator, typename Context
@@ -36,8 +36,8 @@ namespace boost { namespace spirit { namespace x3
             Iterator& first, Iterator const& last
           , Context const& context, RContext& rcontext, Attribute& attr) const
         {
-            return detail::parse_alternative(this->left, first, last, context, rcontext, attr)
-               || detail::parse_alternative(this->right, first, last, context, rcontext, attr);
+            return detail::parse_alternatives(
+                *this, first, last, context, rcontext, attr);
         }
     };
 
@@ -56,6 +56,21 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     template <typename Left, typename Right, typename Context>
     struct attribute_of<x3::alternative<Left, Right>, Context>
         : x3::detail::attribute_of_alternative<Left, Right, Context> {};
+
+    template <typename Left, typename Right>
+    struct first_set<x3::alternative<Left, Right>>
+    {
+        static bool const is_known =
+            first_set<Left>::is_known && first_set<Right>::is_known;
+
+        template <typename Char, typename Context>
+        static bool may_start(
+            x3::alternative<Left, Right> const& p, Char ch, Context const& context)
+        {
+            return first_set<Left>::may_start(p.left, ch, context)
+                || first_set<Right>::may_start(p.right, ch, context);
+        }
+    };
 }}}}
 
 #endif
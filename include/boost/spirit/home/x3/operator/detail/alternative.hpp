@@ -13,7 +13,9 @@
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
 #include <boost/spirit/home/x3/support/traits/variant_has_substitute.hpp>
 #include <boost/spirit/home/x3/support/traits/variant_find_substitute.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 #include <boost/spirit/home/x3/core/detail/parse_into_container.hpp>
+#include <boost/spirit/home/x3/core/skip_over.hpp>
 #include <boost/variant/variant.hpp>
 
 #include <boost/mpl/copy_if.hpp>
@@ -22,11 +24,14 @@
 #include <boost/mpl/insert_range.hpp>
 #include <boost/mpl/eval_if.hpp>
 #include <boost/mpl/vector.hpp>
+#include <boost/mpl/int.hpp>
 
 #include <boost/fusion/include/front.hpp>
 
 #include <boost/type_traits/is_same.hpp>
 
+#include <iterator>
+
 namespace boost { namespace spirit { namespace x3
 {
     template <typename Left, typename Right>
@@ -256,6 +261,104 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
     }
 
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  Dispatch on the first character. When enough branches of a chain of
+    //  alternatives know their FIRST set (see traits/first_set.hpp), the
+    //  chain looks at the character the branches start at (after skipping)
+    //  once, and skips the branches that cannot start with it. The other
+    //  branches are tried in order, as usual, so what matches is exactly
+    //  what ordered trial would match.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Parser>
+    struct alternative_first_count
+      : mpl::int_<traits::first_set<Parser>::is_known> {};
+
+    template <typename Left, typename Right>
+    struct alternative_first_count<alternative<Left, Right>>
+      : mpl::int_<
+            alternative_first_count<Left>::value
+          + alternative_first_count<Right>::value> {};
+
+    template <typename Parser>
+    struct dispatch_on_first
+      : mpl::bool_<(alternative_first_count<Parser>::value >= 2)> {};
+
+    template <typename Parser, typename Iterator, typename Context
+      , typename RContext>
+    bool parse_alternative_branch(Parser const& p, Iterator& first, Iterator const& last
+      , Context const& context, RContext& rcontext, unused_type)
+    {
+        return p.parse(first, last, context, rcontext, unused);
+    }
+
+    template <typename Parser, typename Iterator, typename Context
+      , typename RContext, typename Attribute>
+    bool parse_alternative_branch(Parser const& p, Iterator& first, Iterator const& last
+      , Context const& context, RContext& rcontext, Attribute& attr)
+    {
+        return parse_alternative(p, first, last, context, rcontext, attr);
+    }
+
+    template <typename Parser, typename Char, typename Iterator
+      , typename Context, typename RContext, typename Attribute>
+    bool parse_alternative_first(Parser const& p, Char ch
+      , Iterator& first, Iterator const& last
+      , Context const& context, RContext& rcontext, Attribute& attr)
+    {
+        return traits::first_set<Parser>::may_start(p, ch, context)
+            && parse_alternative_branch(p, first, last, context, rcontext, attr);
+    }
+
+    template <typename Left, typename Right, typename Char, typename Iterator
+      , typename Context, typename RContext, typename Attribute>
+    bool parse_alternative_first(alternative<Left, Right> const& p, Char ch
+      , Iterator& first, Iterator const& last
+      , Context const& context, RContext& rcontext, Attribute& attr)
+    {
+        typedef detail::pass_variant_attribute<
+            alternative<Left, Right>, Attribute, Context> pass;
+
+        typename pass::type attr_ = pass::call(attr);
+        return parse_alternative_first(p.left, ch, first, last, context, rcontext, attr_)
+            || parse_alternative_first(p.right, ch, first, last, context, rcontext, attr_);
+    }
+
+    template <typename Left, typename Right, typename Iterator
+      , typename Context, typename RContext, typename Attribute>
+    bool parse_alternatives(alternative<Left, Right> const& p
+      , Iterator& first, Iterator const& last
+      , Context const& context, RContext& rcontext, Attribute& attr, mpl::false_)
+    {
+        return parse_alternative_branch(p.left, first, last, context, rcontext, attr)
+            || parse_alternative_branch(p.right, first, last, context, rcontext, attr);
+    }
+
+    template <typename Left, typename Right, typename Iterator
+      , typename Context, typename RContext, typename Attribute>
+    bool parse_alternatives(alternative<Left, Right> const& p
+      , Iterator& first, Iterator const& last
+      , Context const& context, RContext& rcontext, Attribute& attr, mpl::true_)
+    {
+        Iterator i = first;
+        x3::skip_over(i, last, context);
+        if (i == last)
+            return parse_alternatives(p, first, last, context, rcontext, attr, mpl::false_());
+
+        typename std::iterator_traits<Iterator>::value_type const ch = *i;
+        return parse_alternative_first(p, ch, first, last, context, rcontext, attr);
+    }
+
+    template <typename Left, typename Right, typename Iterator
+      , typename Context, typename RContext, typename Attribute>
+    bool parse_alternatives(alternative<Left, Right> const& p
+      , Iterator& first, Iterator const& last
+      , Context const& context, RContext& rcontext, Attribute& attr)
+    {
+        return parse_alternatives(p, first, last, context, rcontext, attr
+          , dispatch_on_first<alternative<Left, Right>>());
+    }
+
+
     template <typename Left, typename Right, typename Context, typename RContext>
     struct parse_into_container_impl<alternative<Left, Right>, Context, RContext>
     {
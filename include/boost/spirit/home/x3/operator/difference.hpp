@@ -10,6 +10,7 @@
 #include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
 #include <boost/spirit/home/x3/support/traits/has_attribute.hpp>
 #include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -66,6 +67,10 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     template <typename Left, typename Right, typename Context>
     struct has_attribute<x3::difference<Left, Right>, Context>
         : has_attribute<Left, Context> {};
+
+    template <typename Left, typename Right>
+    struct first_set<x3::difference<Left, Right>>
+        : left_first_set<x3::difference<Left, Right>> {};
 }}}}
 
 #endif
@@ -12,6 +12,7 @@
 #include <boost/spirit/home/x3/support/traits/container_traits.hpp>
 #include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
 #include <boost/spirit/home/x3/core/detail/parse_into_container.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -63,6 +64,10 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     struct attribute_of<x3::list<Left, Right>, Context>
         : traits::build_container<
             typename attribute_of<Left, Context>::type> {};
+
+    template <typename Left, typename Right>
+    struct first_set<x3::list<Left, Right>>
+        : left_first_set<x3::list<Left, Right>> {};
 }}}}
 
 #endif
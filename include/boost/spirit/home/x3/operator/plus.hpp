@@ -12,6 +12,7 @@
 #include <boost/spirit/home/x3/support/traits/container_traits.hpp>
 #include <boost/spirit/home/x3/support/traits/attribute_of.hpp>
 #include <boost/spirit/home/x3/core/detail/parse_into_container.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -54,6 +55,10 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     struct attribute_of<x3::plus<Subject>, Context>
         : build_container<
             typename attribute_of<Subject, Context>::type> {};
+
+    template <typename Subject>
+    struct first_set<x3::plus<Subject>>
+        : subject_first_set<x3::plus<Subject>> {};
 }}}}
 
 #endif
@@ -11,6 +11,7 @@
 #include <boost/spirit/home/x3/core/parser.hpp>
 #include <boost/spirit/home/x3/operator/detail/sequence.hpp>
 #include <boost/spirit/home/x3/directive/expect.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -67,6 +68,10 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     template <typename Left, typename Right, typename Context>
     struct attribute_of<x3::sequence<Left, Right>, Context>
         : x3::detail::attribute_of_sequence<Left, Right, Context> {};
+
+    template <typename Left, typename Right>
+    struct first_set<x3::sequence<Left, Right>>
+        : left_first_set<x3::sequence<Left, Right>> {};
 }}}}
 
 #endif
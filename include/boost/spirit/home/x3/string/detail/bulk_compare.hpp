@@ -0,0 +1,187 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_BULK_COMPARE_OCT_16_2016_0915AM)
+#define BOOST_SPIRIT_X3_BULK_COMPARE_OCT_16_2016_0915AM
+
+#include <boost/spirit/home/x3/support/no_case.hpp>
+#include <boost/spirit/home/x3/support/traits/is_contiguous_iterator.hpp>
+#include <boost/spirit/home/support/char_encoding/ascii.hpp>
+#include <boost/spirit/home/support/char_encoding/iso8859_1.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Literals are compared in bulk (instead of one char per iterator step)
+    // when the input is contiguous and holds the same char type as the
+    // literal.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename Iterator>
+    struct is_bulk_comparable
+      : mpl::bool_<
+            traits::is_contiguous_iterator<Iterator>::value
+         && is_same<Char, typename remove_const<
+                typename std::iterator_traits<Iterator>::value_type>::type>::value
+        >
+    {};
+
+    // Encodings whose case mapping in the 7-bit range is plain ASCII,
+    // independent of any locale.
+    template <typename Encoding>
+    struct has_ascii_case_folding : mpl::false_ {};
+
+    template <>
+    struct has_ascii_case_folding<char_encoding::ascii> : mpl::true_ {};
+
+    template <>
+    struct has_ascii_case_folding<char_encoding::iso8859_1> : mpl::true_ {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // SIMD-within-a-register helpers working on 8 chars at a time
+    ///////////////////////////////////////////////////////////////////////////
+    typedef boost::uint64_t bulk_word;
+
+    bulk_word const bulk_ones = 0x0101010101010101ull;
+    bulk_word const bulk_lows = bulk_ones * 0x7f;
+    bulk_word const bulk_highs = bulk_ones * 0x80;
+
+    inline bulk_word load_bulk_word(char const* p)
+    {
+        bulk_word w;
+        std::memcpy(&w, p, sizeof(w));
+        return w;
+    }
+
+    inline bulk_word load_bulk_word(char const* p, std::size_t n)
+    {
+        bulk_word w = 0;
+        std::memcpy(&w, p, n);
+        return w;
+    }
+
+    // 0x80 in every byte of w that is zero, 0 in every other byte
+    inline bulk_word zero_bytes(bulk_word w)
+    {
+        return ~(((w & bulk_lows) + bulk_lows) | w | bulk_lows);
+    }
+
+    // Map 'A'..'Z' to 'a'..'z'. All bytes of w must be 7-bit.
+    inline bulk_word ascii_tolower(bulk_word w)
+    {
+        bulk_word const above_z = w + bulk_ones * (0x7f - 'Z');
+        bulk_word const from_a = w + bulk_ones * (0x80 - 'A');
+        return w | (((from_a & ~above_z) & bulk_highs) >> 2);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Compare n chars of a literal against n chars of input
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename CaseCompareFunc>
+    inline bool compare_each(
+        Char const* lit, Char const* in, std::size_t n
+      , CaseCompareFunc const& compare)
+    {
+        for (std::size_t i = 0; i != n; ++i)
+            if (compare(lit[i], in[i]) != 0)
+                return false;
+        return true;
+    }
+
+    template <typename Char, typename CaseCompareFunc>
+    inline bool bulk_compare(
+        Char const* lit, Char const* in, std::size_t n
+      , CaseCompareFunc const& compare)
+    {
+        return detail::compare_each(lit, in, n, compare);
+    }
+
+    template <typename Char, typename Encoding>
+    inline bool bulk_compare(
+        Char const* lit, Char const* in, std::size_t n
+      , case_compare<Encoding> const&)
+    {
+        // char_traits::compare boils down to (vectorized) memcmp/wmemcmp
+        return std::char_traits<Char>::compare(lit, in, n) == 0;
+    }
+
+    template <typename Encoding>
+    inline bool bulk_compare(
+        char const* lit, char const* in, std::size_t n
+      , no_case_compare<Encoding> const& compare)
+    {
+        while (n != 0)
+        {
+            // the last chunk may be shorter than a word; the unused bytes
+            // are zero in both words
+            std::size_t const size = n < sizeof(bulk_word) ? n : sizeof(bulk_word);
+            bulk_word const l = load_bulk_word(lit, size);
+            bulk_word const r = load_bulk_word(in, size);
+
+            // fold the case of a whole word if the encoding allows it,
+            // otherwise (or for 8-bit chars) ask the encoding char by char
+            if (l != r)
+            {
+                if (has_ascii_case_folding<Encoding>::value && !((l | r) & bulk_highs))
+                {
+                    if (ascii_tolower(l) != ascii_tolower(r))
+                        return false;
+                }
+                else if (!detail::compare_each(lit, in, size, compare))
+                {
+                    return false;
+                }
+            }
+            lit += size;
+            in += size;
+            n -= size;
+        }
+        return true;
+    }
+
+    // Compare n chars of input against the upper and lower case variants
+    // of a literal: each char has to match either of them.
+    template <typename Char>
+    inline bool compare_each(
+        Char const* uc, Char const* lc, Char const* in, std::size_t n)
+    {
+        for (std::size_t i = 0; i != n; ++i)
+            if (uc[i] != in[i] && lc[i] != in[i])
+                return false;
+        return true;
+    }
+
+    template <typename Char>
+    inline bool bulk_compare(
+        Char const* uc, Char const* lc, Char const* in, std::size_t n)
+    {
+        return detail::compare_each(uc, lc, in, n);
+    }
+
+    inline bool bulk_compare(
+        char const* uc, char const* lc, char const* in, std::size_t n)
+    {
+        for (; n >= sizeof(bulk_word); n -= sizeof(bulk_word)
+          , uc += sizeof(bulk_word), lc += sizeof(bulk_word)
+          , in += sizeof(bulk_word))
+        {
+            bulk_word const w = load_bulk_word(in);
+            if ((zero_bytes(w ^ load_bulk_word(uc))
+                    | zero_bytes(w ^ load_bulk_word(lc))) != bulk_highs)
+                return false;
+        }
+        return detail::compare_each(uc, lc, in, n);
+    }
+}}}}
+
+#endif
@@ -9,6 +9,8 @@
 
 #include <boost/spirit/home/x3/char/char.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
+#include <boost/spirit/home/x3/string/detail/bulk_compare.hpp>
+#include <string>
 
 namespace boost { namespace spirit { namespace x3 { namespace detail
 {
@@ -18,7 +20,7 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
         typedef std::basic_string< Char >  string_type;
         typedef typename string_type::const_iterator const_iterator;
 
-        no_case_string(char_type const* str)
+        no_case_string(Char const* str)
           : lower(str)
           , upper(str)
         {
@@ -29,8 +31,8 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             Encoding encoding;
             for (; loi != lower.end(); ++loi, ++upi)
             {
-                *loi = static_cast<char_type>(encoding.tolower(encoded_char_type(*loi)));
-                *upi = static_cast<char_type>(encoding.toupper(encoded_char_type(*upi)));
+                *loi = static_cast<Char>(encoding.tolower(encoded_char_type(*loi)));
+                *upi = static_cast<Char>(encoding.toupper(encoded_char_type(*upi)));
             }
         }
         string_type lower;
@@ -41,7 +43,25 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
     template <typename String, typename Iterator, typename Attribute>
     inline bool no_case_string_parse(
         String const& str
-      , Iterator& first, Iterator const& last, Attribute& attr)
+      , Iterator& first, Iterator const& last, Attribute& attr, mpl::true_)
+    {
+        std::size_t const len = str.upper.size();
+        if (std::size_t(last - first) < len)
+            return false;
+        if (len != 0 && !detail::bulk_compare(str.upper.data(), str.lower.data()
+              , traits::to_address(first), len))
+            return false;
+
+        Iterator i = first + len;
+        x3::traits::move_to(first, i, attr);
+        first = i;
+        return true;
+    }
+
+    template <typename String, typename Iterator, typename Attribute>
+    inline bool no_case_string_parse(
+        String const& str
+      , Iterator& first, Iterator const& last, Attribute& attr, mpl::false_)
     {
         typename String::const_iterator uc_i = str.upper.begin();
         typename String::const_iterator uc_last = str.upper.end();
@@ -55,6 +75,15 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
         first = i;
         return true;
     }
+
+    template <typename String, typename Iterator, typename Attribute>
+    inline bool no_case_string_parse(
+        String const& str
+      , Iterator& first, Iterator const& last, Attribute& attr)
+    {
+        return detail::no_case_string_parse(str, first, last, attr
+          , is_bulk_comparable<typename String::string_type::value_type, Iterator>());
+    }
 }}}}
 
 #endif
@@ -8,13 +8,42 @@
 #define BOOST_SPIRIT_X3_STRING_PARSE_APR_18_2006_1125PM
 
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
+#include <boost/spirit/home/x3/string/detail/bulk_compare.hpp>
+#include <string>
 
 namespace boost { namespace spirit { namespace x3 { namespace detail
 {
+    template <typename Char, typename Iterator, typename Attribute, typename CaseCompareFunc>
+    inline bool bulk_string_parse(
+        Char const* str, std::size_t len
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare)
+    {
+        if (std::size_t(last - first) < len)
+            return false;
+        if (len != 0 && !detail::bulk_compare(str, traits::to_address(first), len, compare))
+            return false;
+
+        Iterator i = first + len;
+        x3::traits::move_to(first, i, attr);
+        first = i;
+        return true;
+    }
+
+    template <typename Char, typename Iterator, typename Attribute, typename CaseCompareFunc>
+    inline bool string_parse(
+        Char const* str
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare
+      , mpl::true_)
+    {
+        return detail::bulk_string_parse(str, std::char_traits<Char>::length(str)
+          , first, last, attr, compare);
+    }
+
     template <typename Char, typename Iterator, typename Attribute, typename CaseCompareFunc>
     inline bool string_parse(
         Char const* str
-      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare) 
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare
+      , mpl::false_)
     {
         Iterator i = first;
         Char ch = *str;
@@ -31,10 +60,20 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
         return true;
     }
 
+    template <typename Char, typename Iterator, typename Attribute, typename CaseCompareFunc>
+    inline bool string_parse(
+        Char const* str
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare)
+    {
+        return detail::string_parse(str, first, last, attr, compare
+          , is_bulk_comparable<Char, Iterator>());
+    }
+
     template <typename String, typename Iterator, typename Attribute, typename CaseCompareFunc>
     inline bool string_parse(
         String const& str
-      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare)
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare
+      , mpl::false_)
     {
         Iterator i = first;
         typename String::const_iterator stri = str.begin();
@@ -48,6 +87,35 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
         return true;
     }
 
+    template <typename Char, typename Traits, typename Allocator
+      , typename Iterator, typename Attribute, typename CaseCompareFunc>
+    inline bool string_parse(
+        std::basic_string<Char, Traits, Allocator> const& str
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare
+      , mpl::true_)
+    {
+        return detail::bulk_string_parse(str.data(), str.size()
+          , first, last, attr, compare);
+    }
+
+    template <typename String, typename Iterator, typename Attribute, typename CaseCompareFunc>
+    inline bool string_parse(
+        String const& str
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare)
+    {
+        return detail::string_parse(str, first, last, attr, compare, mpl::false_());
+    }
+
+    template <typename Char, typename Traits, typename Allocator
+      , typename Iterator, typename Attribute, typename CaseCompareFunc>
+    inline bool string_parse(
+        std::basic_string<Char, Traits, Allocator> const& str
+      , Iterator& first, Iterator const& last, Attribute& attr, CaseCompareFunc const& compare)
+    {
+        return detail::string_parse(str, first, last, attr, compare
+          , is_bulk_comparable<Char, Iterator>());
+    }
+
     template <typename Char, typename Iterator, typename Attribute>
     inline bool string_parse(
         Char const* uc_i, Char const* lc_i
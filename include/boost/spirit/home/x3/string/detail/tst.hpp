@@ -96,6 +96,21 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             return found;
         }
 
+        // whether a key starts with ch (compared the way find does)
+        template <typename Char_, typename CaseCompare>
+        static bool
+        starts_with(tst_node const* p, Char_ ch, CaseCompare comp)
+        {
+            while (p)
+            {
+                int32_t c = comp(ch, p->id);
+                if (c == 0)
+                    return true;
+                p = c < 0 ? p->lt : p->gt;
+            }
+            return false;
+        }
+
         template <typename Iterator, typename Alloc>
         static T*
         add(
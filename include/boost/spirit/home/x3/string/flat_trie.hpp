@@ -0,0 +1,359 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_FLAT_TRIE_OCT_16_2016_1400PM)
+#define BOOST_SPIRIT_X3_FLAT_TRIE_OCT_16_2016_1400PM
+
+#include <boost/spirit/home/x3/support/no_case.hpp>
+#include <boost/call_traits.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  flat_trie: a Lookup for symbols_parser keeping all of its nodes in one
+    //  contiguous pool, linked by 32 bit indices instead of pointers.
+    //
+    //  The children of a node occupy a contiguous block of the pool, sorted
+    //  by their character. The characters are stored apart from the rest of
+    //  the node, so finding the child to follow scans (or bisects) a dense
+    //  array of characters. Blocks grow in powers of two: a full block is
+    //  moved to the end of the pool (or into a free block of the right
+    //  size) when a child is added.
+    //
+    //  The values live in a deque, so pointers to them stay valid while
+    //  the trie grows. Removed values are kept until their slot is reused
+    //  by a later add (which assigns to it) or the trie is cleared.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename T>
+    struct flat_trie
+    {
+        typedef Char char_type; // the character type
+        typedef T value_type; // the value associated with each entry
+        typedef boost::uint32_t index_type;
+
+        static index_type const npos = index_type(-1);
+
+        flat_trie()
+        {
+            clear();
+        }
+
+        template <typename Iterator, typename CaseCompare>
+        T* find(Iterator& first, Iterator last, CaseCompare comp) const
+        {
+            if (first == last)
+                return 0;
+
+            Iterator i = first;
+            Iterator latest = first;
+            index_type node = 0;
+            index_type found = npos;
+
+            while (i != last)
+            {
+                node = find_child(node, *i, comp);
+                if (node == npos)
+                    break;
+                ++i;
+                if (nodes[node].data != npos)
+                {
+                    found = nodes[node].data;
+                    latest = i;
+                }
+            }
+
+            if (found == npos)
+                return 0;
+            first = latest; // one past the last matching char
+
+            // values are not part of the trie's structure; like the nodes
+            // of tst, they are handed out mutable
+            return const_cast<T*>(&values[found]);
+        }
+
+        template <typename Ch, typename CaseCompare>
+        bool starts_with(Ch ch, CaseCompare comp) const
+        {
+            return find_child(0, ch, comp) != npos;
+        }
+
+        template <typename Iterator>
+        T* add(
+            Iterator first
+          , Iterator last
+          , typename boost::call_traits<T>::param_type val)
+        {
+            if (first == last)
+                return 0;
+
+            index_type node = 0;
+            for (; first != last; ++first)
+                node = insert_child(node, *first);
+
+            if (nodes[node].data == npos)
+                nodes[node].data = new_data(val);
+            return &values[nodes[node].data];
+        }
+
+        template <typename Iterator>
+        void remove(Iterator first, Iterator last)
+        {
+            if (first != last)
+                remove(0, first, last);
+        }
+
+        void clear()
+        {
+            nodes.assign(1, node_info());
+            ids.assign(1, Char());
+            values.clear();
+            free_values.clear();
+            free_blocks.clear();
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for_each(0, std::basic_string<Char>(), f);
+        }
+
+    private:
+
+        struct node_info
+        {
+            node_info()
+              : children(0), size(0), data(npos)
+            {
+            }
+
+            index_type children;    // index of the first child
+            index_type size;        // number of children
+            index_type data;        // index of the value or npos
+        };
+
+        // children blocks are allocated in powers of two
+        static index_type capacity(index_type size)
+        {
+            index_type cap = size ? 1 : 0;
+            while (cap < size)
+                cap <<= 1;
+            return cap;
+        }
+
+        static std::size_t size_class(index_type cap)
+        {
+            std::size_t n = 0;
+            while (cap >>= 1)
+                ++n;
+            return n;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        //  Locate the child of parent matching ch. With case_compare (and the
+        //  same character type), this is an exact comparison and we can
+        //  bisect larger blocks; any other comparison is done char by char.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Ch, typename CaseCompare>
+        index_type find_child(index_type parent, Ch ch, CaseCompare const& comp) const
+        {
+            return scan_children(parent, ch, comp);
+        }
+
+        template <typename Ch, typename CaseCompare>
+        index_type scan_children(index_type parent, Ch ch, CaseCompare const& comp) const
+        {
+            node_info const& n = nodes[parent];
+            for (index_type i = n.children, end = n.children + n.size; i != end; ++i)
+            {
+                if (comp(ch, ids[i]) == 0)
+                    return i;
+            }
+            return npos;
+        }
+
+        template <typename Ch, typename Encoding>
+        index_type find_child(index_type parent, Ch ch, case_compare<Encoding> const& comp) const
+        {
+            return find_child(parent, ch, comp
+              , mpl::bool_<is_same<Char, typename Encoding::char_type>::value>());
+        }
+
+        template <typename Ch, typename Encoding>
+        index_type find_child(index_type parent, Ch ch
+          , case_compare<Encoding> const& comp, mpl::false_) const
+        {
+            return scan_children(parent, ch, comp);
+        }
+
+        template <typename Ch, typename Encoding>
+        index_type find_child(index_type parent, Ch ch
+          , case_compare<Encoding> const&, mpl::true_) const
+        {
+            return find_child(parent, Char(ch));
+        }
+
+        // exact lookup
+        index_type find_child(index_type parent, Char ch) const
+        {
+            node_info const& n = nodes[parent];
+            if (n.size <= 16)
+            {
+                for (index_type i = n.children, end = n.children + n.size; i != end; ++i)
+                {
+                    if (ids[i] == ch)
+                        return i;
+                }
+                return npos;
+            }
+
+            Char const* first = &ids[n.children];
+            Char const* last = first + n.size;
+            Char const* i = std::lower_bound(first, last, ch);
+            if (i == last || *i != ch)
+                return npos;
+            return n.children + index_type(i - first);
+        }
+
+        index_type insert_child(index_type parent, Char ch)
+        {
+            index_type const size = nodes[parent].size;
+            index_type children = nodes[parent].children;
+
+            index_type const pos = index_type(std::lower_bound(
+                ids.begin() + children, ids.begin() + children + size, ch)
+                    - (ids.begin() + children));
+            if (pos != size && ids[children + pos] == ch)
+                return children + pos;
+
+            if (size == capacity(size)) // full
+            {
+                index_type const block = allocate(capacity(size + 1));
+                std::copy(ids.begin() + children
+                  , ids.begin() + children + size, ids.begin() + block);
+                std::copy(nodes.begin() + children
+                  , nodes.begin() + children + size, nodes.begin() + block);
+                if (size != 0)
+                    release(children, size);
+                children = block;
+                nodes[parent].children = children;
+            }
+
+            // make room for the new child, keeping the block sorted
+            for (index_type i = children + size; i != children + pos; --i)
+            {
+                ids[i] = ids[i - 1];
+                nodes[i] = nodes[i - 1];
+            }
+            ids[children + pos] = ch;
+            nodes[children + pos] = node_info();
+            nodes[parent].size = size + 1;
+            return children + pos;
+        }
+
+        index_type allocate(index_type cap)
+        {
+            std::size_t const n = size_class(cap);
+            if (n < free_blocks.size() && !free_blocks[n].empty())
+            {
+                index_type const block = free_blocks[n].back();
+                free_blocks[n].pop_back();
+                return block;
+            }
+
+            BOOST_ASSERT(nodes.size() + cap < npos);
+            index_type const block = index_type(nodes.size());
+            nodes.resize(nodes.size() + cap);
+            ids.resize(ids.size() + cap);
+            return block;
+        }
+
+        // a block holding size children has at least capacity(size) slots
+        void release(index_type block, index_type size)
+        {
+            std::size_t const n = size_class(capacity(size));
+            if (free_blocks.size() <= n)
+                free_blocks.resize(n + 1);
+            free_blocks[n].push_back(block);
+        }
+
+        template <typename Iterator>
+        void remove(index_type parent, Iterator first, Iterator last)
+        {
+            index_type const child = find_child(parent, Char(*first));
+            if (child == npos)
+                return;
+
+            if (++first == last)
+            {
+                if (nodes[child].data != npos)
+                {
+                    free_values.push_back(nodes[child].data);
+                    nodes[child].data = npos;
+                }
+            }
+            else
+            {
+                remove(child, first, last);
+            }
+
+            if (nodes[child].data == npos && nodes[child].size == 0)
+            {
+                // drop the child, keeping the block sorted
+                node_info& n = nodes[parent];
+                for (index_type i = child + 1; i != n.children + n.size; ++i)
+                {
+                    ids[i - 1] = ids[i];
+                    nodes[i - 1] = nodes[i];
+                }
+                if (--n.size == 0)
+                    release(n.children, 1);
+            }
+        }
+
+        index_type new_data(typename boost::call_traits<T>::param_type val)
+        {
+            if (!free_values.empty())
+            {
+                index_type const slot = free_values.back();
+                free_values.pop_back();
+                values[slot] = val;
+                return slot;
+            }
+
+            values.push_back(val);
+            return index_type(values.size() - 1);
+        }
+
+        template <typename F>
+        void for_each(index_type parent, std::basic_string<Char> const& prefix, F& f) const
+        {
+            node_info const& n = nodes[parent];
+            for (index_type i = n.children; i != n.children + n.size; ++i)
+            {
+                std::basic_string<Char> const s = prefix + ids[i];
+                for_each(i, s, f);
+                if (nodes[i].data != npos)
+                    f(s, values[nodes[i].data]);
+            }
+        }
+
+        std::vector<node_info> nodes;   // the node pool, the root is nodes[0]
+        std::vector<Char> ids;          // the node characters, same indices
+        std::deque<T> values;
+        std::vector<index_type> free_values;
+        std::vector<std::vector<index_type>> free_blocks; // by size class
+    };
+}}}
+
+#endif
@@ -13,6 +13,7 @@
 #include <boost/spirit/home/x3/support/no_case.hpp>
 #include <boost/spirit/home/x3/string/detail/no_case_string_parse.hpp>
 #include <boost/spirit/home/x3/support/utility/utf8.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
 #include <boost/spirit/home/support/char_encoding/ascii.hpp>
 #include <boost/spirit/home/support/char_encoding/standard.hpp>
 #include <boost/spirit/home/support/char_encoding/standard_wide.hpp>
@@ -251,4 +252,23 @@ namespace boost { namespace spirit { namespace x3
     };
 }}}
 
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    template <typename String, typename Encoding, typename Attribute>
+    struct first_set<literal_string<String, Encoding, Attribute>>
+    {
+        static bool const is_known = true;
+
+        // the empty string matches anything
+        template <typename Char, typename Context>
+        static bool may_start(
+            literal_string<String, Encoding, Attribute> const& p
+          , Char ch, Context const& context)
+        {
+            return !p.str[0]
+                || get_case_compare<Encoding>(context)(p.str[0], ch) == 0;
+        }
+    };
+}}}}
+
 #endif
@@ -0,0 +1,364 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_PERFECT_HASH_OCT_16_2016_0230PM)
+#define BOOST_SPIRIT_X3_PERFECT_HASH_OCT_16_2016_0230PM
+
+#include <boost/spirit/home/x3/string/tst.hpp>
+#include <boost/spirit/home/x3/string/detail/bulk_compare.hpp>
+#include <boost/spirit/home/x3/support/no_case.hpp>
+#include <boost/spirit/home/support/detail/perfect_hash.hpp>
+#include <boost/call_traits.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace boost { namespace spirit { namespace x3
+{
+    namespace detail
+    {
+        using spirit::detail::perfect_hash_index;
+        using spirit::detail::perfect_hash_npos;
+
+        ///////////////////////////////////////////////////////////////////////
+        //  Whether a comparison can be looked up by hash. The hash folds the
+        //  case of ASCII and Latin-1 letters, which is all case insensitive
+        //  matching does in the ascii and iso8859_1 encodings. Anything else
+        //  verifies every key.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Char, typename CaseCompare>
+        struct is_perfect_hash_compare : mpl::false_ {};
+
+        template <typename Char, typename Encoding>
+        struct is_perfect_hash_compare<Char, case_compare<Encoding>>
+          : is_same<Char, typename Encoding::char_type> {};
+
+        template <typename Char, typename Encoding>
+        struct is_perfect_hash_compare<Char, no_case_compare<Encoding>>
+          : mpl::bool_<
+                is_same<Char, typename Encoding::char_type>::value
+             && has_ascii_case_folding<Encoding>::value
+            > {};
+
+        template <typename CaseCompare>
+        struct perfect_hash_equal
+        {
+            template <typename Ch, typename Char>
+            bool operator()(Ch ch, Char key) const
+            {
+                return comp(ch, key) == 0;
+            }
+
+            CaseCompare comp;
+        };
+
+        template <typename Table, typename Iterator, typename CaseCompare>
+        inline perfect_hash_index perfect_hash_find(Table const& table
+          , Iterator& first, Iterator const& last, CaseCompare const& comp
+          , mpl::true_)
+        {
+            return spirit::detail::perfect_hash_find(table, first, last
+              , spirit::detail::perfect_hash_pass_through()
+              , perfect_hash_equal<CaseCompare>{comp});
+        }
+
+        template <typename Table, typename Iterator, typename CaseCompare>
+        inline perfect_hash_index perfect_hash_find(Table const& table
+          , Iterator& first, Iterator const& last, CaseCompare const& comp
+          , mpl::false_)
+        {
+            return spirit::detail::perfect_hash_scan(table, first, last
+              , perfect_hash_equal<CaseCompare>{comp});
+        }
+
+        template <typename Table, typename Iterator, typename CaseCompare>
+        inline perfect_hash_index perfect_hash_find(Table const& table
+          , Iterator& first, Iterator const& last, CaseCompare const& comp)
+        {
+            return detail::perfect_hash_find(table, first, last, comp
+              , is_perfect_hash_compare<typename Table::char_type, CaseCompare>());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  perfect_hash: a Lookup for symbols tables that are filled once and
+    //  then only searched (keywords, reserved words, ...).
+    //
+    //  It behaves like (and is) a tst until freeze() is called. freeze()
+    //  compiles the symbols into a minimal perfect hash table (see
+    //  support/detail/perfect_hash.hpp); lookups then hash the input a
+    //  prefix at a time, for as long as there are keys starting with it,
+    //  and verify the keys found, still returning the longest match. Adding
+    //  or removing symbols afterwards turns the table back into a tst, until
+    //  the next freeze().
+    //
+    //  freeze() moves the values: pointers returned by add no longer refer
+    //  to them.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename T>
+    struct perfect_hash
+    {
+        typedef Char char_type; // the character type
+        typedef T value_type; // the value associated with each entry
+
+        perfect_hash()
+          : frozen(false)
+        {
+        }
+
+        template <typename Iterator, typename CaseCompare>
+        T* find(Iterator& first, Iterator last, CaseCompare comp) const
+        {
+            if (!frozen)
+                return pending.find(first, last, comp);
+
+            detail::perfect_hash_index const e =
+                detail::perfect_hash_find(table, first, last, comp);
+            return e == detail::perfect_hash_npos ? 0 : table.value(e);
+        }
+
+        template <typename Iterator>
+        T* add(
+            Iterator first
+          , Iterator last
+          , typename boost::call_traits<T>::param_type val)
+        {
+            thaw();
+            return pending.add(first, last, val);
+        }
+
+        template <typename Iterator>
+        void remove(Iterator first, Iterator last)
+        {
+            thaw();
+            pending.remove(first, last);
+        }
+
+        void clear()
+        {
+            pending.clear();
+            table.clear();
+            frozen = false;
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            if (frozen)
+                table.for_each(f);
+            else
+                pending.for_each(f);
+        }
+
+        void freeze()
+        {
+            if (!frozen)
+            {
+                table.assign(pending);
+                pending.clear();
+                frozen = true;
+            }
+        }
+
+        bool is_frozen() const
+        {
+            return frozen;
+        }
+
+    private:
+
+        struct adder
+        {
+            template <typename String>
+            void operator()(String const& s, T const& val) const
+            {
+                lookup.add(s.begin(), s.end(), val);
+            }
+
+            tst<Char, T>& lookup;
+        };
+
+        void thaw()
+        {
+            if (frozen)
+            {
+                table.for_each(adder{pending});
+                table.clear();
+                frozen = false;
+            }
+        }
+
+        tst<Char, T> pending;
+        spirit::detail::perfect_hash_table<Char, T> table;
+        bool frozen;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  static_perfect_hash: the perfect hash of a list of symbols known at
+    //  compile time, built by the compiler.
+    //
+    //      constexpr std::pair<char const*, int> keywords[] =
+    //          { { "if", 1 }, { "else", 2 }, { "while", 3 } };
+    //      constexpr auto table = x3::make_perfect_hash(keywords);
+    //
+    //      x3::symbols_parser<char_encoding::standard, int
+    //        , std::remove_const_t<decltype(table)>> const sym(table);
+    //
+    //  The keys are not copied: they have to outlive the table (string
+    //  literals do). T has to be a literal type.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Char, typename T, std::size_t N>
+    struct static_perfect_hash
+    {
+        static_assert(N != 0, "static_perfect_hash needs at least one symbol");
+
+        typedef Char char_type; // the character type
+        typedef T value_type; // the value associated with each entry
+        typedef detail::perfect_hash_index index_type;
+
+        // every key enters at most one prefix per level
+        static constexpr std::size_t max_prefixes =
+            N * spirit::detail::perfect_hash_levels;
+
+        constexpr static_perfect_hash(
+            std::pair<Char const*, T> const (&symbols)[N])
+          : keys_(), sizes_(), values_()
+          , slot_hash_(), slot_longer_(), slot_begin_(), disp_()
+          , entries_(0), base_(0), levels_(0), slots_(0), buckets_(0)
+        {
+            using namespace spirit::detail;
+
+            // the (non-empty) keys
+            index_type index[N] = {};
+            index_type sizes[N] = {};
+            index_type max_size = 0;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                index_type size = 0;
+                while (symbols[i].first[size])
+                    ++size;
+                if (size == 0)
+                    continue;
+
+                index[entries_] = index_type(i);
+                sizes[entries_++] = size;
+                if (base_ == 0 || size < base_)
+                    base_ = size;
+                if (size > max_size)
+                    max_size = size;
+            }
+            if (entries_ == 0)
+                return;
+            levels_ = perfect_hash_level(max_size, base_) + 1;
+
+            // their level prefixes
+            boost::uint64_t hashes[max_prefixes] = {};
+            index_type prefix_key[max_prefixes] = {};
+            index_type nprefixes = 0;
+            for (index_type k = 0; k != entries_; ++k)
+            {
+                index_type const levels = perfect_hash_prefixes(
+                    symbols[index[k]].first, sizes[k], base_, hashes + nprefixes);
+                for (index_type level = 0; level != levels; ++level)
+                {
+                    prefix_key[nprefixes++] =
+                        level + 1 == levels ? k : (k | perfect_hash_marker);
+                }
+            }
+
+            index_type order[max_prefixes] = {};
+            index_type prefix_slots[max_prefixes + 1] = {};
+            index_type scratch[perfect_hash_scratch(max_prefixes)] = {};
+            perfect_hash_shape const shape = build_perfect_hash(
+                hashes, nprefixes, order, prefix_slots, disp_, scratch);
+            slots_ = shape.slots;
+            buckets_ = shape.buckets;
+
+            index_type keys[N] = {};
+            if (buckets_ == 0)
+            {
+                // no table could be built, the entries are scanned
+                for (index_type e = 0; e != entries_; ++e)
+                    keys[e] = e;
+            }
+            else
+            {
+                perfect_hash_layout(prefix_key, sizes, order, prefix_slots
+                  , slots_, keys, slot_begin_, slot_longer_);
+                for (index_type p = 0; p != slots_; ++p)
+                    slot_hash_[p] = hashes[order[prefix_slots[p]]];
+            }
+
+            // lay out the entries slot by slot
+            for (index_type e = 0; e != entries_; ++e)
+            {
+                keys_[e] = symbols[index[keys[e]]].first;
+                sizes_[e] = sizes[keys[e]];
+                values_[e] = symbols[index[keys[e]]].second;
+            }
+        }
+
+        template <typename Iterator, typename CaseCompare>
+        T* find(Iterator& first, Iterator last, CaseCompare comp) const
+        {
+            if (entries_ == 0)
+                return 0;
+
+            index_type const e =
+                detail::perfect_hash_find(*this, first, last, comp);
+
+            // values are handed out mutable, like those of tst (a
+            // symbols_parser holds a copy of the table)
+            return e == detail::perfect_hash_npos ? 0 : const_cast<T*>(&values_[e]);
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for (index_type e = 0; e != entries_; ++e)
+                f(std::basic_string<Char>(keys_[e], sizes_[e]), values_[e]);
+        }
+
+        // the Table interface of detail::perfect_hash_find
+        constexpr index_type base() const { return base_; }
+        constexpr index_type levels() const { return levels_; }
+        constexpr index_type buckets() const { return buckets_; }
+        constexpr boost::uint32_t displacement(index_type b) const { return disp_[b]; }
+        constexpr index_type slots() const { return slots_; }
+        constexpr boost::uint64_t slot_hash(index_type p) const { return slot_hash_[p]; }
+        constexpr bool slot_longer(index_type p) const { return slot_longer_[p]; }
+        constexpr index_type slot_begin(index_type p) const { return slot_begin_[p]; }
+        constexpr index_type entries() const { return entries_; }
+        constexpr index_type size(index_type e) const { return sizes_[e]; }
+        constexpr Char const* key(index_type e) const { return keys_[e]; }
+
+    private:
+
+        Char const* keys_[N];
+        index_type sizes_[N];
+        T values_[N];
+        boost::uint64_t slot_hash_[max_prefixes];
+        bool slot_longer_[max_prefixes];
+        index_type slot_begin_[max_prefixes + 1];
+        boost::uint32_t disp_[max_prefixes];
+        index_type entries_;
+        index_type base_;
+        index_type levels_;
+        index_type slots_;
+        index_type buckets_;
+    };
+
+    template <typename Char, typename T, std::size_t N>
+    constexpr static_perfect_hash<Char, T, N>
+    make_perfect_hash(std::pair<Char const*, T> const (&symbols)[N])
+    {
+        return static_perfect_hash<Char, T, N>(symbols);
+    }
+}}}
+
+#endif
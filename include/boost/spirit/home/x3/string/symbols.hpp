@@ -15,6 +15,8 @@
 #include <boost/spirit/home/x3/support/traits/string_traits.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
 #include <boost/spirit/home/x3/support/no_case.hpp>
+#include <boost/spirit/home/x3/support/traits/first_set.hpp>
+#include <boost/spirit/home/x3/support/utility/sfinae.hpp>
 
 #include <boost/spirit/home/support/char_encoding/ascii.hpp>
 #include <boost/spirit/home/support/char_encoding/iso8859_1.hpp>
@@ -28,6 +30,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include <initializer_list>
+#include <utility>
 
 #if defined(BOOST_MSVC)
 # pragma warning(push)
@@ -94,6 +97,16 @@ namespace boost { namespace spirit { namespace x3
                 add(*si++, *di++);
         }
 
+        // use a copy of a ready made Lookup (e.g. a static_perfect_hash)
+        explicit symbols_parser(Lookup const& table
+              , std::string const& name = "symbols")
+          : add(*this)
+          , remove(*this)
+          , lookup(new Lookup(table))
+          , name_(name)
+        {
+        }
+
         symbols_parser(std::initializer_list<std::pair<char_type const*, T>> syms
               , std::string const & name="symbols")
           : add(*this)
@@ -133,6 +146,13 @@ namespace boost { namespace spirit { namespace x3
             lookup->clear();
         }
 
+        // compile the symbols into a read-only form (for Lookups providing
+        // it, such as perfect_hash)
+        void freeze()
+        {
+            lookup->freeze();
+        }
+
         struct adder;
         struct remover;
 
@@ -335,6 +355,29 @@ namespace boost { namespace spirit { namespace x3
       }
     };
 
+    namespace traits
+    {
+        // Lookups that can tell whether a key starts with a character
+        // (tst does) give symbols a known FIRST set
+        template <typename Encoding, typename T, typename Lookup>
+        struct first_set<symbols_parser<Encoding, T, Lookup>
+          , typename disable_if_substitution_failure<
+                decltype(std::declval<Lookup const&>().starts_with(
+                    std::declval<typename Encoding::char_type>()
+                  , case_compare<Encoding>()))>::type>
+        {
+            static bool const is_known = true;
+
+            template <typename Char, typename Context>
+            static bool may_start(
+                symbols_parser<Encoding, T, Lookup> const& p
+              , Char ch, Context const& context)
+            {
+                return p.lookup->starts_with(ch, get_case_compare<Encoding>(context));
+            }
+        };
+    }
+
     namespace standard
     {
         template <typename T = unused_type>
@@ -54,6 +54,12 @@ namespace boost { namespace spirit { namespace x3
             return node::find(root, first, last, caseCompare);
         }
 
+        template <typename Ch, typename CaseCompare>
+        bool starts_with(Ch ch, CaseCompare caseCompare) const
+        {
+            return node::starts_with(root, ch, caseCompare);
+        }
+
         /*template <typename Iterator>
         T* find(Iterator& first, Iterator last) const
         {
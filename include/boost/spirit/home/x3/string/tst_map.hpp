@@ -8,6 +8,8 @@
 #define BOOST_SPIRIT_X3_TST_MAP_JUNE_03_2007_1143AM
 
 #include <boost/spirit/home/x3/string/detail/tst.hpp>
+#include <boost/spirit/home/x3/support/no_case.hpp>
+#include <iterator>
 #include <unordered_map>
 #include <boost/pool/object_pool.hpp>
 
@@ -42,32 +44,45 @@ namespace boost { namespace spirit { namespace x3
             return assign(rhs);
         }
 
-        template <typename Iterator, typename Filter>
-        T* find(Iterator& first, Iterator last, Filter filter) const
+        // The first character (the key of the map) is looked up as is and,
+        // for case insensitive comparisons, in the other case as well. The
+        // longest match wins.
+        template <typename Iterator, typename CaseCompare>
+        T* find(Iterator& first, Iterator last, CaseCompare caseCompare) const
         {
-            if (first != last)
+            if (first == last)
+                return 0;
+
+            Char keys[3];
+            std::size_t const n = first_keys(*first, keys, caseCompare);
+
+            T* found = 0;
+            Iterator latest = first;
+            for (std::size_t k = 0; k != n; ++k)
             {
-                Iterator save = first;
-                typename map_type::const_iterator
-                    i = map.find(filter(*first++));
+                typename map_type::const_iterator i = map.find(keys[k]);
                 if (i == map.end())
+                    continue;
+
+                Iterator it = first;
+                T* p = node::find(i->second.root, ++it, last, caseCompare);
+                if (p == 0)
                 {
-                    first = save;
-                    return 0;
+                    p = i->second.data;
+                    it = first;
+                    ++it;
                 }
-                if (T* p = node::find(i->second.root, first, last, filter))
+                if (p != 0 && (found == 0 ||
+                        std::distance(first, it) > std::distance(first, latest)))
                 {
-                    return p;
+                    found = p;
+                    latest = it;
                 }
-                return i->second.data;
             }
-            return 0;
-        }
 
-        template <typename Iterator>
-        T* find(Iterator& first, Iterator last) const
-        {
-            return find(first, last, tst_pass_through());
+            if (found != 0)
+                first = latest;
+            return found;
         }
 
         template <typename Iterator>
@@ -183,6 +198,28 @@ namespace boost { namespace spirit { namespace x3
             return *this;
         }
 
+        template <typename CaseCompare>
+        static std::size_t first_keys(Char ch, Char* keys, CaseCompare const&)
+        {
+            keys[0] = ch;
+            return 1;
+        }
+
+        template <typename Encoding>
+        static std::size_t first_keys(Char ch, Char* keys
+          , no_case_compare<Encoding> const&)
+        {
+            std::size_t n = 0;
+            keys[n++] = ch;
+            Char const lower = Char(Encoding::tolower(ch));
+            if (lower != ch)
+                keys[n++] = lower;
+            Char const upper = Char(Encoding::toupper(ch));
+            if (upper != ch && upper != lower)
+                keys[n++] = upper;
+            return n;
+        }
+
         node* new_node(Char id)
         {
             return node_pool.construct(id);
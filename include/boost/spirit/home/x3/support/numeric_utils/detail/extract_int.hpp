@@ -15,7 +15,9 @@
 #include <boost/spirit/home/x3/support/traits/attribute_type.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
 #include <boost/spirit/home/x3/support/traits/numeric_traits.hpp>
+#include <boost/spirit/home/x3/support/traits/is_contiguous_iterator.hpp>
 #include <boost/spirit/home/support/char_encoding/ascii.hpp>
+#include <boost/spirit/home/support/detail/digit_block.hpp>
 
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/iteration/local.hpp>
@@ -27,8 +29,10 @@
 #include <boost/utility/enable_if.hpp>
 
 #include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/is_signed.hpp>
 #include <boost/type_traits/make_unsigned.hpp>
+#include <boost/type_traits/remove_const.hpp>
 
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/and.hpp>
@@ -147,6 +151,20 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             n += static_cast<T>(digit);
             return true;
         }
+
+        template <typename T>
+        inline static bool add_block(T& n, boost::uint32_t block) // checked add
+        {
+            // Ensure n * Radix^8 + block will not overflow
+            static T const max = (std::numeric_limits<T>::max)();
+            static T const scale =
+                static_cast<T>(spirit::detail::digit_block_scale<Radix>::value);
+            if (n > (max - static_cast<T>(block)) / scale)
+                return false;
+
+            n = n * scale + static_cast<T>(block);
+            return true;
+        }
     };
 
     template <unsigned Radix>
@@ -178,6 +196,88 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             n -= static_cast<T>(digit);
             return true;
         }
+
+        template <typename T>
+        inline static bool add_block(T& n, boost::uint32_t block) // checked subtract
+        {
+            // Ensure n * Radix^8 - block will not underflow
+            static T const min = (std::numeric_limits<T>::min)();
+            static T const scale =
+                static_cast<T>(spirit::detail::digit_block_scale<Radix>::value);
+            if (n < (min + static_cast<T>(block)) / scale)
+                return false;
+
+            n = n * scale - static_cast<T>(block);
+            return true;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  block_extractor: Extract 8 digits at a time from contiguous char input
+    //  for as long as they are all valid and fit into n. Returns the number
+    //  of digits consumed; the remaining ones (and any overflow) are left to
+    //  the digit by digit loop.
+    ///////////////////////////////////////////////////////////////////////////
+    template <unsigned Radix, typename Accumulator>
+    struct is_block_accumulator : mpl::false_ {};
+
+    template <unsigned Radix>
+    struct is_block_accumulator<Radix, positive_accumulator<Radix>>
+      : mpl::bool_<Radix == 10 || Radix == 16> {};
+
+    template <unsigned Radix>
+    struct is_block_accumulator<Radix, negative_accumulator<Radix>>
+      : mpl::bool_<Radix == 10 || Radix == 16> {};
+
+    template <unsigned Radix, typename Accumulator, int MaxDigits>
+    struct block_extractor
+    {
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator& it, Iterator const& last, T& n, mpl::true_)
+        {
+            typedef spirit::detail::digit_block<Radix> block;
+            std::size_t const size = spirit::detail::digit_block_size;
+
+            std::size_t count = 0;
+            while (static_cast<std::size_t>(last - it) >= size)
+            {
+                boost::uint64_t const w =
+                    spirit::detail::load_digit_block(traits::to_address(it));
+                if (!block::is_valid(w) || !Accumulator::add_block(n, block::value(w)))
+                    break;
+                it += size;
+                count += size;
+            }
+            return count;
+        }
+
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator& /*it*/, Iterator const& /*last*/, T& /*n*/, mpl::false_)
+        {
+            return 0;
+        }
+
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator& it, Iterator const& last, T& n)
+        {
+            typedef typename remove_const<
+                typename std::iterator_traits<Iterator>::value_type>::type
+            char_type;
+
+            return call(it, last, n
+              , mpl::bool_<
+                    (MaxDigits < 0)
+                  && is_block_accumulator<Radix, Accumulator>::value
+                  && traits::is_contiguous_iterator<Iterator>::value
+                  && is_same<char_type, char>::value
+                  && is_integral<T>::value
+                  && (digits_traits<T, Radix>::value > 8)
+                >()
+            );
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -316,7 +416,8 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             attribute_type;
 
             attribute_type val = Accumulate ? attr : attribute_type(0);
-            std::size_t count = 0;
+            std::size_t count = block_extractor<Radix, Accumulator, MaxDigits>
+                ::call(it, last, val);
             char_type ch;
 
             while (true)
@@ -434,8 +535,8 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
                 return true;
             }
 
-            count = 0;
             ++it;
+            count = block_extractor<Radix, Accumulator, -1>::call(it, last, val);
             while (true)
             {
                 BOOST_PP_REPEAT(
@@ -16,6 +16,7 @@
 #include <boost/spirit/home/x3/support/numeric_utils/pow10.hpp>
 #include <boost/spirit/home/x3/support/numeric_utils/sign.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
+#include <boost/spirit/home/support/detail/decimal_to_float.hpp>
 #include <boost/assert.hpp>
 
 #if BOOST_WORKAROUND(BOOST_MSVC, >= 1400)
@@ -24,6 +25,43 @@
 # pragma warning(disable: 4127)   // conditional expression is constant
 #endif
 
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    template <typename T>
+    inline bool
+    scale_exact(int /*exp*/, T& /*n*/)
+    {
+        return false;
+    }
+
+    // The digits are accumulated into n itself. As long as n stays below
+    // 2^digits every step of the accumulation was exact, so n holds the
+    // decimal significand and we can round n * 10^exp correctly.
+    template <typename T>
+    inline bool
+    scale_exact_float(int exp, T& n)
+    {
+        T const exact_limit =
+            T(boost::uint64_t(1) << std::numeric_limits<T>::digits);
+        if (!(n < exact_limit))
+            return false;
+        return spirit::detail::decimal_to_float(
+            static_cast<boost::uint64_t>(n), exp, false, n);
+    }
+
+    inline bool
+    scale_exact(int exp, double& n)
+    {
+        return detail::scale_exact_float(exp, n);
+    }
+
+    inline bool
+    scale_exact(int exp, float& n)
+    {
+        return detail::scale_exact_float(exp, n);
+    }
+}}}}
+
 namespace boost { namespace spirit { namespace x3 { namespace extension
 {
     using x3::traits::pow10;
@@ -32,6 +70,10 @@ namespace boost { namespace spirit { namespace x3 { namespace extension
     inline void
     scale(int exp, T& n)
     {
+        // try the correctly rounded conversion first (float and double)
+        if (x3::detail::scale_exact(exp, n))
+            return;
+
         if (exp >= 0)
         {
             // $$$ Why is this failing for boost.math.concepts ? $$$
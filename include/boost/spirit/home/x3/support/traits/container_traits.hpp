@@ -113,6 +113,16 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     struct container_iterator<unused_type const>
         : mpl::identity<unused_type const*> {};
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  Called by push_back and append before they add to a container. Does
+    //  nothing by default (see x3/support/utility/arena.hpp for a use).
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Container, typename Enable = void>
+    struct prepare_container
+    {
+        static void call(Container&) {}
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Container, typename T>
     bool push_back(Container& c, T&& val);
@@ -131,6 +141,7 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     template <typename Container, typename T>
     inline bool push_back(Container& c, T&& val)
     {
+        prepare_container<Container>::call(c);
         return push_back_container<Container>::call(c, std::move(val));
     }
 
@@ -196,6 +207,7 @@ namespace boost { namespace spirit { namespace x3 { namespace traits
     template <typename Container, typename Iterator>
     inline bool append(Container& c, Iterator first, Iterator last)
     {
+        prepare_container<Container>::call(c);
         return append_container<Container>::call(c, first, last);
     }
 
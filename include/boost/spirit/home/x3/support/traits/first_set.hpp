@@ -0,0 +1,65 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_FIRST_SET_OCT_16_2016_0900AM)
+#define BOOST_SPIRIT_X3_FIRST_SET_OCT_16_2016_0900AM
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The characters a component may start with (its FIRST set), as seen
+    // after pre-skipping. Components that know their FIRST set specialize
+    // this with is_known = true and a may_start that tells whether a parse
+    // starting at ch (the first character after skipping) may succeed.
+    //
+    // may_start may err on the side of true, never on the side of false:
+    // if it returns false, the component is guaranteed to fail on that
+    // input. Components whose parse does not start by consuming a
+    // character (or that do not pre-skip with the context's skipper) leave
+    // their FIRST set unknown, the default.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Component, typename Enable = void>
+    struct first_set
+    {
+        static bool const is_known = false;
+
+        template <typename Char, typename Context>
+        static bool may_start(Component const&, Char, Context const&)
+        {
+            return true;
+        }
+    };
+
+    // Components whose FIRST set is that of their subject
+    template <typename Component>
+    struct subject_first_set
+    {
+        typedef first_set<typename Component::subject_type> subject_first;
+        static bool const is_known = subject_first::is_known;
+
+        template <typename Char, typename Context>
+        static bool may_start(Component const& p, Char ch, Context const& context)
+        {
+            return subject_first::may_start(p.subject, ch, context);
+        }
+    };
+
+    // Components whose FIRST set is that of their left operand
+    template <typename Component>
+    struct left_first_set
+    {
+        typedef first_set<typename Component::left_type> left_first;
+        static bool const is_known = left_first::is_known;
+
+        template <typename Char, typename Context>
+        static bool may_start(Component const& p, Char ch, Context const& context)
+        {
+            return left_first::may_start(p.left, ch, context);
+        }
+    };
+}}}}
+
+#endif
@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+    http://spirit.sourceforge.net/
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_IS_CONTIGUOUS_ITERATOR_OCT_16_2016_0900AM)
+#define BOOST_SPIRIT_X3_IS_CONTIGUOUS_ITERATOR_OCT_16_2016_0900AM
+
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3 { namespace traits
+{
+    namespace detail
+    {
+        template <typename Iterator, typename T>
+        struct is_vector_iterator
+          : mpl::bool_<
+                is_same<Iterator, typename std::vector<T>::iterator>::value
+             || is_same<Iterator, typename std::vector<T>::const_iterator>::value
+            >
+        {};
+
+        template <typename Iterator, typename T>
+        struct is_string_iterator
+          : mpl::bool_<
+                is_same<Iterator, typename std::basic_string<T>::iterator>::value
+             || is_same<Iterator, typename std::basic_string<T>::const_iterator>::value
+            >
+        {};
+
+        template <typename Iterator, typename T>
+        struct is_contiguous_iterator_impl
+          : mpl::false_
+        {};
+
+        template <typename Iterator, typename T>
+        struct is_contiguous_char_iterator
+          : mpl::bool_<
+                is_string_iterator<Iterator, T>::value
+             || is_vector_iterator<Iterator, T>::value
+            >
+        {};
+
+        template <typename Iterator>
+        struct is_contiguous_iterator_impl<Iterator, char>
+          : is_contiguous_char_iterator<Iterator, char>
+        {};
+
+        template <typename Iterator>
+        struct is_contiguous_iterator_impl<Iterator, wchar_t>
+          : is_contiguous_char_iterator<Iterator, wchar_t>
+        {};
+
+        template <typename Iterator>
+        struct is_contiguous_iterator_impl<Iterator, char16_t>
+          : is_contiguous_char_iterator<Iterator, char16_t>
+        {};
+
+        template <typename Iterator>
+        struct is_contiguous_iterator_impl<Iterator, char32_t>
+          : is_contiguous_char_iterator<Iterator, char32_t>
+        {};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Determine if Iterator walks over a contiguous block of memory. Parsers
+    // use this to switch to bulk (memcmp-like, word-at-a-time) fast paths.
+    //
+    // Pointers and the iterators of std::basic_string and std::vector of
+    // character types (default allocators) are detected out of the box.
+    // Specialize this trait for your own contiguous iterator types.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename Enable = void>
+    struct is_contiguous_iterator
+      : detail::is_contiguous_iterator_impl<Iterator
+          , typename std::iterator_traits<Iterator>::value_type>
+    {};
+
+    template <typename T>
+    struct is_contiguous_iterator<T*>
+      : mpl::true_
+    {};
+
+    template <typename Iterator>
+    struct is_contiguous_iterator<Iterator const>
+      : is_contiguous_iterator<Iterator>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Get the address of the element an iterator refers to. Only valid for
+    // dereferenceable iterators satisfying is_contiguous_iterator.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    inline typename remove_const<
+        typename std::iterator_traits<Iterator>::value_type>::type const*
+    to_address(Iterator const& i)
+    {
+        return std::addressof(*i);
+    }
+}}}}
+
+#endif
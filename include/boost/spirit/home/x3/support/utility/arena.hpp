@@ -0,0 +1,296 @@
+/*=============================================================================
+    Copyright (c) 2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_ARENA_OCT_16_2016_1100AM)
+#define BOOST_SPIRIT_X3_ARENA_OCT_16_2016_1100AM
+
+#include <boost/spirit/home/x3/directive/with.hpp>
+#include <boost/spirit/home/x3/support/traits/container_traits.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3
+{
+    // tag used to pass an arena to the parse
+    struct arena_tag;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  A monotonic arena: allocation bumps a pointer into the current
+    //  block (getting blocks twice as large as the last when it runs out),
+    //  deallocation does nothing, and release() (or the destructor) frees
+    //  all the memory at once.
+    //
+    //  Inject one to have the attributes of a parse allocated from it:
+    //
+    //      x3::arena arena;
+    //      x3::arena_vector<x3::arena_string> words;
+    //      x3::phrase_parse(first, last
+    //        , x3::with<x3::arena_tag>(std::ref(arena))[*x3::lexeme[+x3::alpha]]
+    //        , x3::space, words);
+    //
+    //  While the parse runs, the arena is the current arena of the thread
+    //  (see arena_scope), which is where default constructed
+    //  arena_allocators, and so the arena containers the parse creates,
+    //  allocate from. Containers created before (like words) that are still
+    //  empty adopt the arena when the parse first adds to them (see
+    //  traits::is_arena_container). Anything allocated
+    //  from the arena is only valid as long as the arena is.
+    //
+    //  Only the arena containers allocate from the arena: the nodes of
+    //  recursive ASTs (x3::forward_ast, as in the x3::variant ASTs of the
+    //  calc and rexpr examples) are still allocated one by one on the heap.
+    //
+    //  x3.hpp does not include this header; include it to use an arena.
+    ///////////////////////////////////////////////////////////////////////////
+    class arena
+    {
+    public:
+
+        explicit arena(std::size_t block_size = 4096)
+          : blocks(0), ptr(0), end(0)
+          , next_size(block_size < min_block_size ? min_block_size : block_size)
+          , allocated(0)
+        {
+        }
+
+        ~arena()
+        {
+            release();
+        }
+
+        arena(arena const&) = delete;
+        arena& operator=(arena const&) = delete;
+
+        void* allocate(std::size_t size
+          , std::size_t align = alignof(std::max_align_t))
+        {
+            void* p = ptr;
+            std::size_t space = end - ptr;
+            if (!std::align(align, size, p, space))
+            {
+                grow(size + align);
+                p = ptr;
+                space = end - ptr;
+                std::align(align, size, p, space);
+            }
+            ptr = static_cast<char*>(p) + size;
+            allocated += size;
+            return p;
+        }
+
+        // frees all the memory allocated from the arena
+        void release()
+        {
+            while (blocks)
+            {
+                block* next = blocks->next;
+                ::operator delete(blocks);
+                blocks = next;
+            }
+            ptr = end = 0;
+            allocated = 0;
+        }
+
+        // the number of bytes handed out since the last release()
+        std::size_t bytes_allocated() const
+        {
+            return allocated;
+        }
+
+        // the arena of the innermost arena_scope of this thread, if any
+        static arena* current()
+        {
+            return current_ref();
+        }
+
+    private:
+
+        friend class arena_scope;
+
+        static std::size_t const min_block_size = 256;
+
+        struct block
+        {
+            block* next;
+        };
+
+        static arena*& current_ref()
+        {
+            static thread_local arena* p = 0;
+            return p;
+        }
+
+        void grow(std::size_t size)
+        {
+            std::size_t const header = sizeof(std::max_align_t);
+            while (next_size < size)
+                next_size *= 2;
+
+            block* b = static_cast<block*>(::operator new(header + next_size));
+            b->next = blocks;
+            blocks = b;
+            ptr = reinterpret_cast<char*>(b) + header;
+            end = ptr + next_size;
+            next_size *= 2;
+        }
+
+        block* blocks;
+        char* ptr;
+        char* end;
+        std::size_t next_size;
+        std::size_t allocated;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Makes an arena the current arena of the thread for its lifetime
+    //  (x3::with<arena_tag> does this for the duration of its subject's
+    //  parse).
+    ///////////////////////////////////////////////////////////////////////////
+    class arena_scope
+    {
+    public:
+
+        explicit arena_scope(arena& a)
+          : previous(arena::current_ref())
+        {
+            arena::current_ref() = &a;
+        }
+
+        ~arena_scope()
+        {
+            arena::current_ref() = previous;
+        }
+
+        arena_scope(arena_scope const&) = delete;
+        arena_scope& operator=(arena_scope const&) = delete;
+
+    private:
+
+        arena* previous;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  An allocator allocating from an arena, or from the heap if it has
+    //  none. Default constructed, it takes the current arena. Containers
+    //  pass it on when copied, moved or swapped.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class arena_allocator
+    {
+    public:
+
+        typedef T value_type;
+        typedef std::true_type propagate_on_container_copy_assignment;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        arena_allocator()
+          : a(arena::current()) {}
+
+        explicit arena_allocator(arena& a)
+          : a(&a) {}
+
+        template <typename U>
+        arena_allocator(arena_allocator<U> const& other)
+          : a(other.get_arena()) {}
+
+        T* allocate(std::size_t n)
+        {
+            if (a)
+                return static_cast<T*>(a->allocate(n * sizeof(T), alignof(T)));
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t)
+        {
+            if (!a)
+                ::operator delete(p);
+        }
+
+        arena* get_arena() const
+        {
+            return a;
+        }
+
+    private:
+
+        arena* a;
+    };
+
+    template <typename T, typename U>
+    inline bool operator==(arena_allocator<T> const& a, arena_allocator<U> const& b)
+    {
+        return a.get_arena() == b.get_arena();
+    }
+
+    template <typename T, typename U>
+    inline bool operator!=(arena_allocator<T> const& a, arena_allocator<U> const& b)
+    {
+        return a.get_arena() != b.get_arena();
+    }
+
+    template <typename T>
+    using arena_vector = std::vector<T, arena_allocator<T>>;
+
+    template <typename Char>
+    using basic_arena_string =
+        std::basic_string<Char, std::char_traits<Char>, arena_allocator<Char>>;
+
+    typedef basic_arena_string<char> arena_string;
+
+    namespace detail
+    {
+        // with<arena_tag> makes the arena the current arena of the thread
+        template <>
+        struct with_scope<arena_tag> : arena_scope
+        {
+            explicit with_scope(arena& a)
+              : arena_scope(a) {}
+        };
+    }
+
+    namespace traits
+    {
+        ///////////////////////////////////////////////////////////////////////
+        //  Containers allocating with an arena_allocator (arena_vector,
+        //  arena_string, ...). Such a container that is still empty and has
+        //  no arena when the parse first adds to it adopts the current
+        //  arena, so that attributes created before the parse (and outside
+        //  of with<arena_tag>) end up in the arena as well.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T, typename Enable = void>
+        struct is_arena_container : mpl::false_ {};
+
+        template <typename T>
+        struct is_arena_container<T, typename enable_if_c<
+            is_same<typename T::allocator_type
+              , arena_allocator<typename T::value_type>>::value>::type>
+          : mpl::true_ {};
+
+        template <typename Container>
+        struct prepare_container<Container
+          , typename enable_if<is_arena_container<Container>>::type>
+        {
+            static void call(Container& c)
+            {
+                if (c.empty() && !c.get_allocator().get_arena())
+                {
+                    if (arena* a = arena::current())
+                        c = Container(typename Container::allocator_type(*a));
+                }
+            }
+        };
+    }
+}}}
+
+#endif
@@ -13,6 +13,7 @@
 
 #include <boost/locale/encoding_utf.hpp>
 #include <boost/spirit/home/x3/support/ast/position_tagged.hpp>
+#include <mutex>
 #include <ostream>
 
 // Clang-style error handling utilities
@@ -237,6 +238,53 @@ namespace boost { namespace spirit { namespace x3
         err_out << " <<-- Here" << std::endl;
     }
 
+    // An error_handler that can be shared by records parsed concurrently
+    // (see parallel_parse): reporting errors and tagging ASTs are serialized.
+    // Use error_handler when parsing on a single thread.
+    template <typename Iterator>
+    class concurrent_error_handler : public error_handler<Iterator>
+    {
+    public:
+
+        typedef error_handler<Iterator> base_type;
+
+        using base_type::base_type;
+
+        void operator()(Iterator err_pos, std::string const& error_message) const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            base_type::operator()(err_pos, error_message);
+        }
+
+        void operator()(Iterator err_first, Iterator err_last, std::string const& error_message) const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            base_type::operator()(err_first, err_last, error_message);
+        }
+
+        void operator()(position_tagged pos, std::string const& message) const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            base_type::operator()(pos, message);
+        }
+
+        template <typename AST>
+        void tag(AST& ast, Iterator first, Iterator last)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            base_type::tag(ast, first, last);
+        }
+
+        boost::iterator_range<Iterator> position_of(position_tagged pos) const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return base_type::position_of(pos);
+        }
+
+    private:
+
+        mutable std::mutex mutex;
+    };
 }}}
 
 #endif
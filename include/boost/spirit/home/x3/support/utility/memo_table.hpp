@@ -0,0 +1,155 @@
+/*=============================================================================
+    Copyright (c) 2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_MEMO_TABLE_OCT_16_2016_1000AM)
+#define BOOST_SPIRIT_X3_MEMO_TABLE_OCT_16_2016_1000AM
+
+#include <boost/cstdint.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3
+{
+    // tag used to get our memo table from the context
+    struct memo_tag;
+
+    struct memo_stats
+    {
+        std::size_t lookups;    // memoized parses attempted
+        std::size_t hits;       // ... answered by the table
+        std::size_t stores;     // results recorded
+        std::size_t evictions;  // ... replacing another result
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The memo table of a parse, for the memoize directive (packrat
+    //  parsing). Pass it in the context:
+    //
+    //      x3::memo_table<iterator_type> memo(first);
+    //      x3::parse(first, last
+    //        , x3::with<x3::memo_tag>(std::ref(memo))[grammar]);
+    //
+    //  The table records, for a memoized parser at an input position,
+    //  whether it matched, where it ended and its attribute. It has a
+    //  fixed number of entries (rounded up to a power of two); a result
+    //  replaces whichever result its slot held.
+    //
+    //  Use a table for one parse (of one input) only, or clear() it.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    class memo_table
+    {
+    public:
+
+        typedef Iterator iterator_type;
+
+        static_assert(std::is_base_of<std::random_access_iterator_tag
+              , typename std::iterator_traits<Iterator>::iterator_category>::value
+          , "memo_table needs random access iterators");
+
+        struct entry
+        {
+            void const* parser;     // null if unused
+            void const* kind;       // context and attribute type
+            std::size_t position;
+            std::size_t end;
+            bool matched;
+            std::shared_ptr<void> value;
+        };
+
+        explicit memo_table(Iterator begin, std::size_t capacity = 4096)
+          : begin(begin)
+          , entries(round_capacity(capacity))
+          , stats_()
+        {
+        }
+
+        // the result of parser at first, if recorded
+        entry const* find(void const* parser, void const* kind, Iterator first)
+        {
+            ++stats_.lookups;
+            std::size_t const position = first - begin;
+            entry const& e = slot(parser, kind, position);
+            if (e.parser != parser || e.kind != kind || e.position != position)
+                return 0;
+            ++stats_.hits;
+            return &e;
+        }
+
+        // the entry to record the result of parser at first in
+        entry& store(void const* parser, void const* kind, Iterator first)
+        {
+            ++stats_.stores;
+            std::size_t const position = first - begin;
+            entry& e = slot(parser, kind, position);
+            if (e.parser != 0)
+                ++stats_.evictions;
+            e.parser = parser;
+            e.kind = kind;
+            e.position = position;
+            e.value.reset();
+            return e;
+        }
+
+        Iterator position(std::size_t offset) const
+        {
+            return begin + offset;
+        }
+
+        std::size_t offset(Iterator i) const
+        {
+            return i - begin;
+        }
+
+        void clear()
+        {
+            for (entry& e : entries)
+            {
+                e.parser = 0;
+                e.value.reset();
+            }
+            stats_ = memo_stats();
+        }
+
+        std::size_t capacity() const
+        {
+            return entries.size();
+        }
+
+        memo_stats const& stats() const
+        {
+            return stats_;
+        }
+
+    private:
+
+        static std::size_t round_capacity(std::size_t capacity)
+        {
+            std::size_t n = 1;
+            while (n < capacity)
+                n <<= 1;
+            return n;
+        }
+
+        entry& slot(void const* parser, void const* kind, std::size_t position)
+        {
+            boost::uint64_t h = reinterpret_cast<std::uintptr_t>(parser)
+                ^ (boost::uint64_t(reinterpret_cast<std::uintptr_t>(kind)) << 16);
+            h = (h ^ position) * UINT64_C(0x9e3779b97f4a7c15);
+            return entries[std::size_t(h ^ (h >> 32)) & (entries.size() - 1)];
+        }
+
+        Iterator begin;
+        std::vector<entry> entries;
+        memo_stats stats_;
+    };
+}}}
+
+#endif
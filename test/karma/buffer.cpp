@@ -11,10 +11,31 @@
 #include <boost/spirit/include/karma_operator.hpp>
 #include <boost/spirit/include/karma_directive.hpp>
 #include <boost/spirit/include/karma_char.hpp>
+#include <boost/spirit/include/karma_string.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 #include <iostream>
+#include <string>
+#include <vector>
 #include "test.hpp"
 
+///////////////////////////////////////////////////////////////////////////////
+// the buffers store the output as the character type of the sink
+using boost::spirit::karma::detail::buffer_char;
+using boost::spirit::karma::detail::default_buffer_char_type;
+
+BOOST_STATIC_ASSERT((boost::is_same<char, buffer_char<
+    std::back_insert_iterator<std::string> >::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<wchar_t, buffer_char<
+    std::back_insert_iterator<std::wstring> >::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<char, buffer_char<char*>::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<char, buffer_char<
+    boost::spirit::karma::ostream_iterator<char, char> >::type>::value));
+BOOST_STATIC_ASSERT((boost::is_same<default_buffer_char_type, buffer_char<
+    std::vector<char>::iterator>::type>::value));
+
 int
 main()
 {
@@ -49,5 +70,61 @@ main()
             buffer['[' << +double_ << ']'], v, space));
     }
 
+    {   // the buffers are reused once released
+        boost::spirit::karma::detail::buffer_pool<char> pool;
+
+        std::vector<char>& outer = pool.acquire();
+        std::vector<char>& inner = pool.acquire();
+        BOOST_TEST(&outer != &inner);
+
+        inner.assign(100, 'x');
+        pool.release();
+        BOOST_TEST(inner.empty() && inner.capacity() >= 100);
+        BOOST_TEST(&pool.acquire() == &inner);
+
+        // deeply nested buffers stay in place while more are acquired
+        std::vector<std::vector<char>*> nested;
+        for (int i = 0; i != 8; ++i)
+        {
+            nested.push_back(&pool.acquire());
+            nested.back()->push_back(char('0' + i));
+        }
+        for (int i = 0; i != 8; ++i)
+            BOOST_TEST(nested[i]->size() == 1 && (*nested[i])[0] == '0' + i);
+        for (int i = 0; i != 8; ++i)
+            pool.release();
+
+        pool.release();
+        pool.release();
+    }
+
+    {   // buffering nested inside alternatives and alignment directives
+        using boost::spirit::karma::int_;
+        using boost::spirit::karma::lit;
+        using boost::spirit::karma::left_align;
+        using boost::spirit::karma::right_align;
+        using boost::spirit::karma::center;
+
+        std::vector<int> v;
+        v.push_back(1);
+        v.push_back(22);
+        v.push_back(333);
+        BOOST_TEST(test("1   |22  |333 |", *(left_align(4)[int_] << '|'), v));
+        BOOST_TEST(test("|   1|  22| 333", *('|' << right_align(4)[int_]), v));
+        BOOST_TEST(test("|  1 || 22 || 333|", 
+            *('|' << center(4)[int_(22) | int_(1) | int_] << '|'), v));
+        BOOST_TEST(test("   22  ", center(7)[int_(1) | int_], 22));
+        BOOST_TEST(test("[  22]", 
+            '[' << right_align(4)[left_align(2)[int_(1) | int_]] << ']', 22));
+
+        BOOST_TEST(test(L"  ab", right_align(4)["ab"]));
+        BOOST_TEST(test(L"\x3b1" L"b", buffer[lit(L"\x3b1") << "b"]));
+
+        char buffer[8] = { 0 };
+        char* out = buffer;
+        BOOST_TEST(boost::spirit::karma::generate(out, right_align(4)[int_], 12));
+        BOOST_TEST(std::string(buffer, out) == "  12");
+    }
+
     return boost::report_errors();
 }
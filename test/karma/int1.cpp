@@ -168,6 +168,39 @@ main()
         BOOST_TEST(test_delimited("ff ", lower[lower[hex(0xff)]], char_(' ')));
     }
 
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // all digit counts and the limits of the built-in types
+        using boost::lexical_cast;
+        using namespace boost::spirit::ascii;
+
+        boost::ulong_long_type n = 1;
+        for (int i = 0; i != 20; ++i, n *= 10)
+        {
+            BOOST_TEST(test(lexical_cast<std::string>(n - 1).c_str()
+              , ulong_long, n - 1));
+            BOOST_TEST(test(lexical_cast<std::string>(n).c_str()
+              , ulong_long, n));
+        }
+
+        BOOST_TEST(test("18446744073709551615", ulong_long
+          , (std::numeric_limits<boost::ulong_long_type>::max)()));
+        BOOST_TEST(test("-9223372036854775808", long_long
+          , (std::numeric_limits<boost::long_long_type>::min)()));
+        BOOST_TEST(test(lexical_cast<std::string>(
+              (std::numeric_limits<int>::min)()).c_str()
+          , int_, (std::numeric_limits<int>::min)()));
+        BOOST_TEST(test("-32768", short_, (std::numeric_limits<short>::min)()));
+        BOOST_TEST(test("65535", ushort_, 65535));
+
+        BOOST_TEST(test("0", hex, 0u));
+        BOOST_TEST(test("ffffffffffffffff", hex
+          , (std::numeric_limits<boost::ulong_long_type>::max)()));
+        BOOST_TEST(test("FEDCBA9876543210", upper[hex]
+          , boost::ulong_long_type(0xfedcba9876543210ULL)));
+        BOOST_TEST(test("1000", hex, 0x1000u));
+    }
+
     return boost::report_errors();
 }
 
@@ -0,0 +1,219 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "real.hpp"
+
+#include <boost/cstdint.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+//  shortest round trip policies forcing the scientific notation
+template <typename T>
+struct shortest_scientific_policy
+  : boost::spirit::karma::shortest_real_policies<T>
+{
+    typedef boost::spirit::karma::shortest_real_policies<T> base_type;
+    static int floatfield(T) { return base_type::fmtflags::scientific; }
+};
+
+//  shortest round trip policies forcing the fixed notation
+template <typename T>
+struct shortest_fixed_policy
+  : boost::spirit::karma::shortest_real_policies<T>
+{
+    typedef boost::spirit::karma::shortest_real_policies<T> base_type;
+    static int floatfield(T) { return base_type::fmtflags::fixed; }
+};
+
+//  at most 2 fractional digits, correctly rounded
+template <typename T>
+struct rounding_policy : shortest_fixed_policy<T>
+{
+    static unsigned int precision(T) { return 2; }
+};
+
+//  exactly 4 fractional digits, correctly rounded
+template <typename T>
+struct rounding_trailing_zeros_policy : rounding_policy<T>
+{
+    static bool trailing_zeros(T) { return true; }
+    static unsigned int precision(T) { return 4; }
+};
+
+//  no fractional digits at all
+template <typename T>
+struct rounding_no_fraction_policy : shortest_fixed_policy<T>
+{
+    static unsigned int precision(T) { return 0; }
+};
+
+//  always a sign
+template <typename T>
+struct shortest_signed_policy
+  : boost::spirit::karma::shortest_real_policies<T>
+{
+    static bool force_sign(T) { return true; }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+//  generate n using the shortest representation and read it back
+bool round_trip(double n)
+{
+    using boost::spirit::karma::real_generator;
+    using boost::spirit::karma::shortest_real_policies;
+
+    typedef real_generator<double, shortest_real_policies<double> >
+        shortest_type;
+
+    std::string generated;
+    std::back_insert_iterator<std::string> sink(generated);
+    if (!boost::spirit::karma::generate(sink, shortest_type(), n))
+        return false;
+
+    return std::strtod(generated.c_str(), 0) == n;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int
+main()
+{
+    using boost::spirit::karma::real_generator;
+    using boost::spirit::karma::shortest_real_policies;
+
+    {   // the shortest digits reading back as the same value
+        typedef real_generator<double, shortest_real_policies<double> >
+            shortest_type;
+        shortest_type const shortest = shortest_type();
+
+        BOOST_TEST(test("0.0", shortest, 0.0));
+        BOOST_TEST(test("0.0", shortest, -0.0));
+        BOOST_TEST(test("1.0", shortest, 1.0));
+        BOOST_TEST(test("-1.5", shortest, -1.5));
+        BOOST_TEST(test("0.1", shortest, 0.1));
+        BOOST_TEST(test("0.30000000000000004", shortest, 0.1 + 0.2));
+        BOOST_TEST(test("0.3333333333333333", shortest, 1.0 / 3));
+        BOOST_TEST(test("12345.12345", shortest, 12345.12345));
+        BOOST_TEST(test("99999.999", shortest, 99999.999));
+        BOOST_TEST(test("0.001", shortest, 0.001));
+        BOOST_TEST(test("1.0e05", shortest, 100000.0));
+        BOOST_TEST(test("1.23456e05", shortest, 123456.0));
+        BOOST_TEST(test("1.0e23", shortest, 1e23));
+        BOOST_TEST(test("1.2345e-04", shortest, 0.00012345));
+        BOOST_TEST(test("1.7976931348623157e308", shortest,
+            (std::numeric_limits<double>::max)()));
+        BOOST_TEST(test("2.2250738585072014e-308", shortest,
+            (std::numeric_limits<double>::min)()));
+        BOOST_TEST(test("5.0e-324", shortest,
+            std::numeric_limits<double>::denorm_min()));
+        BOOST_TEST(test("4.35e-320", shortest, 4.35e-320));
+
+        BOOST_TEST(test("nan", shortest, std::numeric_limits<double>::quiet_NaN()));
+        BOOST_TEST(test("-inf", shortest, -std::numeric_limits<double>::infinity()));
+    }
+
+    {   // the notation may be forced as usual
+        typedef real_generator<double, shortest_scientific_policy<double> >
+            scientific_type;
+        scientific_type const scientific = scientific_type();
+
+        BOOST_TEST(test("0.0e00", scientific, 0.0));
+        BOOST_TEST(test("1.0e00", scientific, 1.0));
+        BOOST_TEST(test("1.234512345e04", scientific, 12345.12345));
+        BOOST_TEST(test("-1.0e-01", scientific, -0.1));
+
+        typedef real_generator<double, shortest_fixed_policy<double> >
+            fixed_type;
+        fixed_type const fixed = fixed_type();
+
+        BOOST_TEST(test("100000000000000000000000.0", fixed, 1e23));
+        BOOST_TEST(test("123456.0", fixed, 123456.0));
+        BOOST_TEST(test("0.00012345", fixed, 0.00012345));
+        BOOST_TEST(test("-0.000001", fixed, -1e-6));
+    }
+
+    {   // fewer digits are rounded correctly, using the exact binary value
+        typedef real_generator<double, rounding_policy<double> > rounding_type;
+        rounding_type const rounding = rounding_type();
+
+        BOOST_TEST(test("2.67", rounding, 2.675));     // 2.67499999...
+        BOOST_TEST(test("1.0", rounding, 1.005));      // 1.00499999...
+        BOOST_TEST(test("0.12", rounding, 0.125));     // ties to even
+        BOOST_TEST(test("0.38", rounding, 0.375));
+        BOOST_TEST(test("1.0", rounding, 0.999));
+        BOOST_TEST(test("100.0", rounding, 99.999));
+        BOOST_TEST(test("0.01", rounding, 0.005000001));
+        BOOST_TEST(test("0.0", rounding, 0.004999));
+        BOOST_TEST(test("0.0", rounding, -0.001));      // no sign for zero
+        BOOST_TEST(test("-3.14", rounding, -3.14159));
+
+        typedef real_generator<double, rounding_trailing_zeros_policy<double> >
+            trailing_zeros_type;
+        trailing_zeros_type const trailing_zeros = trailing_zeros_type();
+
+        BOOST_TEST(test("0.1000", trailing_zeros, 0.1));
+        BOOST_TEST(test("3.1416", trailing_zeros, 3.14159));
+        BOOST_TEST(test("1000000.0000", trailing_zeros, 999999.99999));
+
+        typedef real_generator<double, rounding_no_fraction_policy<double> >
+            no_fraction_type;
+        no_fraction_type const no_fraction = no_fraction_type();
+
+        BOOST_TEST(test("2.", no_fraction, 2.5));
+        BOOST_TEST(test("4.", no_fraction, 3.5));
+        BOOST_TEST(test("1.", no_fraction, 0.5000001));
+        BOOST_TEST(test("0.", no_fraction, 0.5));
+    }
+
+    {   // signs
+        typedef real_generator<double, shortest_signed_policy<double> >
+            signed_type;
+        signed_type const signed_ = signed_type();
+
+        BOOST_TEST(test("0.0", signed_, 0.0));      // no sign for zero
+        BOOST_TEST(test("+0.1", signed_, 0.1));
+        BOOST_TEST(test("-0.1", signed_, -0.1));
+        BOOST_TEST(test("+1.0e10", signed_, 1e10));
+    }
+
+    {   // float has its own shortest digits
+        typedef real_generator<float, shortest_real_policies<float> >
+            shortest_type;
+        shortest_type const shortest = shortest_type();
+
+        BOOST_TEST(test("0.1", shortest, 0.1f));
+        BOOST_TEST(test("16777216.0",
+            real_generator<float, shortest_fixed_policy<float> >(), 16777216.f));
+        BOOST_TEST(test("3.4028235e38", shortest,
+            (std::numeric_limits<float>::max)()));
+        BOOST_TEST(test("1.0e-45", shortest,
+            std::numeric_limits<float>::denorm_min()));
+    }
+
+    {   // other types use the existing conversion
+        typedef real_generator<long double, shortest_real_policies<long double> >
+            shortest_type;
+
+        BOOST_TEST(test("1.5", shortest_type(), 1.5L));
+    }
+
+    {   // round trip of values across the whole range
+        boost::uint64_t bits = 0x123456789abcdefULL;
+        for (int i = 0; i != 20000; ++i)
+        {
+            // a simple linear congruential generator
+            bits = bits * 6364136223846793005ULL + 1442695040888963407ULL;
+
+            double n = 0;
+            std::memcpy(&n, &bits, sizeof(n));
+            if (boost::math::isfinite(n))
+                BOOST_TEST(round_trip(n));
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,168 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#include <boost/spirit/include/karma_numeric.hpp>
+#include <boost/spirit/include/karma_generate.hpp>
+#include <boost/spirit/include/karma_operator.hpp>
+#include <boost/spirit/include/karma_directive.hpp>
+#include <boost/spirit/include/karma_char.hpp>
+#include <boost/spirit/include/karma_string.hpp>
+#include <boost/spirit/include/karma_stream.hpp>
+#include <boost/spirit/home/karma/detail/output_iterator.hpp>
+
+#include <iomanip>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "test.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+//  a sink counting the calls to its own bulk write customization
+struct counted_sink
+{
+    typedef std::output_iterator_tag iterator_category;
+    typedef void value_type;
+    typedef void difference_type;
+    typedef void pointer;
+    typedef void reference;
+
+    explicit counted_sink(std::string& str_) : str(&str_), writes(0) {}
+
+    counted_sink& operator*() { return *this; }
+    counted_sink& operator++() { return *this; }
+    counted_sink& operator++(int) { return *this; }
+    counted_sink& operator=(char ch) { str->push_back(ch); return *this; }
+
+    std::string* str;
+    int writes;
+};
+
+namespace boost { namespace spirit { namespace traits
+{
+    template <>
+    struct sink_write<counted_sink>
+    {
+        static void call(counted_sink& sink, char const* first, std::size_t n)
+        {
+            sink.str->append(first, n);
+            ++sink.writes;
+        }
+    };
+}}}
+
+///////////////////////////////////////////////////////////////////////////////
+int
+main()
+{
+    using namespace boost::spirit;
+    using boost::spirit::karma::int_;
+    using boost::spirit::karma::lit;
+    using boost::spirit::karma::string;
+    using boost::spirit::karma::buffer;
+    using boost::spirit::karma::right_align;
+    using boost::spirit::karma::center;
+    using boost::spirit::karma::upper;
+    using boost::spirit::karma::generate;
+    using boost::spirit::karma::generate_delimited;
+    using boost::spirit::ascii::space;
+
+    {   // std::string and std::vector are appended to
+        std::string str("x");
+        std::back_insert_iterator<std::string> out(str);
+        BOOST_TEST(generate(out, lit("abc") << int_, 12345));
+        BOOST_TEST(generate(out, string, std::string("defgh")));
+        BOOST_TEST(str == "xabc12345defgh");
+
+        std::vector<char> v;
+        std::back_insert_iterator<std::vector<char> > vout(v);
+        BOOST_TEST(generate(vout, lit("abc") << int_, -42));
+        BOOST_TEST(std::string(v.begin(), v.end()) == "abc-42");
+
+        std::wstring wstr;
+        std::back_insert_iterator<std::wstring> wout(wstr);
+        BOOST_TEST(generate(wout, lit(L"abc") << int_, 123));
+        BOOST_TEST(wstr == L"abc123");
+
+        // sinks without a customization are written character by character
+        std::list<char> l;
+        std::back_insert_iterator<std::list<char> > lout(l);
+        BOOST_TEST(generate(lout, lit("abc") << int_, 123));
+        BOOST_TEST(std::string(l.begin(), l.end()) == "abc123");
+    }
+
+    {   // plain pointers are advanced past the written characters
+        char buffer[32] = { 0 };
+        char* out = buffer;
+        BOOST_TEST(generate(out, lit("abc") << int_ << lit("def"), 4711));
+        BOOST_TEST(std::string(buffer, out) == "abc4711def");
+    }
+
+    {   // streams are written through their stream buffer
+        std::ostringstream os;
+        karma::ostream_iterator<char> out(os);
+        BOOST_TEST(generate(out, lit("abc") << int_, 123));
+        BOOST_TEST(os.str() == "abc123");
+
+        // a field width set on the stream applies to every character
+        std::ostringstream wide;
+        wide << std::setw(2);
+        karma::ostream_iterator<char> wide_out(wide);
+        BOOST_TEST(generate(wide_out, lit("ab")));
+        BOOST_TEST(wide.str() == " ab");
+
+        // the delimiter of the iterator separates the characters
+        std::ostringstream delimited;
+        karma::ostream_iterator<char> delimited_out(delimited, ",");
+        BOOST_TEST(generate(delimited_out, lit("ab") << int_, 12));
+        BOOST_TEST(delimited.str() == "a,b,1,2,");
+
+        // failing streams fail the generator
+        std::ostringstream bad;
+        bad.setstate(std::ios_base::badbit);
+        karma::ostream_iterator<char> bad_out(bad);
+        BOOST_TEST(!generate(bad_out, lit("abc")));
+    }
+
+    {   // the position is tracked and the width is counted as before
+        std::string str;
+        std::back_insert_iterator<std::string> out(str);
+        BOOST_TEST(generate(out, right_align(8)[lit("ab") << int_], 123));
+        BOOST_TEST(str == "   ab123");
+
+        str.clear();
+        BOOST_TEST(generate(out, center(9)[lit("abc") << int_], 1));
+        BOOST_TEST(str == "   abc1  ");
+
+        str.clear();
+        BOOST_TEST(generate(out, buffer[lit("abc") << int_ << "\ndef"], 12));
+        BOOST_TEST(str == "abc12\ndef");
+
+        str.clear();
+        BOOST_TEST(generate_delimited(out, lit("abc") << int_, space, 12));
+        BOOST_TEST(str == "abc 12 ");
+    }
+
+    {   // case transformations still apply to each character
+        std::string str;
+        std::back_insert_iterator<std::string> out(str);
+        BOOST_TEST(generate(out, upper[lit("abc")]));
+        BOOST_TEST(generate(out, upper[string], std::string("def")));
+        BOOST_TEST(str == "ABCDEF");
+    }
+
+    {   // the customization point is used for the runs of characters
+        std::string str;
+        counted_sink out(str);
+        BOOST_TEST(generate(out, lit("abc") << int_ << '!', 1234567));
+        BOOST_TEST(str == "abc1234567!");
+        BOOST_TEST(out.writes == 2);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,186 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/config/warning_disable.hpp>
+
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/qi.hpp>
+
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace qi = boost::spirit::qi;
+
+typedef std::string::const_iterator base_iterator;
+typedef lex::lexertl::token<base_iterator, boost::mpl::vector<> > token_type;
+
+///////////////////////////////////////////////////////////////////////////////
+enum tokenids
+{
+    ID_WORD = 1000, ID_NUMBER, ID_SPACE, ID_BEGIN, ID_END, ID_COMMENT
+};
+
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    // the white space is skipped by the parser, or returned as tokens
+    tokens(bool skip_space = false)
+      : word("[a-z]+", ID_WORD), number("[0-9]+", ID_NUMBER)
+    {
+        this->self = word | number;
+        if (skip_space)
+            this->self("WS") = lex::token_def<>("[ \\n]+");
+        else
+            this->self.add("[ \\n]+", ID_SPACE);
+        this->self("INITIAL", "COMMENT").add("\\/\\*", ID_BEGIN);
+        this->self("COMMENT", "INITIAL").add("\\*\\/", ID_END);
+        this->self("COMMENT").add("[^*]+|\\*", ID_COMMENT);
+    }
+
+    lex::token_def<> word, number;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// the token ids and lexer states the token iterator returns for the input
+template <typename Lexer>
+std::vector<std::size_t> tokenize(Lexer const& lexer, std::string const& input)
+{
+    std::vector<std::size_t> result;
+    base_iterator first = input.begin();
+    typename Lexer::iterator_type it = lexer.begin(first, input.end());
+    typename Lexer::iterator_type end = lexer.end();
+    for (/**/; it != end && token_is_valid(*it); ++it)
+    {
+        result.push_back(it->id());
+        result.push_back(it->state());
+    }
+    result.push_back(it != end);
+    return result;
+}
+
+// the same, using the batch tokenizer with the given batch size
+template <typename Lexer>
+std::vector<std::size_t> tokenize(Lexer const& lexer, std::string const& input
+  , std::size_t count)
+{
+    std::vector<std::size_t> result;
+    std::vector<token_type> tokens(count);
+    base_iterator first = input.begin();
+    typename Lexer::batch_tokenizer_type tokenizer =
+        lexer.batch(first, input.end());
+    for (;;)
+    {
+        std::size_t n = tokenizer.next(&tokens[0], count);
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            if (!token_is_valid(tokens[i]))
+            {
+                BOOST_TEST(i == n - 1);
+                result.push_back(true);
+                return result;
+            }
+            result.push_back(tokens[i].id());
+            result.push_back(tokens[i].state());
+        }
+        if (n < count)
+            break;
+    }
+    result.push_back(false);
+    BOOST_TEST(first == input.end());
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Iterator, typename Lexer>
+struct grammar : qi::grammar<Iterator, qi::in_state_skipper<Lexer> >
+{
+    template <typename TokenDef>
+    grammar(TokenDef const& tok)
+      : grammar::base_type(start)
+    {
+        // the first alternative needs a look ahead of 5 tokens
+        start = *(  (tok.word >> tok.word >> tok.word >> tok.word >> tok.word)
+                 |  (tok.word >> tok.number)
+                 |  tok.word
+                 );
+    }
+
+    qi::rule<Iterator, qi::in_state_skipper<Lexer> > start;
+};
+
+template <typename Lexer>
+bool parse(std::string const& input)
+{
+    tokens<Lexer> lexer(true);
+    grammar<typename Lexer::iterator_type
+      , typename tokens<Lexer>::lexer_def> g(lexer);
+
+    base_iterator first = input.begin();
+    typename Lexer::iterator_type it = lexer.begin(first, input.end());
+    return qi::phrase_parse(it, lexer.end(), g, qi::in_state("WS")[lexer.self])
+        && it == lexer.end();
+}
+
+int main()
+{
+    typedef lex::lexertl::lexer<token_type> lexer_type;
+
+    std::string const input =
+        "abc 123\n/* x * y */xyz 45 6\n\nwxgxkzmlod 7/* x */ a b c d";
+
+    {   // the same tokens as from the token iterator
+        tokens<lexer_type> lexer;
+        std::vector<std::size_t> const expected = tokenize(lexer, input);
+        BOOST_TEST(expected.size() > 20 && expected.back() == false);
+        BOOST_TEST(tokenize(lexer, input, 1) == expected);
+        BOOST_TEST(tokenize(lexer, input, 3) == expected);
+        BOOST_TEST(tokenize(lexer, input, 100) == expected);
+
+        // the last token is invalid if the input doesn't match
+        std::string const invalid = "abc 123 ?abc";
+        std::vector<std::size_t> const expected_invalid =
+            tokenize(lexer, invalid);
+        BOOST_TEST(expected_invalid.back() == true);
+        BOOST_TEST(tokenize(lexer, invalid, 2) == expected_invalid);
+        BOOST_TEST(tokenize(lexer, invalid, 100) == expected_invalid);
+
+        // an empty input gives no tokens
+        std::string const empty;
+        BOOST_TEST(tokenize(lexer, empty, 2).size() == 1);
+    }
+
+    {   // a bounded buffer is enough as long as there is no backtracking
+        // over more tokens than it holds
+        typedef lex::lexertl::lexer<token_type, base_iterator
+          , lex::lexertl::functor<token_type, lex::lexertl::detail::data
+              , base_iterator, boost::mpl::false_, boost::mpl::true_>
+          , boost::spirit::iterator_policies::split_ring_buffer<5>
+        > ring_lexer_type;
+        typedef lex::lexertl::lexer<token_type, base_iterator
+          , lex::lexertl::functor<token_type, lex::lexertl::detail::data
+              , base_iterator, boost::mpl::false_, boost::mpl::true_>
+          , boost::spirit::iterator_policies::split_ring_buffer<4>
+        > small_ring_lexer_type;
+
+        std::string const text = "a b c d e f 1 g h 2 i j k l m n";
+        BOOST_TEST(parse<lexer_type>(text));
+        BOOST_TEST(parse<ring_lexer_type>(text));
+        BOOST_TEST(tokenize(tokens<ring_lexer_type>(), input)
+            == tokenize(tokens<lexer_type>(), input));
+
+        bool thrown = false;
+        try {
+            parse<small_ring_lexer_type>(text);
+        }
+        catch (boost::spirit::iterator_policies::illegal_backtracking const&) {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,163 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/config/warning_disable.hpp>
+
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_generate_static_lexertl.hpp>
+#include <boost/cstdint.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+
+typedef std::string::const_iterator base_iterator;
+typedef lex::lexertl::token<base_iterator, boost::mpl::vector<> > token_type;
+typedef lex::lexertl::lexer<token_type> lexer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+enum tokenids
+{
+    ID_WORD = 1000, ID_NUMBER, ID_SPACE, ID_BEGIN, ID_END, ID_COMMENT
+};
+
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens(bool more = false)
+    {
+        define(more);
+    }
+
+    tokens(lex::lexertl::binary_state_machine const& tables, bool more = false)
+      : lex::lexer<Lexer>(tables)
+    {
+        define(more);
+    }
+
+    void define(bool more)
+    {
+        this->self.add
+            ("^[a-z]+", ID_WORD)
+            ("[0-9]+$", ID_NUMBER)
+            ("[ \\n]+", ID_SPACE)
+            ("\\/\\*", ID_BEGIN)
+        ;
+        this->self("COMMENT").add
+            ("\\*\\/", ID_END)
+            ("[^*]+|\\*", ID_COMMENT)
+        ;
+        if (more)
+            this->self.add("[A-Z]+", ID_WORD);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// the token ids and lexer states the lexer returns for the input
+template <typename Lexer>
+std::vector<std::size_t> tokenize(Lexer const& lexer, std::string const& input)
+{
+    std::vector<std::size_t> result;
+    base_iterator first = input.begin();
+    typename Lexer::iterator_type it = lexer.begin(first, input.end());
+    typename Lexer::iterator_type end = lexer.end();
+    for (/**/; it != end && token_is_valid(*it); ++it)
+    {
+        result.push_back(it->id());
+        result.push_back(it->state());
+    }
+    result.push_back(first == input.end());
+    return result;
+}
+
+// a copy of the saved tables, aligned as if the file was mapped into memory
+std::vector<boost::uint64_t> aligned(std::string const& blob)
+{
+    std::vector<boost::uint64_t> buffer((blob.size() + 7) / 8);
+    std::copy(blob.begin(), blob.end(), reinterpret_cast<char*>(&buffer[0]));
+    return buffer;
+}
+
+template <typename Lexer>
+bool can_generate_static(Lexer const& lexer)
+{
+    std::stringstream out;
+    return lex::lexertl::generate_static(lexer, out, "test");
+}
+
+int main()
+{
+    typedef tokens<lexer_type> lexer_def;
+
+    std::string const input = "abc 123\n/* x * y */xyz 45 6\n\n/*";
+
+    lexer_def built;
+    std::vector<std::size_t> const expected = tokenize(built, input);
+    BOOST_TEST(expected.size() > 10);
+
+    std::ostringstream out;
+    BOOST_TEST(lex::lexertl::save_binary(built, out));
+    std::string const blob = out.str();
+    BOOST_TEST(blob.size() % 8 == 0);
+
+    {   // the saved tables are used as they are
+        std::vector<boost::uint64_t> buffer = aligned(blob);
+        lex::lexertl::binary_state_machine tables(&buffer[0], blob.size());
+
+        lexer_def loaded(tables);
+        BOOST_TEST(tokenize(loaded, input) == expected);
+        BOOST_TEST(!can_generate_static(loaded));
+
+        // saving again writes the same tables
+        std::ostringstream again;
+        BOOST_TEST(lex::lexertl::save_binary(loaded, again));
+        BOOST_TEST(again.str() == blob);
+    }
+
+    {   // tables saved from other token definitions are ignored
+        std::vector<boost::uint64_t> buffer = aligned(blob);
+        lex::lexertl::binary_state_machine tables(&buffer[0], blob.size());
+
+        tokens<lexer_type> other(tables, true);
+        tokens<lexer_type> other_built(true);
+        BOOST_TEST(tokenize(other, "ABC 1") == tokenize(other_built, "ABC 1"));
+        BOOST_TEST(can_generate_static(other));
+    }
+
+    {   // as are damaged or truncated tables
+        std::vector<boost::uint64_t> buffer = aligned(blob);
+        lex::lexertl::binary_state_machine truncated(&buffer[0], 40);
+        lexer_def short_(truncated);
+        BOOST_TEST(tokenize(short_, input) == expected);
+        BOOST_TEST(can_generate_static(short_));
+
+        reinterpret_cast<char*>(&buffer[0])[0] ^= 1;
+        lex::lexertl::binary_state_machine damaged(&buffer[0], blob.size());
+        lexer_def bad(damaged);
+        BOOST_TEST(tokenize(bad, input) == expected);
+        BOOST_TEST(can_generate_static(bad));
+    }
+
+    {   // actor lexers can use saved tables as well
+        typedef lex::lexertl::actor_lexer<token_type> actor_lexer_type;
+        tokens<actor_lexer_type> actor_built;
+
+        std::ostringstream actor_out;
+        BOOST_TEST(lex::lexertl::save_binary(actor_built, actor_out));
+        std::string const actor_blob = actor_out.str();
+        BOOST_TEST(actor_blob == blob);
+
+        std::vector<boost::uint64_t> buffer = aligned(actor_blob);
+        lex::lexertl::binary_state_machine tables(&buffer[0], actor_blob.size());
+        tokens<actor_lexer_type> loaded(tables);
+        BOOST_TEST(tokenize(loaded, input) == expected);
+        BOOST_TEST(!can_generate_static(loaded));
+    }
+
+    return boost::report_errors();
+}
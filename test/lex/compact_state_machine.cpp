@@ -0,0 +1,129 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/support/detail/lexer/generator.hpp>
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/compact_state_machine.hpp>
+#include <boost/spirit/home/lex/lexer/lexertl/iterator_tokenizer.hpp>
+
+#include <string>
+
+namespace lexertl = boost::spirit::lex::lexertl;
+
+typedef std::string::const_iterator base_iterator;
+typedef lexertl::basic_iterator_tokeniser<base_iterator> tokenizer;
+
+///////////////////////////////////////////////////////////////////////////////
+// tokenize the input with both the lexertl and the compact tables, the
+// results have to be the same
+void check(boost::lexer::rules const& rules, std::string const& input
+  , bool wide = false)
+{
+    boost::lexer::state_machine sm;
+    boost::lexer::generator::build(rules, sm);
+    lexertl::basic_compact_state_machine<char> csm(sm);
+
+    BOOST_TEST(csm.size() == sm.size());
+    BOOST_TEST(csm.wide() == wide);
+
+    base_iterator first1 = input.begin(), first2 = input.begin();
+    std::size_t state1 = 0, state2 = 0;
+    bool bol1 = true, bol2 = true;
+    for (;;)
+    {
+        std::size_t uid1 = 0, uid2 = 0;
+        std::size_t id1 = tokenizer::next(sm, state1, bol1, first1
+          , input.end(), uid1);
+        std::size_t id2 = tokenizer::next(csm, state2, bol2, first2
+          , input.end(), uid2);
+
+        BOOST_TEST(id1 == id2);
+        BOOST_TEST(uid1 == uid2);
+        BOOST_TEST(state1 == state2);
+        BOOST_TEST(bol1 == bol2);
+        BOOST_TEST(first1 == first2);
+        if (id1 != id2 || first1 != first2 || id1 == 0)
+            break;
+        if (id1 == boost::lexer::npos)
+            ++first1, ++first2;     // skip the unmatched character
+    }
+}
+
+int main()
+{
+    {
+        boost::lexer::rules rules;
+        rules.add("[a-z]+", 1);
+        rules.add("[0-9]+", 2);
+        rules.add("[0-9]+\\.[0-9]+", 3);
+        rules.add("if|then|else", 4);
+        rules.add("[ \t\n]+", 5);
+        check(rules, "if x1 then 3.14 else 42\n ?! done");
+    }
+
+    {   // bol and eol assertions
+        boost::lexer::rules rules;
+        rules.add("^#[a-z]+", 1);
+        rules.add("[a-z]+$", 2);
+        rules.add("[a-z]+", 3);
+        rules.add("[ \n#]", 4);
+        check(rules, "#define x\nab cd\n#if y z");
+    }
+
+    {   // lexer states
+        boost::lexer::rules rules;
+        rules.add_state("COMMENT");
+        rules.add("INITIAL", "[a-z]+", 1, ".");
+        rules.add("INITIAL", "\\/\\*", 2, "COMMENT");
+        rules.add("INITIAL", "[ ]+", 3, ".");
+        rules.add("COMMENT", "[^*]+|\\*", 4, ".");
+        rules.add("COMMENT", "\\*\\/", 5, "INITIAL");
+        check(rules, "a /* b * c */ d /* e");
+    }
+
+    {   // lexer states without token definitions don't match anything
+        boost::lexer::rules rules;
+        rules.add_state("EMPTY");
+        rules.add("INITIAL", "[a-z]+", 1, "EMPTY");
+
+        boost::lexer::state_machine sm;
+        boost::lexer::generator::build(rules, sm);
+        lexertl::basic_compact_state_machine<char> csm(sm);
+        BOOST_TEST(csm.size() == 2);
+
+        std::string input = "ab";
+        base_iterator first = input.begin();
+        std::size_t state = 0, uid = 0;
+        bool bol = true;
+        BOOST_TEST(tokenizer::next(csm, state, bol, first, input.end(), uid) == 1);
+        BOOST_TEST(state == 1);
+        first = input.begin();
+        BOOST_TEST(tokenizer::next(csm, state, bol, first, input.end(), uid)
+            == boost::lexer::npos);
+    }
+
+    {   // more than 65535 states need 32 bit entries
+        boost::lexer::rules rules;
+        std::string input;
+        unsigned int seed = 1;
+        for (int i = 0; i != 8000; ++i)
+        {
+            std::string word;
+            for (int j = 0; j != 12; ++j)
+            {
+                seed = seed * 1103515245 + 12345;
+                word += char('a' + (seed >> 16) % 26);
+            }
+            rules.add(word, i + 1);
+            if (i % 10 == 0)
+                input += word;
+        }
+        check(rules, input, true);
+    }
+
+    return boost::report_errors();
+}
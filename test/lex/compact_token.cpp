@@ -0,0 +1,175 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_lexertl_compact_token.hpp>
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/phoenix_container.hpp>
+
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+namespace qi = boost::spirit::qi;
+namespace mpl = boost::mpl;
+
+typedef char const* base_iterator;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens()
+      : identifier("[a-z]+"), number("[0-9]+")
+    {
+        this->self = identifier | number;
+        this->self("WS") = lex::token_def<>("[ \\t\\n]+");
+    }
+
+    lex::token_def<std::string> identifier;
+    lex::token_def<unsigned int> number;
+};
+
+template <typename Iterator, typename Lexer>
+struct grammar : qi::grammar<Iterator, qi::in_state_skipper<Lexer> >
+{
+    template <typename TokenDef>
+    grammar(TokenDef const& tok, std::vector<std::string>& names
+          , unsigned int& sum)
+      : grammar::base_type(start)
+    {
+        using boost::phoenix::push_back;
+
+        start = *(  tok.identifier[push_back(boost::phoenix::ref(names), qi::_1)]
+                 |  tok.number[boost::phoenix::ref(sum) += qi::_1]
+                 );
+    }
+
+    qi::rule<Iterator, qi::in_state_skipper<Lexer> > start;
+};
+
+// the names and the sum of the numbers in the input
+template <typename Token>
+bool parse(std::string const& input, std::vector<std::string>& names
+  , unsigned int& sum)
+{
+    typedef lex::lexertl::lexer<Token> lexer_type;
+    typedef typename lexer_type::iterator_type iterator_type;
+
+    tokens<lexer_type> lexer;
+    grammar<iterator_type, typename tokens<lexer_type>::lexer_def> g(
+        lexer, names, sum);
+
+    base_iterator first = input.c_str();
+    base_iterator last = first + input.size();
+    iterator_type it = lexer.begin(first, last);
+    return qi::phrase_parse(it, lexer.end(), g, qi::in_state("WS")[lexer.self])
+        && it == lexer.end();
+}
+
+int main()
+{
+    typedef lex::lexertl::compact_token<base_iterator> token_type;
+    typedef lex::lexertl::compact_token<base_iterator, mpl::false_>
+        stateless_token_type;
+
+    BOOST_TEST(sizeof(token_type) == 16);
+    BOOST_TEST(sizeof(stateless_token_type) == 12);
+
+    std::string const input = "abc 12 de\n\t34 f 5 ghij";
+
+    {   // the same values as with the default token type
+        typedef lex::lexertl::token<
+            base_iterator, mpl::vector<std::string, unsigned int> >
+        default_token_type;
+
+        std::vector<std::string> expected_names, names;
+        unsigned int expected_sum = 0, sum = 0;
+        BOOST_TEST(parse<default_token_type>(input, expected_names
+          , expected_sum));
+        BOOST_TEST(expected_names.size() == 4 && expected_sum == 51);
+
+        lex::lexertl::compact_token_buffer<base_iterator> buffer(input.c_str());
+        BOOST_TEST(parse<token_type>(input, names, sum));
+        BOOST_TEST(names == expected_names);
+        BOOST_TEST(sum == expected_sum);
+    }
+
+    {   // tokens store the position of the matched input
+        typedef lex::lexertl::lexer<token_type> lexer_type;
+        tokens<lexer_type> lexer;
+
+        std::string const text = "ab  cd";
+        lex::lexertl::compact_token_buffer<base_iterator> buffer(text.c_str());
+
+        base_iterator first = text.c_str();
+        lexer_type::iterator_type it =
+            lexer.begin(first, first + text.size(), "WS");
+        BOOST_TEST(!token_is_valid(*it));
+
+        first = text.c_str();
+        it = lexer.begin(first, first + text.size());
+        token_type t = *it;
+        BOOST_TEST(token_is_valid(t) && t.state() == 0);
+        BOOST_TEST(t.offset() == 0 && t.length() == 2);
+        BOOST_TEST(std::string(t.value().begin(), t.value().end()) == "ab");
+
+        // an inner buffer hides the outer one while it exists
+        std::string const other = "xy";
+        {
+            lex::lexertl::compact_token_buffer<base_iterator> inner(
+                other.c_str());
+            BOOST_TEST(std::string(t.value().begin(), t.value().end()) == "xy");
+        }
+        BOOST_TEST(std::string(t.value().begin(), t.value().end()) == "ab");
+
+        // sequences outside of the buffer can't be stored
+        bool thrown = false;
+        try
+        {
+            lex::lexertl::compact_token_buffer<base_iterator> inner(
+                text.c_str() + 2);
+            token_type(1, 0, text.c_str(), text.c_str() + 2);
+        }
+        catch (boost::lexer::runtime_error const&)
+        {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+
+        BOOST_TEST(token_type().state() == boost::lexer::npos);
+        BOOST_TEST(!token_is_valid(token_type()));
+        BOOST_TEST(!token_is_valid(token_type(0)));
+    }
+
+    {   // the value can't be accessed once the buffer is gone
+        std::string const text = "ab";
+        token_type t;
+        {
+            lex::lexertl::compact_token_buffer<base_iterator> buffer(
+                text.c_str());
+            t = token_type(1, 0, text.c_str(), text.c_str() + 2);
+            BOOST_TEST(t.value().size() == 2);
+        }
+
+        bool thrown = false;
+        try
+        {
+            t.value();
+        }
+        catch (boost::lexer::runtime_error const&)
+        {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+        BOOST_TEST(t.offset() == 0 && t.length() == 2);
+    }
+
+    return boost::report_errors();
+}
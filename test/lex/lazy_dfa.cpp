@@ -0,0 +1,139 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/config/warning_disable.hpp>
+
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+
+typedef std::string::const_iterator base_iterator;
+typedef lex::lexertl::token<base_iterator, boost::mpl::vector<> > token_type;
+
+///////////////////////////////////////////////////////////////////////////////
+enum tokenids
+{
+    ID_WORD = 1000, ID_NUMBER, ID_SPACE, ID_BEGIN, ID_END, ID_COMMENT
+};
+
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens(unsigned int flags, int keywords = 0)
+      : lex::lexer<Lexer>(flags)
+    {
+        this->self.add
+            ("^[a-z]+", ID_WORD)
+            ("[0-9]+$", ID_NUMBER)
+            ("[0-9]+", ID_NUMBER)
+            ("[ \\n]+", ID_SPACE)
+        ;
+        this->self("INITIAL", "COMMENT").add("\\/\\*", ID_BEGIN);
+        this->self("COMMENT", "INITIAL").add("\\*\\/", ID_END);
+        this->self("COMMENT").add("[^*]+|\\*", ID_COMMENT);
+
+        // many keywords, resulting in a DFA with many states
+        unsigned int seed = 1;
+        for (int i = 0; i != keywords; ++i)
+        {
+            std::string word;
+            for (int j = 0; j != 10; ++j)
+            {
+                seed = seed * 1103515245 + 12345;
+                word += char('a' + (seed >> 16) % 26);
+            }
+            this->self.add(word, ID_COMMENT + 1 + i);
+        }
+        this->self.add("[a-z]+", ID_WORD);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// the token ids and lexer states the lexer returns for the input
+template <typename Lexer>
+std::vector<std::size_t> tokenize(Lexer const& lexer, std::string const& input)
+{
+    std::vector<std::size_t> result;
+    base_iterator first = input.begin();
+    typename Lexer::iterator_type it = lexer.begin(first, input.end());
+    typename Lexer::iterator_type end = lexer.end();
+    for (/**/; it != end && token_is_valid(*it); ++it)
+    {
+        result.push_back(it->id());
+        result.push_back(it->state());
+    }
+    result.push_back(first == input.end());
+    return result;
+}
+
+int main()
+{
+    typedef lex::lexertl::lexer<token_type> lexer_type;
+    typedef tokens<lexer_type> lexer_def;
+
+    std::string const input =
+        "abc 123\n/* x * y */xyz 45 6\n\nwxgxkzmlod 7/* x";
+
+    {   // the same tokens as with the DFA built up front
+        lexer_def built(lex::match_flags::match_default);
+        lexer_def lazy(lex::match_flags::match_lazy_dfa);
+        std::vector<std::size_t> const expected = tokenize(built, input);
+        BOOST_TEST(expected.size() > 20);
+        BOOST_TEST(tokenize(lazy, input) == expected);
+
+        // also when the states are dropped all the time
+        lexer_def tiny(lex::match_flags::match_lazy_dfa);
+        tiny.lazy_dfa_max_states(1);
+        BOOST_TEST(tokenize(tiny, input) == expected);
+        BOOST_TEST(tokenize(tiny, input) == expected);
+
+        // lazy lexers can't be saved
+        std::ostringstream out;
+        BOOST_TEST(!lex::lexertl::save_binary(lazy, out));
+    }
+
+    {   // many rules
+        lexer_def built(lex::match_flags::match_default, 2000);
+        lexer_def lazy(lex::match_flags::match_lazy_dfa, 2000);
+        lazy.lazy_dfa_max_states(100);
+
+        std::string text = input;
+        for (int i = 0; i != 50; ++i)
+            text += " wxgxkzmlod qrs wxgxkz 12";
+
+        std::vector<std::size_t> const expected = tokenize(built, text);
+        BOOST_TEST(tokenize(lazy, text) == expected);
+        BOOST_TEST(tokenize(lazy, text) == expected);
+    }
+
+    {   // lexer semantic actions
+        typedef lex::lexertl::actor_lexer<token_type> actor_lexer_type;
+
+        struct counter : lex::lexer<actor_lexer_type>
+        {
+            counter(unsigned int flags)
+              : lex::lexer<actor_lexer_type>(flags), words(0)
+            {
+                using boost::phoenix::ref;
+                this->self = lex::token_def<>("[a-z]+")[++ref(words)]
+                    | lex::token_def<>("[^a-z]+");
+            }
+            int words;
+        };
+
+        counter built(lex::match_flags::match_default);
+        counter lazy(lex::match_flags::match_lazy_dfa);
+        BOOST_TEST(tokenize(lazy, input) == tokenize(built, input));
+        BOOST_TEST(lazy.words == 6 && built.words == 6);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,226 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/config/warning_disable.hpp>
+
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/support/detail/lexer/generator.hpp>
+#include <boost/spirit/home/support/detail/lexer/input.hpp>
+#include <boost/spirit/home/support/detail/lexer/internals.hpp>
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+
+///////////////////////////////////////////////////////////////////////////////
+enum tokenids
+{
+    ID_IDENTIFIER = 1000, ID_KEYWORD, ID_DOCTYPE, ID_DEFINE, ID_SPACE
+  , ID_NEWLINE, ID_BEGIN, ID_END, ID_COMMENT
+};
+
+// rules with long literals, some of them sharing a prefix or a suffix
+void add_rules(boost::lexer::rules& rules)
+{
+    rules.add_state("COMMENT");
+    rules.add("INITIAL", "[a-z]+", ID_IDENTIFIER, "INITIAL");
+    rules.add("INITIAL", "FUNCTION|FUNCTIONAL|PROCEDURE", ID_KEYWORD, "INITIAL");
+    rules.add("INITIAL", "<!DOCTYPE html>", ID_DOCTYPE, "INITIAL");
+    rules.add("INITIAL", "^#define", ID_DEFINE, "INITIAL");
+    rules.add("INITIAL", "END_OF_LINE$", ID_KEYWORD, "INITIAL");
+    rules.add("INITIAL", " +", ID_SPACE, "INITIAL");
+    rules.add("INITIAL", "\\n", ID_NEWLINE, "INITIAL");
+    rules.add("INITIAL", "<!--", ID_BEGIN, "COMMENT");
+    rules.add("COMMENT", "-->", ID_END, "INITIAL");
+    rules.add("COMMENT", "[^-]+|-", ID_COMMENT, "COMMENT");
+}
+
+// the fragments the random inputs are made of, including partial literals
+char const* const fragments[] = {
+    "abc", " ", "\n", "FUNCTION", "FUNCTIONAL", "FUNCT", "PROCEDURE",
+    "PROCED", "<!DOCTYPE html>", "<!DOCTY", "<!DOCTYPE htm", "#define",
+    "#def", "END_OF_LINE", "END_OF_LIN", "<!--", "-->", "--", "x"
+};
+
+std::string random_input(unsigned int& seed)
+{
+    std::string input;
+    std::size_t const count = sizeof(fragments) / sizeof(fragments[0]);
+    for (int i = 0; i != 12; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        input += fragments[(seed >> 16) % count];
+    }
+    return input;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the ids and positions of the tokens lexertl matches in the input
+std::vector<std::size_t> tokenize(boost::lexer::state_machine const& sm
+  , std::string const& input)
+{
+    typedef boost::lexer::basic_input<std::string::const_iterator> input_type;
+
+    std::vector<std::size_t> result;
+    input_type in(&sm, input.begin(), input.end());
+    input_type::iterator end = in.end();
+    for (input_type::iterator it = in.begin(); it != end; ++it)
+    {
+        result.push_back(it->id);
+        result.push_back(it->start - input.begin());
+        result.push_back(it->end - input.begin());
+    }
+    return result;
+}
+
+void clear_literals(boost::lexer::state_machine& sm)
+{
+    boost::lexer::detail::internals& internals =
+        const_cast<boost::lexer::detail::internals&>(sm.data());
+    for (std::size_t i = 0; i != internals._literals->size(); ++i)
+        internals._literals[i]->clear();
+}
+
+// the length of the chain starting in the given state
+std::size_t chain_length(boost::lexer::state_machine const& sm
+  , std::size_t dfa, std::size_t state)
+{
+    std::vector<std::size_t> const& literals = *sm.data()._literals[dfa];
+    if (literals.empty())
+        return 0;
+    return literals[state * boost::lexer::literal_size +
+        boost::lexer::literal_length];
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens(unsigned int flags = 0)
+      : lex::lexer<Lexer>(flags)
+    {
+        this->self.add
+            ("[a-z]+", ID_IDENTIFIER)
+            ("FUNCTION|FUNCTIONAL|PROCEDURE", ID_KEYWORD)
+            ("<!DOCTYPE html>", ID_DOCTYPE)
+            ("^#define", ID_DEFINE)
+            ("END_OF_LINE$", ID_KEYWORD)
+            (" +", ID_SPACE)
+            ("\\n", ID_NEWLINE)
+        ;
+        this->self("INITIAL", "COMMENT").add("<!--", ID_BEGIN);
+        this->self("COMMENT", "INITIAL").add("-->", ID_END);
+        this->self("COMMENT").add("[^-]+|-", ID_COMMENT);
+    }
+};
+
+// the ids, states and positions of the tokens the lexer returns
+template <typename Lexer>
+std::vector<std::size_t> tokenize(Lexer const& lexer, std::string const& input)
+{
+    typedef std::string::const_iterator base_iterator;
+
+    std::vector<std::size_t> result;
+    base_iterator first = input.begin();
+    typename Lexer::iterator_type it = lexer.begin(first, input.end());
+    typename Lexer::iterator_type end = lexer.end();
+    for (/**/; it != end && token_is_valid(*it); ++it)
+    {
+        result.push_back(it->id());
+        result.push_back(it->state());
+        result.push_back(it->value().begin() - input.begin());
+        result.push_back(it->value().end() - input.begin());
+    }
+    result.push_back(first == input.end());
+    return result;
+}
+
+int main()
+{
+    {   // the chains inside the literals are found
+        boost::lexer::rules rules;
+        add_rules(rules);
+
+        boost::lexer::state_machine sm;
+        boost::lexer::generator::build(rules, sm);
+        BOOST_TEST(sm.data()._literals->size() == 2);
+        BOOST_TEST(!sm.data()._literals[0]->empty());
+
+        // "<" leads to a state from which "!DOCTYPE html>" and "!--" are
+        // possible, after "<!D" only "OCTYPE html>" is
+        std::string const input("<!D");
+        std::size_t const* lookup = &sm.data()._lookup[0]->front();
+        std::size_t const* dfa = &sm.data()._dfa[0]->front();
+        std::size_t const alphabet = sm.data()._dfa_alphabet[0];
+        std::size_t state = 1;
+        for (std::size_t i = 0; i != input.size(); ++i)
+        {
+            state = dfa[state * alphabet +
+                lookup[static_cast<unsigned char>(input[i])]];
+        }
+        BOOST_TEST(chain_length(sm, 0, state) == 12);
+
+        boost::lexer::generator::minimise(sm);
+        BOOST_TEST(!sm.data()._literals[0]->empty());
+    }
+
+    {   // the same tokens are matched with and without the chains
+        boost::lexer::rules rules;
+        add_rules(rules);
+
+        boost::lexer::state_machine sm, plain_sm;
+        boost::lexer::generator::build(rules, sm);
+        boost::lexer::generator::build(rules, plain_sm);
+        clear_literals(plain_sm);
+
+        boost::lexer::state_machine minimised_sm;
+        boost::lexer::generator::build(rules, minimised_sm);
+        boost::lexer::generator::minimise(minimised_sm);
+
+        unsigned int seed = 1;
+        for (int i = 0; i != 500; ++i)
+        {
+            std::string const input(random_input(seed));
+            for (std::size_t size = input.size() - 10; size <= input.size();
+                 ++size)
+            {
+                std::string const prefix(input, 0, size);
+                std::vector<std::size_t> const expected =
+                    tokenize(plain_sm, prefix);
+                BOOST_TEST(tokenize(sm, prefix) == expected);
+                BOOST_TEST(tokenize(minimised_sm, prefix) == expected);
+            }
+        }
+    }
+
+    {   // the lexer matches the same tokens as the lazy DFA (which doesn't
+        // use the chains)
+        typedef lex::lexertl::token<std::string::const_iterator
+          , boost::mpl::vector<> > token_type;
+        typedef lex::lexertl::lexer<token_type> lexer_type;
+
+        tokens<lexer_type> lexer;
+        tokens<lexer_type> lazy_lexer(lex::match_flags::match_lazy_dfa);
+
+        unsigned int seed = 2;
+        for (int i = 0; i != 200; ++i)
+        {
+            std::string const input(random_input(seed));
+            for (std::size_t size = input.size() - 10; size <= input.size();
+                 ++size)
+            {
+                std::string const prefix(input, 0, size);
+                BOOST_TEST(tokenize(lexer, prefix) ==
+                    tokenize(lazy_lexer, prefix));
+            }
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,125 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/support/detail/lexer/generator.hpp>
+#include <boost/spirit/home/support/detail/lexer/generate_cpp.hpp>
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/spirit/home/support/detail/lexer/runtime_error.hpp>
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+
+#include <sstream>
+#include <string>
+
+typedef boost::lexer::generator generator;
+
+///////////////////////////////////////////////////////////////////////////////
+// the generated C++ code covers all the tables
+std::string generate(boost::lexer::rules const& rules, std::size_t threads
+  , bool minimise)
+{
+    boost::lexer::state_machine sm;
+    generator::build(rules, sm, threads);
+    if (minimise)
+        generator::minimise(sm, threads);
+
+    std::ostringstream out;
+    boost::lexer::generate_cpp(sm, out);
+    return out.str();
+}
+
+// building on any number of threads results in the same state machine
+void check(boost::lexer::rules const& rules)
+{
+    for (int minimise = 0; minimise != 2; ++minimise)
+    {
+        std::string const expected = generate(rules, 1, minimise != 0);
+        BOOST_TEST(!expected.empty());
+        BOOST_TEST(generate(rules, 0, minimise != 0) == expected);
+        BOOST_TEST(generate(rules, 2, minimise != 0) == expected);
+        BOOST_TEST(generate(rules, 5, minimise != 0) == expected);
+    }
+}
+
+int main()
+{
+    {   // see example/lex/strip_comments.cpp
+        boost::lexer::rules rules;
+        rules.add_state("COMMENT");
+        rules.add("INITIAL", "\\/\\/[^\\n]*", 1, ".");
+        rules.add("INITIAL", "\\/\\*", 2, "COMMENT");
+        rules.add("INITIAL", "[^\\n]", 3, ".");
+        rules.add("INITIAL", "\\n", 4, ".");
+        rules.add("COMMENT", "\\*\\/", 5, "INITIAL");
+        rules.add("COMMENT", "[^\\n]", 6, ".");
+        rules.add("COMMENT", "\\n", 7, ".");
+        check(rules);
+    }
+
+    {   // many lexer states, some with BOL and EOL assertions, macros, and
+        // a state without any rules
+        boost::lexer::rules rules;
+        rules.add_macro("WORD", "[a-z]+");
+        rules.add_state("EMPTY");
+        for (int i = 0; i != 12; ++i)
+        {
+            std::ostringstream state;
+            state << "S" << i;
+            rules.add_state(state.str().c_str());
+        }
+        for (int i = 0; i != 12; ++i)
+        {
+            std::ostringstream state, next;
+            state << "S" << i;
+            next << "S" << (i + 1) % 12;
+
+            std::ostringstream keyword;
+            keyword << "key" << i << "|word" << i * 7;
+            rules.add(state.str().c_str(), keyword.str(), 1 + i, "INITIAL");
+            if (i % 3 == 0)
+                rules.add(state.str().c_str(), "^{WORD}", 100 + i, ".");
+            if (i % 4 == 0)
+                rules.add(state.str().c_str(), "[0-9]+$", 200 + i, ".");
+            rules.add(state.str().c_str(), "{WORD}", 300 + i
+              , next.str().c_str());
+            rules.add(state.str().c_str(), "[ \\t\\n]+", 400, ".");
+        }
+        rules.add("INITIAL", "{WORD}", 500, "S0");
+        check(rules);
+    }
+
+    {   // errors are reported as for the serial build
+        boost::lexer::rules rules;
+        rules.add_state("A");
+        rules.add_state("B");
+        rules.add("INITIAL", "[a-z]+", 1, "A");
+        rules.add("A", "{UNDEFINED}", 2, "B");
+        rules.add("B", "x{", 3, ".");
+
+        std::string serial, parallel;
+        try
+        {
+            boost::lexer::state_machine sm;
+            generator::build(rules, sm, 1);
+        }
+        catch (boost::lexer::runtime_error const& e)
+        {
+            serial = e.what();
+        }
+        try
+        {
+            boost::lexer::state_machine sm;
+            generator::build(rules, sm, 3);
+        }
+        catch (boost::lexer::runtime_error const& e)
+        {
+            parallel = e.what();
+        }
+        BOOST_TEST(!serial.empty());
+        BOOST_TEST(parallel == serial);
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,43 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_generate_static_lexertl.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "threaded.h"
+
+int main(int argc, char* argv[])
+{
+    typedef boost::spirit::lex::lexertl::token<char const*> token_type;
+    typedef boost::spirit::lex::lexertl::lexer<token_type> lexer_type;
+
+    threaded_tokens<lexer_type> lexer;
+
+    // lay out the states in the order of their visits on the test input
+    std::string const input(threaded_input());
+    boost::spirit::lex::lexertl::state_profile profile;
+    BOOST_TEST(boost::spirit::lex::lexertl::record_state_profile(
+        lexer, input.begin(), input.end(), profile));
+    BOOST_TEST(!profile.empty() && profile.visits(0, 0) > 0);
+
+    std::ostringstream code;
+    BOOST_TEST(boost::spirit::lex::lexertl::generate_static_threaded(
+        lexer, code, "threaded", &profile));
+
+    // the comment and string bodies are scanned
+    BOOST_TEST(code.str().find("scan(curr_, end_, '\\n');") != std::string::npos);
+    BOOST_TEST(code.str().find("scan(curr_, end_, '*');") != std::string::npos);
+    BOOST_TEST(code.str().find("scan(curr_, end_, '>');") != std::string::npos);
+
+    std::ofstream out(argc < 2 ? "threaded_static.h" : argv[1]);
+    out << code.str();
+    return boost::report_errors();
+}
+
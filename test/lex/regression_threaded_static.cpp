@@ -0,0 +1,119 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_static_lexertl.hpp>
+
+#include <string>
+#include <vector>
+
+#include "threaded_static.h"
+#include "threaded.h"
+
+namespace lex = boost::spirit::lex;
+
+///////////////////////////////////////////////////////////////////////////////
+// the ids, states and lengths of the tokens matched in the input, followed by
+// whether the input could not be matched completely
+template <typename Lexer, typename Iterator>
+std::vector<std::size_t> tokenize(Lexer const& lexer, Iterator first
+  , Iterator last)
+{
+    std::vector<std::size_t> result;
+    typename Lexer::iterator_type it = lexer.begin(first, last);
+    typename Lexer::iterator_type end = lexer.end();
+    for (/**/; it != end && token_is_valid(*it); ++it)
+    {
+        result.push_back(it->id());
+        result.push_back(it->state());
+        result.push_back(std::distance(it->value().begin(), it->value().end()));
+    }
+    result.push_back(it != end);
+    return result;
+}
+
+template <typename Iterator>
+void check_scan(Iterator first, Iterator last)
+{
+    using lex::lexertl::static_::scan;
+
+    for (Iterator it = first; it != last; ++it)
+    {
+        char const c = *it;
+        BOOST_TEST(scan(it, last, c) == it);
+        BOOST_TEST(scan(it, last, '#', c) == it);
+        BOOST_TEST(scan(it, last, '#', '#', c) == it);
+        BOOST_TEST(scan(it, last, '#', '#', '#', c) == it);
+    }
+    BOOST_TEST(scan(first, last) == last);
+    BOOST_TEST(scan(first, last, '#') == last);
+    BOOST_TEST(scan(first, last, '#', '$', '%', '&') == last);
+}
+
+int main()
+{
+    {   // scan finds the first stop character
+        std::string input;
+        for (int i = 0; i != 100; ++i)
+            input += static_cast<char>('a' + i % 26);
+        input += "\xe4\n";
+
+        char const* first = input.c_str();
+        char const* last = first + input.size();
+        check_scan(first, last);
+        check_scan(input.begin(), input.end());
+
+        BOOST_TEST(lex::lexertl::static_::scan(first, last, 'z', '\n') ==
+            first + 25);
+        BOOST_TEST(lex::lexertl::static_::scan(first + 26, last, '\xe4') ==
+            last - 2);
+    }
+
+    {   // the threaded tokenizer matches the same tokens as the dynamic lexer
+        typedef lex::lexertl::token<char const*> token_type;
+        typedef lex::lexertl::lexer<token_type> lexer_type;
+        typedef lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_threaded
+        > static_lexer_type;
+
+        threaded_tokens<lexer_type> dynamic_lexer;
+        threaded_tokens<static_lexer_type> static_lexer;
+
+        std::string const input(threaded_input());
+        char const* first = input.c_str();
+        char const* last = first + input.size();
+
+        std::vector<std::size_t> expected = tokenize(dynamic_lexer, first, last);
+        BOOST_TEST(expected.size() > 1000);
+        BOOST_TEST(tokenize(static_lexer, first, last) == expected);
+
+        // every prefix is tokenized the same way as well
+        for (std::size_t i = 0; i != 200; ++i)
+        {
+            BOOST_TEST(tokenize(static_lexer, first, first + i) ==
+                tokenize(dynamic_lexer, first, first + i));
+        }
+    }
+
+    {   // the generic code path is used for other iterators
+        typedef std::string::const_iterator base_iterator;
+        typedef lex::lexertl::token<base_iterator> token_type;
+        typedef lex::lexertl::lexer<token_type> lexer_type;
+        typedef lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_threaded
+        > static_lexer_type;
+
+        threaded_tokens<lexer_type> dynamic_lexer;
+        threaded_tokens<static_lexer_type> static_lexer;
+
+        std::string const input(threaded_input());
+        BOOST_TEST(tokenize(static_lexer, input.begin(), input.end()) ==
+            tokenize(dynamic_lexer, input.begin(), input.end()));
+    }
+
+    return boost::report_errors();
+}
+
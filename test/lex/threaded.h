@@ -0,0 +1,58 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef THREADED_H_OCT_17_2026
+#define THREADED_H_OCT_17_2026
+
+#include <boost/spirit/include/lex.hpp>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+//  The token definitions shared by regression_threaded_generate.cpp and
+//  regression_threaded_static.cpp. The string literals and comments make the
+//  generated tokenizer scan over the input.
+enum threaded_token_ids
+{
+    ID_IDENTIFIER = 1000, ID_NUMBER, ID_STRING, ID_LINE_COMMENT
+  , ID_BLOCK_COMMENT, ID_SPACE, ID_RAW_BEGIN, ID_RAW_END, ID_RAW, ID_ANY
+};
+
+template <typename Lexer>
+struct threaded_tokens : boost::spirit::lex::lexer<Lexer>
+{
+    threaded_tokens()
+    {
+        this->self.add
+            ("[a-zA-Z_][a-zA-Z_0-9]*", ID_IDENTIFIER)
+            ("[0-9]+", ID_NUMBER)
+            ("\\\"([^\\\"\\\\\\n]|\\\\.)*\\\"", ID_STRING)
+            ("\\/\\/[^\\n]*", ID_LINE_COMMENT)
+            ("\\/\\*[^*]*\\*+([^/*][^*]*\\*+)*\\/", ID_BLOCK_COMMENT)
+            ("[ \\t\\n]+", ID_SPACE)
+        ;
+        this->self("INITIAL", "RAW").add("<<", ID_RAW_BEGIN);
+        this->self.add(".", ID_ANY);
+
+        this->self("RAW", "INITIAL").add(">>", ID_RAW_END);
+        this->self("RAW").add("[^>]+|>", ID_RAW);
+    }
+};
+
+// the input the tokenizer is profiled and tested with
+inline std::string threaded_input()
+{
+    std::string input;
+    for (int i = 0; i != 50; ++i)
+    {
+        input += "int x_1 = 42; // the answer to the question\n";
+        input += "char const* s = \"a \\\"quoted\\\" string\\n\";\n";
+        input += "/* a block comment ** spanning\n   two lines */\n";
+        input += "raw << some raw text > and some more raw text >> ;\n";
+    }
+    input += "\"unterminated\n/* unterminated";
+    return input;
+}
+
+#endif
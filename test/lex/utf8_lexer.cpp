@@ -0,0 +1,214 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/config/warning_disable.hpp>
+
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/support/detail/lexer/generator.hpp>
+#include <boost/spirit/home/support/detail/lexer/parser/utf8_regex.hpp>
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/spirit/home/support/detail/lexer/runtime_error.hpp>
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+
+#include <string>
+#include <vector>
+
+namespace lex = boost::spirit::lex;
+
+typedef char const* base_iterator;
+typedef lex::lexertl::token<base_iterator, boost::mpl::vector<> > token_type;
+typedef lex::lexertl::lexer<token_type> lexer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+enum tokenids
+{
+    ID_WORD = 1000, ID_GREEK, ID_EURO, ID_NUMBER, ID_EMOJI, ID_SPACE
+  , ID_ANY, ID_KEYWORD
+};
+
+template <typename Lexer>
+struct tokens : lex::lexer<Lexer>
+{
+    tokens(unsigned int flags = 0)
+      : tokens::base_type(lex::match_flags::match_utf8 | flags)
+    {
+        this->self.add_pattern("GREEK", "[\\x3b1-\\x3c9]");
+        this->self.add
+            ("stra\xc3\x9f" "e", ID_KEYWORD)        // "straße"
+            ("[a-z\\xe4\\xf6\\xfc\\xdf]+", ID_WORD)
+            ("{GREEK}{2,3}", ID_GREEK)
+            ("\xe2\x82\xac", ID_EURO)               // "€"
+            ("[0-9]+", ID_NUMBER)
+            ("[\\x1f600-\\x1f64f]", ID_EMOJI)
+            ("[ \\n]+", ID_SPACE)
+            (".", ID_ANY)
+        ;
+    }
+};
+
+// the ids and byte lengths of the tokens matched in the input, followed by
+// whether the input could not be matched completely
+std::vector<std::size_t> tokenize(lexer_type const& lexer
+  , std::string const& input)
+{
+    std::vector<std::size_t> result;
+    base_iterator first = input.c_str();
+    lexer_type::iterator_type it = lexer.begin(first, first + input.size());
+    lexer_type::iterator_type end = lexer.end();
+    for (/**/; it != end && token_is_valid(*it); ++it)
+    {
+        result.push_back(it->id());
+        result.push_back(it->value().end() - it->value().begin());
+    }
+    result.push_back(it != end);
+    return result;
+}
+
+std::vector<std::size_t> expected(std::size_t const* values)
+{
+    std::vector<std::size_t> result;
+    for (/**/; *values != 0; values += 2)
+    {
+        result.push_back(values[0]);
+        result.push_back(values[1]);
+    }
+    result.push_back(values[1]);
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the UTF-8 encoding of the code point matches one of the sequences
+bool matches(boost::lexer::detail::utf8_regex::sequence_vector const& seqs
+  , boost::uint32_t cp)
+{
+    typedef boost::lexer::detail::utf8_regex utf8_regex;
+
+    unsigned char bytes[4];
+    std::size_t const length = utf8_regex::encoded_length(cp);
+    utf8_regex::encode(cp, bytes);
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != seqs.size(); ++i)
+    {
+        if (seqs[i].size() != length)
+            continue;
+
+        bool match = true;
+        for (std::size_t j = 0; match && j != length; ++j)
+        {
+            match = bytes[j] >= seqs[i][j].first
+                 && bytes[j] <= seqs[i][j].second;
+        }
+        count += match;
+    }
+    BOOST_TEST(count <= 1);
+    return count == 1;
+}
+
+void check_sequences(boost::uint32_t first, boost::uint32_t last)
+{
+    boost::lexer::detail::utf8_regex::sequence_vector seqs;
+    if (first < 0xd800 && last > 0xdfff)
+    {
+        boost::lexer::detail::utf8_regex::sequences(first, 0xd7ff, seqs);
+        boost::lexer::detail::utf8_regex::sequences(0xe000, last, seqs);
+    }
+    else
+    {
+        boost::lexer::detail::utf8_regex::sequences(first, last, seqs);
+    }
+
+    std::size_t errors = 0;
+    for (boost::uint32_t cp = 0; cp <= 0x10ffff; ++cp)
+    {
+        if (cp == 0xd800)
+            cp = 0xe000;
+        if (matches(seqs, cp) != (cp >= first && cp <= last))
+            ++errors;
+    }
+    BOOST_TEST(errors == 0);
+}
+
+int main()
+{
+    {   // the byte sequences match exactly the encoded code points
+        check_sequences(0, 0x10ffff);
+        check_sequences(0x80, 0x7ff);
+        check_sequences(0x7f, 0x800);
+        check_sequences(0x3b1, 0x3c9);
+        check_sequences(0x1234, 0x10fedc);
+        check_sequences(0xffff, 0x10000);
+        check_sequences(0x1f600, 0x1f64f);
+    }
+
+    {   // code points are matched as a whole
+        tokens<lexer_type> lexer;
+
+        std::string const input =
+            "gr\xc3\xbc\xc3\x9f" "e \xce\xb1\xce\xb2\xce\xb3 "  // "grüße αβγ "
+            "\xe2\x82\xac" "5 \xf0\x9f\x98\x80\n"               // "€5 😀\n"
+            "stra\xc3\x9f" "e \xd0\xb6 \xce\xb1";               // "straße ж α"
+
+        std::size_t const values[] = {
+            ID_WORD, 7, ID_SPACE, 1, ID_GREEK, 6, ID_SPACE, 1,
+            ID_EURO, 3, ID_NUMBER, 1, ID_SPACE, 1, ID_EMOJI, 4, ID_SPACE, 1,
+            ID_KEYWORD, 7, ID_SPACE, 1, ID_ANY, 2, ID_SPACE, 1, ID_ANY, 2,
+            0, false
+        };
+        BOOST_TEST(tokenize(lexer, input) == expected(values));
+    }
+
+    {   // invalid UTF-8 is not matched
+        tokens<lexer_type> lexer;
+
+        std::size_t const truncated[] = { ID_WORD, 2, 0, true };
+        BOOST_TEST(tokenize(lexer, "ab\xe2\x82") == expected(truncated));
+
+        std::size_t const overlong[] = { ID_SPACE, 1, 0, true };
+        BOOST_TEST(tokenize(lexer, " \xc0\x80") == expected(overlong));
+
+        std::size_t const surrogate[] = { 0, true };
+        BOOST_TEST(tokenize(lexer, "\xed\xa0\x80") == expected(surrogate));
+
+        std::size_t const continuation[] = { ID_NUMBER, 2, 0, true };
+        BOOST_TEST(tokenize(lexer, "12\x80") == expected(continuation));
+    }
+
+    {   // case insensitive matching
+        tokens<lexer_type> lexer(lex::match_flags::match_icase);
+
+        std::size_t const values[] = { ID_KEYWORD, 7, ID_SPACE, 1, ID_WORD, 3
+          , 0, false };
+        BOOST_TEST(tokenize(lexer, "STRA\xc3\x9f" "E aBc") == expected(values));
+    }
+
+    {   // the DFA uses 256 entry lookup tables
+        boost::lexer::rules rules(boost::lexer::utf8);
+        rules.add("[\\x100-\\x10ffff]+", 1);
+        rules.add("[^a]", 2);
+
+        boost::lexer::state_machine sm;
+        boost::lexer::generator::build(rules, sm);
+        BOOST_TEST(sm.data()._lookup[0]->size() == 256);
+    }
+
+    {   // the regexes have to be valid UTF-8
+        boost::lexer::rules rules(boost::lexer::utf8);
+        rules.add("ab\xc3", 1);
+
+        bool thrown = false;
+        try {
+            boost::lexer::state_machine sm;
+            boost::lexer::generator::build(rules, sm);
+        }
+        catch (boost::lexer::runtime_error const&) {
+            thrown = true;
+        }
+        BOOST_TEST(thrown);
+    }
+
+    return boost::report_errors();
+}
@@ -51,5 +51,40 @@ main()
         BOOST_TEST((test("a b c d", skip(val(space))[*char_])));
     }
 
+    { // runs of white space (skipped in bulk from contiguous input)
+        using boost::spirit::standard::space;
+        using boost::spirit::standard::char_;
+        using boost::spirit::qi::phrase_parse;
+
+        std::string blanks;
+        for (int i = 0; i < 37; ++i)
+            blanks += " \t\n\v\f\r"[i % 6];
+
+        for (std::size_t n = 0; n <= blanks.size(); ++n)
+        {
+            std::string const input = blanks.substr(0, n) + "a"
+                + blanks.substr(n) + "b" + blanks.substr(0, n);
+
+            std::string s;
+            BOOST_TEST((test_attr(input.c_str(), *char_, s, space)));
+            BOOST_TEST(s == "ab");
+
+            std::string::const_iterator first = input.begin();
+            s.clear();
+            BOOST_TEST((phrase_parse(first, input.end(), *char_, space, s)));
+            BOOST_TEST(first == input.end());
+            BOOST_TEST(s == "ab");
+        }
+    }
+
+    { // white space and comments
+        std::string s;
+        BOOST_TEST((test_attr("  a # one\n\t\t b#two\n#three\n          c  "
+          , *alpha, s, space | ('#' >> *(char_ - '\n') >> '\n'))));
+        BOOST_TEST(s == "abc");
+        BOOST_TEST(!(test("a # unterminated", *alpha
+          , space | ('#' >> *(char_ - '\n') >> '\n'))));
+    }
+
     return boost::report_errors();
 }
@@ -6,6 +6,7 @@
 =============================================================================*/
 #include <boost/detail/lightweight_test.hpp>
 #include <boost/spirit/include/qi_string.hpp>
+#include <boost/spirit/home/qi/string/perfect_hash.hpp>
 #include <boost/spirit/include/qi_char.hpp>
 #include <boost/spirit/include/qi_action.hpp>
 #include <boost/spirit/include/qi_auxiliary.hpp>
@@ -229,5 +230,31 @@ main()
         BOOST_TEST((test("Ruby", sym)));
     }
 
+    { // frozen symbols
+        using boost::spirit::qi::perfect_hash;
+        using boost::spirit::ascii::no_case;
+
+        symbols<char, int, perfect_hash<char, int> > sym;
+        sym.add
+            ("joel", 1)
+            ("ruby", 2)
+            ("joey", 3)
+            ("joeyboy", 4)
+        ;
+        sym.freeze();
+
+        int i;
+        BOOST_TEST((test_attr("joeyboy", sym, i)));
+        BOOST_TEST(i == 4);
+        BOOST_TEST((test_attr("JOEY", no_case[sym], i)));
+        BOOST_TEST(i == 3);
+        BOOST_TEST((!test("jo", sym)));
+
+        sym.remove("joeyboy"); // thaws
+        sym.freeze();
+        BOOST_TEST((test_attr("joeyboy", sym, i, false)));
+        BOOST_TEST(i == 3);
+    }
+
     return boost::report_errors();
 }
@@ -7,6 +7,7 @@
 #include <boost/detail/lightweight_test.hpp>
 #include <boost/spirit/home/qi/string/tst.hpp>
 #include <boost/spirit/home/qi/string/tst_map.hpp>
+#include <boost/spirit/home/qi/string/perfect_hash.hpp>
 
 #include <string>
 #include <cctype>
@@ -63,6 +64,25 @@ namespace
         std::cout << ']' << std::endl;
     }
 
+    // a Lookup frozen after each change
+    template <typename Lookup>
+    struct frozen : Lookup
+    {
+        template <typename Iterator>
+        void add(Iterator first, Iterator last, int data)
+        {
+            Lookup::add(first, last, data);
+            this->freeze();
+        }
+
+        template <typename Iterator>
+        void remove(Iterator first, Iterator last)
+        {
+            Lookup::remove(first, last);
+            this->freeze();
+        }
+    };
+
     struct no_case_filter
     {
         template <typename Char>
@@ -353,9 +373,11 @@ int main()
 {
     using boost::spirit::qi::tst;
     using boost::spirit::qi::tst_map;
+    using boost::spirit::qi::perfect_hash;
 
     tests<tst<char, int>, tst<wchar_t, int> >();
     tests<tst_map<char, int>, tst_map<wchar_t, int> >();
+    tests<frozen<perfect_hash<char, int> >, frozen<perfect_hash<wchar_t, int> > >();
 
     return boost::report_errors();
 }
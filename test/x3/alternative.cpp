@@ -228,5 +228,55 @@ main()
         BOOST_TEST(boost::get<char>(&boost::fusion::front(attr_)) == nullptr);
     }
 
+    {   // dispatch on the first character
+        using boost::spirit::x3::eps;
+        using boost::spirit::x3::no_case;
+        using boost::spirit::x3::string;
+        using boost::spirit::x3::symbols;
+        using boost::spirit::x3::traits::first_set;
+        using boost::spirit::x3::ascii::space;
+
+        auto keywords = lit("if") | lit("else") | lit("while") | char_('x');
+        static_assert(first_set<decltype(keywords)>::is_known, "");
+        static_assert(!first_set<decltype(eps >> lit("if"))>::is_known, "");
+
+        BOOST_TEST((test("if", keywords)));
+        BOOST_TEST((test("else", keywords)));
+        BOOST_TEST((test("while", keywords)));
+        BOOST_TEST((test("x", keywords)));
+        BOOST_TEST((!test("y", keywords)));
+        BOOST_TEST((!test("", keywords)));
+        BOOST_TEST((test("  while", keywords, space)));
+        BOOST_TEST((test("ELSE", no_case[keywords])));
+
+        // still the first branch that matches, not the longest
+        BOOST_TEST((test("ab", lit("ab") | lit("abc") | lit('x'))));
+        BOOST_TEST((!test("abc", lit("ab") | lit("abc") | lit('x'))));
+
+        // branches with an unknown FIRST set are always tried
+        BOOST_TEST((test("b", lit('a') | (eps >> lit('b')) | lit('c'))));
+        BOOST_TEST((test("", lit('a') | lit('b') | eps)));
+        BOOST_TEST((test("", lit('a') | lit('b') | eps, space)));
+
+        symbols<int> sym;
+        sym.add("one", 1)("two", 2);
+        int n = 0;
+        BOOST_TEST((test_attr("two", sym | int_ | (lit('x') >> attr(3)), n)));
+        BOOST_TEST(n == 2);
+        BOOST_TEST((test_attr("-12", sym | int_ | (lit('x') >> attr(3)), n)));
+        BOOST_TEST(n == -12);
+        BOOST_TEST((test_attr("x", sym | int_ | (lit('x') >> attr(3)), n)));
+        BOOST_TEST(n == 3);
+        BOOST_TEST((!test_attr("three", sym | int_ | (lit('x') >> attr(3)), n)));
+
+        boost::variant<int, char, std::string> v;
+        BOOST_TEST((test_attr("abc", int_ | char_('x') | string("abc"), v)));
+        BOOST_TEST(boost::get<std::string>(v) == "abc");
+        BOOST_TEST((test_attr("x", int_ | (char_('x') | string("abc")), v)));
+        BOOST_TEST(boost::get<char>(v) == 'x');
+        BOOST_TEST((test_attr(" 42", int_ | char_('x') | string("abc"), v, space)));
+        BOOST_TEST(boost::get<int>(v) == 42);
+    }
+
     return boost::report_errors();
 }
@@ -0,0 +1,194 @@
+/*=============================================================================
+    Copyright (c) 2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/support/ast/variant.hpp>
+#include <boost/spirit/home/x3/support/utility/arena.hpp>
+#include <boost/fusion/include/adapt_struct.hpp>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include "test.hpp"
+
+namespace x3 = boost::spirit::x3;
+
+struct entry
+{
+    x3::arena_string key;
+    x3::arena_vector<int> values;
+};
+
+BOOST_FUSION_ADAPT_STRUCT(entry,
+    key, values
+)
+
+// a recursive (x3::variant) AST: the lists are allocated from the arena,
+// the forward_ast nodes holding them from the heap
+struct node;
+typedef x3::arena_vector<node> node_list;
+
+struct node : x3::variant<int, x3::forward_ast<node_list>>
+{
+    using base_type::base_type;
+    using base_type::operator=;
+};
+
+namespace
+{
+    x3::rule<class entry_, entry> const entry_ = "entry";
+    auto const entry__def =
+        x3::lexeme[+x3::alpha] >> '=' >> (x3::int_ % ',') >> ';';
+    BOOST_SPIRIT_DEFINE(entry_);
+
+    x3::rule<class node_, node> const node_ = "node";
+    auto const node__def = x3::int_ | '(' >> *node_ >> ')';
+    BOOST_SPIRIT_DEFINE(node_);
+}
+
+int
+main()
+{
+    using spirit_test::test_attr;
+    using x3::arena;
+    using x3::arena_tag;
+    using x3::arena_allocator;
+    using x3::arena_scope;
+    using x3::arena_string;
+    using x3::arena_vector;
+    using x3::with;
+
+    {   // the arena itself
+        arena a(16);
+        BOOST_TEST(arena::current() == 0);
+
+        char* p = static_cast<char*>(a.allocate(3, 1));
+        void* q = a.allocate(sizeof(double), alignof(double));
+        BOOST_TEST(reinterpret_cast<std::uintptr_t>(q) % alignof(double) == 0);
+        std::memset(p, 'x', 3);
+        BOOST_TEST(a.bytes_allocated() == 3 + sizeof(double));
+
+        // larger than a block
+        void* r = a.allocate(10000);
+        std::memset(r, 0, 10000);
+        BOOST_TEST(a.bytes_allocated() == 10003 + sizeof(double));
+
+        a.release();
+        BOOST_TEST(a.bytes_allocated() == 0);
+    }
+
+    {   // default constructed allocators take the current arena
+        arena a;
+        BOOST_TEST(arena_allocator<int>().get_arena() == 0);
+        {
+            arena_scope scope(a);
+            BOOST_TEST(arena::current() == &a);
+            BOOST_TEST(arena_allocator<int>().get_arena() == &a);
+
+            arena b;
+            {
+                arena_scope inner(b);
+                BOOST_TEST(arena::current() == &b);
+            }
+            BOOST_TEST(arena::current() == &a);
+
+            arena_vector<int> v(100, 1);
+            BOOST_TEST(a.bytes_allocated() >= 100 * sizeof(int));
+        }
+        BOOST_TEST(arena::current() == 0);
+
+        // no arena: the heap
+        arena_vector<int> v(100, 1);
+        BOOST_TEST(v.get_allocator().get_arena() == 0);
+    }
+
+    {   // parsing into arena containers
+        arena a;
+        arena_vector<arena_string> words{arena_allocator<arena_string>(a)};
+        char const* in = "the quick brown fox jumps over the lazy dog";
+        char const* first = in;
+        char const* last = in + std::strlen(in);
+
+        BOOST_TEST(x3::phrase_parse(first, last
+          , with<arena_tag>(std::ref(a))[*x3::lexeme[+x3::alpha]]
+          , x3::space, words));
+        BOOST_TEST(first == last);
+        BOOST_TEST(words.size() == 9);
+        BOOST_TEST(words[2] == "brown");
+        BOOST_TEST(words[8].get_allocator().get_arena() == &a);
+        BOOST_TEST(words.get_allocator().get_arena() == &a);
+        BOOST_TEST(a.bytes_allocated() != 0);
+        BOOST_TEST(arena::current() == 0);
+    }
+
+    {   // an empty container without an arena adopts the parse's arena
+        arena a;
+        arena_vector<arena_string> words;
+        char const* in = "lorem ipsum dolor";
+        char const* first = in;
+        char const* last = in + std::strlen(in);
+
+        BOOST_TEST(x3::phrase_parse(first, last
+          , with<arena_tag>(std::ref(a))[*x3::lexeme[+x3::alpha]]
+          , x3::space, words));
+        BOOST_TEST(words.size() == 3);
+        BOOST_TEST(words[1] == "ipsum");
+        BOOST_TEST(words.get_allocator().get_arena() == &a);
+        BOOST_TEST(x3::traits::is_arena_container<arena_vector<int>>::value);
+        BOOST_TEST(!x3::traits::is_arena_container<std::vector<int>>::value);
+    }
+
+    {   // rules synthesizing arena containers
+        arena a;
+        std::vector<entry> entries;
+        char const* in = "a = 1, 2, 3; bc = 4; def = 5, 6;";
+        char const* first = in;
+        char const* last = in + std::strlen(in);
+
+        BOOST_TEST(x3::phrase_parse(first, last
+          , with<arena_tag>(std::ref(a))[*entry_]
+          , x3::space, entries));
+        BOOST_TEST(first == last);
+        BOOST_TEST(entries.size() == 3);
+        BOOST_TEST(entries[1].key == "bc");
+        BOOST_TEST(entries[2].values.size() == 2);
+        BOOST_TEST(entries[2].values[1] == 6);
+        BOOST_TEST(entries[0].values.get_allocator().get_arena() == &a);
+        BOOST_TEST(entries[0].key.get_allocator().get_arena() == &a);
+    }
+
+    {   // variant ASTs
+        arena a;
+        node tree;
+        char const* in = "(1 (2 3) () 4)";
+        char const* first = in;
+        char const* last = in + std::strlen(in);
+
+        BOOST_TEST(x3::phrase_parse(first, last
+          , with<arena_tag>(std::ref(a))[node_], x3::space, tree));
+        BOOST_TEST(first == last);
+
+        node_list const& top = boost::get<x3::forward_ast<node_list>>(tree).get();
+        BOOST_TEST(top.size() == 4);
+        BOOST_TEST(boost::get<int>(top[3]) == 4);
+        BOOST_TEST(top.get_allocator().get_arena() == &a);
+
+        node_list const& inner =
+            boost::get<x3::forward_ast<node_list>>(top[1]).get();
+        BOOST_TEST(inner.size() == 2);
+        BOOST_TEST(boost::get<int>(inner[1]) == 3);
+        BOOST_TEST(inner.get_allocator().get_arena() == &a);
+    }
+
+    {   // test_attr works with arena containers without an arena (the heap)
+        arena_vector<int> v;
+        BOOST_TEST(test_attr("1,2,3", x3::int_ % ',', v));
+        BOOST_TEST(v.size() == 3);
+    }
+
+    return boost::report_errors();
+}
@@ -93,6 +93,44 @@ main()
         BOOST_TEST(!test_attr(long_long_underflow, long_long, ll));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  long digit strings (extracted 8 digits at a time)
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        using boost::spirit::x3::int_;
+        using boost::spirit::x3::long_long;
+        using boost::spirit::x3::int_parser;
+        int i;
+        boost::long_long_type ll;
+
+        BOOST_TEST(test_attr("-123456789", int_, i));
+        BOOST_TEST(i == -123456789);
+        BOOST_TEST(test_attr("123456789x12345678", int_, i, false));
+        BOOST_TEST(i == 123456789);
+        BOOST_TEST(test_attr("1234567890123456", long_long, ll));
+        BOOST_TEST(ll == 1234567890123456LL);
+        BOOST_TEST(test_attr("-12345678901234567", long_long, ll));
+        BOOST_TEST(ll == -12345678901234567LL);
+        BOOST_TEST(test_attr("1234567890123x5678", long_long, ll, false));
+        BOOST_TEST(ll == 1234567890123LL);
+        BOOST_TEST(test_attr("00000000000000001234567890", long_long, ll));
+        BOOST_TEST(ll == 1234567890LL);
+
+        // overflow within a block of 8 digits
+        BOOST_TEST(!test_attr("21474836470", int_, i));
+        BOOST_TEST(!test_attr("-92233720368547758080", long_long, ll));
+        BOOST_TEST(!test_attr("123456789012345678901234567890", long_long, ll));
+
+        int_parser<boost::long_long_type, 16> hex_ll;
+        BOOST_TEST(test_attr("7fffFFFFffffFFFF", hex_ll, ll));
+        BOOST_TEST(ll == LLONG_MAX);
+        BOOST_TEST(test_attr("-7fffffffffffffff", hex_ll, ll));
+        BOOST_TEST(ll == -LLONG_MAX);
+        BOOST_TEST(test_attr("12345678abcdefg", hex_ll, ll, false));
+        BOOST_TEST(ll == 0x12345678abcdefLL);
+        BOOST_TEST(!test_attr("80000000000000000", hex_ll, ll));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     //  short_ and long_ tests
     ///////////////////////////////////////////////////////////////////////////
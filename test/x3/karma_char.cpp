@@ -0,0 +1,75 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3/karma/core.hpp>
+#include <boost/spirit/home/x3/karma/char.hpp>
+#include <boost/spirit/home/x3/karma/string.hpp>
+#include <boost/optional.hpp>
+
+#include <string>
+#include "karma_test.hpp"
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_delimited;
+    namespace karma = boost::spirit::x3::karma;
+
+    {   // literals
+        using karma::lit;
+
+        BOOST_TEST(test("x", 'x'));
+        BOOST_TEST(test(L"x", L'x'));
+        BOOST_TEST(test("x", lit('x')));
+        BOOST_TEST(test("abc", "abc"));
+        BOOST_TEST(test(L"abc", L"abc"));
+        BOOST_TEST(test("abc", lit("abc")));
+        BOOST_TEST(test("abc", lit(std::string("abc"))));
+        BOOST_TEST(test("x", 'x', 'y'));     // the attribute is ignored
+        BOOST_TEST(test("abc", "abc", 1));
+    }
+
+    {   // char_
+        using karma::char_;
+
+        BOOST_TEST(test("x", char_, 'x'));
+        BOOST_TEST(test("x", char_('x')));
+        BOOST_TEST(test("x", char_('x'), 'x'));
+        BOOST_TEST(!test("", char_('x'), 'y'));
+        BOOST_TEST(test("x", char_, boost::optional<char>('x')));
+        BOOST_TEST(!test("", char_, boost::optional<char>()));
+
+        BOOST_TEST(test(L"x", karma::standard_wide::char_, L'x'));
+        BOOST_TEST(test(L"x", karma::standard_wide::char_(L'x')));
+    }
+
+    {   // string
+        using karma::string;
+
+        BOOST_TEST(test("abc", string, std::string("abc")));
+        BOOST_TEST(test("abc", string, "abc"));
+        BOOST_TEST(test("", string, std::string()));
+        BOOST_TEST(test("abc", string("abc")));
+        BOOST_TEST(test("abc", string("abc"), std::string("abc")));
+        BOOST_TEST(!test("", string("abc"), std::string("abd")));
+
+        BOOST_TEST(test(L"abc", karma::standard_wide::string, std::wstring(L"abc")));
+    }
+
+    {   // delimited
+        using karma::char_;
+        using karma::string;
+
+        BOOST_TEST(test_delimited("x ", char_, ' ', 'x'));
+        BOOST_TEST(test_delimited("abc ", "abc", ' '));
+        BOOST_TEST(test_delimited("abc,", string, ',', std::string("abc")));
+        BOOST_TEST(test_delimited("abc--", string, "--", std::string("abc")));
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,127 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3/karma/core.hpp>
+#include <boost/spirit/home/x3/karma/char.hpp>
+#include <boost/spirit/home/x3/karma/string.hpp>
+#include <boost/spirit/home/x3/karma/numeric.hpp>
+#include <boost/spirit/home/x3/karma/operator.hpp>
+#include <boost/spirit/home/x3/karma/directive.hpp>
+#include <boost/spirit/home/karma/numeric/real_policies.hpp>
+#include <boost/fusion/include/vector.hpp>
+
+#include <string>
+#include <vector>
+#include "karma_test.hpp"
+
+struct sci_policy : boost::spirit::karma::real_policies<double>
+{
+    static int floatfield(double) { return std::ios_base::scientific; }
+    static unsigned precision(double) { return 1; }
+};
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_delimited;
+    using spirit_test::test_failure;
+    namespace karma = boost::spirit::x3::karma;
+    using karma::int_;
+    using karma::char_;
+    using karma::string;
+    using karma::lit;
+
+    std::vector<int> v = { 1, 2, 3 };
+
+    {   // alignment
+        using karma::left_align;
+        using karma::right_align;
+        using karma::center;
+
+        BOOST_TEST(test("12        |", left_align[int_] << '|', 12));
+        BOOST_TEST(test("12   |", left_align(5)[int_] << '|', 12));
+        BOOST_TEST(test("12***", left_align(5, '*')[int_], 12));
+        BOOST_TEST(test("12--------", left_align(lit('-'))[int_], 12));
+        BOOST_TEST(test("123456", left_align(3)[int_], 123456));
+
+        BOOST_TEST(test("        12", right_align[int_], 12));
+        BOOST_TEST(test("00012", right_align(5, '0')[int_], 12));
+        BOOST_TEST(test("123456", right_align(3)[int_], 123456));
+
+        BOOST_TEST(test("    12    ", center[int_], 12));
+        BOOST_TEST(test("**12**", center(6, '*')[int_], 12));
+        BOOST_TEST(test("  12 ", center(5)[int_], 12));
+
+        BOOST_TEST(test("  a1", right_align(4)['a' << int_], 1));
+        BOOST_TEST(test_failure(right_align(4)[int_(2)], 1));
+    }
+
+    {   // maxwidth
+        using karma::maxwidth;
+
+        BOOST_TEST(test("abc", maxwidth(3)[string], std::string("abcdef")));
+        BOOST_TEST(test("ab", maxwidth(3)[string], std::string("ab")));
+        BOOST_TEST(test("0123456789", maxwidth[string]
+          , std::string("0123456789abc")));
+
+        std::string rest;
+        std::back_insert_iterator<std::string> rest_out(rest);
+        BOOST_TEST(test("abc", maxwidth(3, rest_out)[string]
+          , std::string("abcdef")));
+        BOOST_TEST(rest == "def");
+    }
+
+    {   // buffer, omit, skip
+        using karma::buffer;
+        using karma::omit;
+        using karma::skip;
+
+        BOOST_TEST(test("no", buffer['a' << int_(1)] | "no", 2));
+        BOOST_TEST(test("2", omit[int_] << int_, std::vector<int>{ 1, 2 }));
+        BOOST_TEST(test("x", skip[int_] << 'x'));
+    }
+
+    {   // delimiting
+        using karma::delimit;
+        using karma::verbatim;
+        using karma::no_delimit;
+
+        BOOST_TEST(test("1 2 ", delimit[int_ << int_], v));
+        BOOST_TEST(test("1,c,", delimit(',')[int_ << char_]
+          , boost::fusion::make_vector(1, 'c')));
+        BOOST_TEST(test_delimited("1 abc 2", int_ << verbatim[lit("ab") << 'c']
+          << no_delimit[int_], ' ', v));
+        BOOST_TEST(test_delimited("1,2;", delimit(',')[int_] << int_, ';', v));
+    }
+
+    {   // upper, lower
+        using karma::upper;
+        using karma::lower;
+
+        BOOST_TEST(test("FF ABC TRUE", upper[karma::hex << ' ' << string
+          << ' ' << karma::bool_]
+          , boost::fusion::make_vector(255u, std::string("abc"), true)));
+        BOOST_TEST(test("abcq", lower[lit("ABC") << char_], 'Q'));
+        BOOST_TEST(test("1.0E03", upper[karma::real_generator<double
+          , sci_policy>()], 1000.0));
+    }
+
+    {   // repeat
+        using karma::repeat;
+        using karma::inf;
+
+        BOOST_TEST(test("123", repeat[int_], v));
+        BOOST_TEST(test("12", repeat(2)[int_], v));
+        BOOST_TEST(test_failure(repeat(4)[int_], v));
+        BOOST_TEST(test("12", repeat(1, 2)[int_], v));
+        BOOST_TEST(test("123", repeat(1, inf)[int_], v));
+        BOOST_TEST(test("xxx", repeat(3)['x']));
+    }
+
+    return boost::report_errors();
+}
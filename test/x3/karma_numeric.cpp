@@ -0,0 +1,97 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3/karma/core.hpp>
+#include <boost/spirit/home/x3/karma/char.hpp>
+#include <boost/spirit/home/x3/karma/numeric.hpp>
+#include <boost/spirit/home/karma/numeric/real_policies.hpp>
+#include <boost/optional.hpp>
+
+#include <climits>
+#include "karma_test.hpp"
+
+// a policy of Spirit.Karma for the real generators
+template <typename T>
+struct scientific_policy : boost::spirit::karma::real_policies<T>
+{
+    static int floatfield(T) { return std::ios_base::scientific; }
+};
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_delimited;
+    namespace karma = boost::spirit::x3::karma;
+
+    {   // integers
+        BOOST_TEST(test("0", karma::int_, 0));
+        BOOST_TEST(test("123", karma::int_, 123));
+        BOOST_TEST(test("-123", karma::int_, -123));
+        BOOST_TEST(test("-2147483648", karma::int_, INT_MIN));
+        BOOST_TEST(test("4294967295", karma::uint_, UINT_MAX));
+        BOOST_TEST(test("-9223372036854775808", karma::long_long, LLONG_MIN));
+        BOOST_TEST(test("18446744073709551615", karma::ulong_long, ULLONG_MAX));
+        BOOST_TEST(test("-32768", karma::short_, short(SHRT_MIN)));
+
+        BOOST_TEST(test("ff", karma::hex, 255u));
+        BOOST_TEST(test("777", karma::oct, 511u));
+        BOOST_TEST(test("101", karma::bin, 5u));
+
+        BOOST_TEST(test("123", karma::int_(123)));
+        BOOST_TEST(test("123", karma::int_(123), 123));
+        BOOST_TEST(!test("", karma::int_(123), 124));
+        BOOST_TEST(test("42", karma::lit(42)));
+
+        BOOST_TEST(test("1", karma::int_, boost::optional<int>(1)));
+        BOOST_TEST(!test("", karma::int_, boost::optional<int>()));
+
+        BOOST_TEST(test_delimited("1 ", karma::int_, ' ', 1));
+    }
+
+    {   // signed integers
+        karma::int_generator<int, 10, true> const signed_int = {};
+        BOOST_TEST(test("+1", signed_int, 1));
+        BOOST_TEST(test("-1", signed_int, -1));
+        BOOST_TEST(test(" 0", signed_int, 0));
+    }
+
+    {   // reals use the policies of Spirit.Karma
+        BOOST_TEST(test("0.0", karma::double_, 0.0));
+        BOOST_TEST(test("1.5", karma::double_, 1.5));
+        BOOST_TEST(test("-1.5", karma::double_, -1.5));
+        BOOST_TEST(test("1.5", karma::float_, 1.5f));
+        BOOST_TEST(test("1.5", karma::long_double, 1.5L));
+        BOOST_TEST(test("0.333", karma::double_, 1.0/3));
+        BOOST_TEST(test("nan", karma::double_
+          , std::numeric_limits<double>::quiet_NaN()));
+        BOOST_TEST(test("inf", karma::double_
+          , std::numeric_limits<double>::infinity()));
+
+        karma::real_generator<double, scientific_policy<double>> const
+            scientific = {};
+        BOOST_TEST(test("1.5e03", scientific, 1500.0));
+
+        karma::real_generator<double
+          , boost::spirit::karma::shortest_real_policies<double>> const
+            shortest = {};
+        BOOST_TEST(test("0.1", shortest, 0.1));
+        BOOST_TEST(test("0.30000000000000004", shortest, 0.1 + 0.2));
+    }
+
+    {   // booleans
+        BOOST_TEST(test("true", karma::bool_, true));
+        BOOST_TEST(test("false", karma::bool_, false));
+        BOOST_TEST(test("true", karma::true_));
+        BOOST_TEST(test("false", karma::false_));
+        BOOST_TEST(test("true", karma::true_, true));
+        BOOST_TEST(!test("", karma::true_, false));
+        BOOST_TEST(test("true", karma::bool_(true)));
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,143 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3/karma/core.hpp>
+#include <boost/spirit/home/x3/karma/auxiliary.hpp>
+#include <boost/spirit/home/x3/karma/char.hpp>
+#include <boost/spirit/home/x3/karma/string.hpp>
+#include <boost/spirit/home/x3/karma/numeric.hpp>
+#include <boost/spirit/home/x3/karma/operator.hpp>
+#include <boost/fusion/include/vector.hpp>
+#include <boost/fusion/include/std_pair.hpp>
+#include <boost/optional.hpp>
+#include <boost/variant.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+#include "karma_test.hpp"
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_delimited;
+    using spirit_test::test_failure;
+    namespace karma = boost::spirit::x3::karma;
+    using karma::int_;
+    using karma::char_;
+    using karma::string;
+    using karma::double_;
+    using karma::lit;
+    using karma::eps;
+    using karma::eol;
+
+    std::vector<int> v = { 1, 2, 3 };
+
+    {   // sequence
+        BOOST_TEST(test("ab", lit('a') << 'b'));
+        BOOST_TEST(test("a1", 'a' << int_, 1));
+        BOOST_TEST(test("1a", int_ << 'a', 1));
+        BOOST_TEST(test("1,2.5,c", int_ << ',' << double_ << ',' << char_
+          , boost::fusion::make_vector(1, 2.5, 'c')));
+        BOOST_TEST(test("(1:2)", '(' << int_ << ':' << int_ << ')'
+          , std::make_pair(1, 2)));
+        BOOST_TEST(test("[8]", '[' << int_ << ']'
+          , boost::fusion::make_vector(8)));
+        BOOST_TEST(test("((1,2))", '(' << ('(' << int_ << ',' << int_) << "))"
+          , boost::fusion::make_vector(1, 2)));
+
+        // a container hands its items to the elements in order
+        BOOST_TEST(test("x-y", char_ << '-' << char_, std::string("xy")));
+        BOOST_TEST(test("1 2 3", int_ << ' ' << int_ << ' ' << int_, v));
+        BOOST_TEST(test_failure(int_ << int_, std::vector<int>(1, 1)));
+
+        BOOST_TEST(test_delimited("a 1 ", 'a' << int_, ' ', 1));
+    }
+
+    {   // alternative
+        BOOST_TEST(test("1", int_ | "none", 1));
+        BOOST_TEST(test("none", int_ | "none", boost::optional<int>()));
+        BOOST_TEST(test("a", lit('a') | int_, 1));
+
+        boost::variant<int, std::string> var(std::string("str"));
+        BOOST_TEST(test("str", int_ | string, var));
+        var = 12;
+        BOOST_TEST(test("12", int_ | string, var));
+        BOOST_TEST(test("12", string | int_, var));
+        BOOST_TEST(test_failure(string | double_, var));
+
+        // the output of failing alternatives is discarded
+        BOOST_TEST(test("b", char_('a') | char_('b') | '?', 'b'));
+        BOOST_TEST(test("?", char_('a') | char_('b') | '?', 'z'));
+        BOOST_TEST(test("other", ("one" << int_(1)) | "other", 2));
+    }
+
+    {   // kleene, plus, list
+        BOOST_TEST(test("123", *int_, v));
+        BOOST_TEST(test("", *int_, std::vector<int>()));
+        BOOST_TEST(test("1;2;3;", *(int_ << ';'), v));
+        BOOST_TEST(test("hello", *char_, std::string("hello")));
+        BOOST_TEST(test("13", *(int_(1) | int_(3)), v));   // items are skipped
+
+        BOOST_TEST(test("123", +int_, v));
+        BOOST_TEST(test_failure(+int_, std::vector<int>()));
+
+        BOOST_TEST(test("1, 2, 3", int_ % ", ", v));
+        BOOST_TEST(test("1", int_ % ", ", std::vector<int>(1, 1)));
+        BOOST_TEST(test_failure(int_ % ", ", std::vector<int>()));
+        BOOST_TEST(test("1,3", (int_(1) | int_(3)) % ',', v));
+
+        std::vector<std::pair<int, int>> pairs = { {1, 2}, {3, 4} };
+        BOOST_TEST(test("1:2,3:4", (int_ << ':' << int_) % ',', pairs));
+
+        BOOST_TEST(test_delimited("1 2 3 ", *int_, ' ', v));
+    }
+
+    {   // optional
+        BOOST_TEST(test("(4)", '(' << -int_ << ')', boost::optional<int>(4)));
+        BOOST_TEST(test("()", '(' << -int_ << ')', boost::optional<int>()));
+        BOOST_TEST(test("x", -lit('x')));
+    }
+
+    {   // predicates don't emit any output
+        BOOST_TEST(test("three", &int_(3) << "three" | "other", 3));
+        BOOST_TEST(test("other", &int_(3) << "three" | "other", 4));
+        BOOST_TEST(test("three", !int_(3) << "not three" | "three", 3));
+    }
+
+    {   // eps, eol
+        BOOST_TEST(test("a\n", eps << 'a' << eol));
+        BOOST_TEST(test("a", eps(true) << 'a'));
+        BOOST_TEST(test_failure(eps(false) << 'a', boost::spirit::x3::unused));
+    }
+
+    {   // semantic actions
+        using boost::spirit::x3::_attr;
+        using boost::spirit::x3::_pass;
+
+        int n = 0;
+        auto count = [&n]() { ++n; };
+        BOOST_TEST(test("1", int_[count], 1));
+        BOOST_TEST(n == 1);
+
+        // the action provides the attribute
+        auto provide = [](auto& ctx) { _attr(ctx) = 42; };
+        BOOST_TEST(test("42", int_[provide]));
+
+        // ... or modifies it
+        auto twice = [](auto& ctx) { _attr(ctx) *= 2; };
+        BOOST_TEST(test("1 4", int_ << ' ' << int_[twice]
+          , std::make_pair(1, 2)));
+
+        // ... or fails the generator
+        auto fail = [](auto& ctx) { _pass(ctx) = false; };
+        BOOST_TEST(test("x", int_[fail] | 'x', 1));
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,65 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3/karma/core.hpp>
+#include <boost/spirit/home/x3/karma/char.hpp>
+#include <boost/spirit/home/x3/karma/string.hpp>
+#include <boost/spirit/home/x3/karma/numeric.hpp>
+#include <boost/spirit/home/x3/karma/operator.hpp>
+#include <boost/spirit/home/x3/karma/nonterminal.hpp>
+
+#include <string>
+#include <vector>
+#include "karma_test.hpp"
+#include "karma_rule.hpp"
+
+namespace karma = boost::spirit::x3::karma;
+
+// rules referencing each other, defined in this translation unit
+karma::rule<class ints_class, std::vector<int>> const ints = "ints";
+karma::rule<class item_class, int> const item = "item";
+karma::rule<class greeting_class> const greeting = "greeting";
+
+auto const ints_def = '[' << item % ',' << ']';
+auto const item_def = karma::int_;
+auto const greeting_def = karma::lit("hello");
+
+BOOST_SPIRIT_KARMA_DEFINE(ints, item, greeting);
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_failure;
+
+    {   // basic rules
+        BOOST_TEST(test("hello", greeting));
+        BOOST_TEST(test("hello world", greeting << ' ' << "world"));
+        BOOST_TEST(test("12", item, 12));
+        BOOST_TEST(test("[1,2,3]", ints, std::vector<int>{ 1, 2, 3 }));
+        BOOST_TEST(test_failure(ints, std::vector<int>()));
+    }
+
+    {   // the attribute is converted to the declared one
+        BOOST_TEST(test("65", item, 'A'));
+        BOOST_TEST(test("0", item));
+    }
+
+    {   // rules as elements of other expressions
+        BOOST_TEST(test("1:[2,3]", item << ':' << ints
+          , boost::fusion::make_vector(1, std::vector<int>{ 2, 3 })));
+        BOOST_TEST(test("[1][2]", *('[' << item << ']')
+          , std::vector<int>{ 1, 2 }));
+    }
+
+    {   // a rule defined (and instantiated) in another translation unit
+        client::point pt = { 1, 2 };
+        BOOST_TEST(test("(1, 2)", client::point_, pt));
+    }
+
+    return boost::report_errors();
+}
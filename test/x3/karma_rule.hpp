@@ -0,0 +1,39 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_TEST_KARMA_RULE_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_TEST_KARMA_RULE_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core.hpp>
+#include <boost/spirit/home/x3/karma/nonterminal.hpp>
+#include <boost/fusion/include/adapt_struct.hpp>
+
+#include <iterator>
+#include <string>
+
+namespace client
+{
+    struct point
+    {
+        int x;
+        int y;
+    };
+
+    namespace karma = boost::spirit::x3::karma;
+
+    // point_ is defined in karma_rule_def.cpp only
+    typedef karma::rule<class point_class, point> point_type;
+    point_type const point_ = "point";
+
+    typedef karma::output_iterator<
+        std::back_insert_iterator<std::string>> iterator_type;
+
+    BOOST_SPIRIT_KARMA_DECLARE(point_type);
+}
+
+BOOST_FUSION_ADAPT_STRUCT(client::point, x, y)
+
+#endif
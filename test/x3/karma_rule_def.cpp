@@ -0,0 +1,20 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/spirit/home/x3/karma/char.hpp>
+#include <boost/spirit/home/x3/karma/string.hpp>
+#include <boost/spirit/home/x3/karma/numeric.hpp>
+#include <boost/spirit/home/x3/karma/operator.hpp>
+#include "karma_rule.hpp"
+
+namespace client
+{
+    auto const point__def = '(' << karma::int_ << ", " << karma::int_ << ')';
+
+    BOOST_SPIRIT_KARMA_DEFINE(point_);
+    BOOST_SPIRIT_KARMA_INSTANTIATE(point_type, iterator_type
+      , boost::spirit::x3::unused_type);
+}
@@ -0,0 +1,93 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Hartmut Kaiser
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_KARMA_TEST_OCT_17_2016_0900AM)
+#define BOOST_SPIRIT_X3_KARMA_TEST_OCT_17_2016_0900AM
+
+#include <boost/spirit/home/x3/karma/core/generate.hpp>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+namespace spirit_test
+{
+    template <typename Char>
+    void print_if_failed(char const* func, bool result
+      , std::basic_string<Char> const& generated
+      , std::basic_string<Char> const& expected)
+    {
+        if (!result)
+            std::cerr << "in " << func << ": result is false" << std::endl;
+        else if (generated != expected)
+            std::cerr << "in " << func << ": generated \""
+                << std::string(generated.begin(), generated.end())
+                << "\"" << std::endl;
+    }
+
+    template <typename Char, typename Generator>
+    bool test(Char const* expected, Generator const& g)
+    {
+        std::basic_string<Char> generated;
+        bool result = boost::spirit::x3::karma::generate(
+            std::back_inserter(generated), g);
+
+        print_if_failed("test", result, generated
+          , std::basic_string<Char>(expected));
+        return result && generated == expected;
+    }
+
+    template <typename Char, typename Generator, typename Attribute>
+    bool test(Char const* expected, Generator const& g
+      , Attribute const& attr)
+    {
+        std::basic_string<Char> generated;
+        bool result = boost::spirit::x3::karma::generate(
+            std::back_inserter(generated), g, attr);
+
+        print_if_failed("test", result, generated
+          , std::basic_string<Char>(expected));
+        return result && generated == expected;
+    }
+
+    template <typename Char, typename Generator, typename Delimiter>
+    bool test_delimited(Char const* expected, Generator const& g
+      , Delimiter const& d)
+    {
+        std::basic_string<Char> generated;
+        bool result = boost::spirit::x3::karma::generate_delimited(
+            std::back_inserter(generated), g, d);
+
+        print_if_failed("test_delimited", result, generated
+          , std::basic_string<Char>(expected));
+        return result && generated == expected;
+    }
+
+    template <typename Char, typename Generator, typename Delimiter
+      , typename Attribute>
+    bool test_delimited(Char const* expected, Generator const& g
+      , Delimiter const& d, Attribute const& attr)
+    {
+        std::basic_string<Char> generated;
+        bool result = boost::spirit::x3::karma::generate_delimited(
+            std::back_inserter(generated), g, d, attr);
+
+        print_if_failed("test_delimited", result, generated
+          , std::basic_string<Char>(expected));
+        return result && generated == expected;
+    }
+
+    // the generator fails without any output reaching the sink
+    template <typename Generator, typename Attribute>
+    bool test_failure(Generator const& g, Attribute const& attr)
+    {
+        std::string generated;
+        bool result = boost::spirit::x3::karma::generate(
+            std::back_inserter(generated), g, attr);
+        return !result;
+    }
+}
+
+#endif
@@ -10,6 +10,8 @@
 #include <boost/spirit/home/x3.hpp>
 
 #include <iostream>
+#include <string>
+#include <vector>
 #include "test.hpp"
 
 int
@@ -48,5 +50,33 @@ main()
         BOOST_TEST((test(L"    kimpo", lit(L"kimpo"), space)));
     }
 
+    {   // literals longer than a machine word, contiguous input
+        BOOST_TEST((test("configuration_file", lit("configuration_file"))));
+        BOOST_TEST((!test("configuration_fila", lit("configuration_file"))));
+        BOOST_TEST((!test("configuration_fil", lit("configuration_file"))));
+        BOOST_TEST((!test("xonfiguration_file", lit("configuration_file"))));
+        BOOST_TEST((test("configuration_file = 1", lit("configuration_file"), false)));
+        BOOST_TEST((test(L"configuration_file", lit(L"configuration_file"))));
+        BOOST_TEST((!test(L"configuration_fila", lit(L"configuration_file"))));
+        BOOST_TEST((test("", lit(""))));
+
+        std::string s("configuration_file");
+        BOOST_TEST((test("configuration_file", lit(s))));
+        BOOST_TEST((!test("configuration-file", lit(s))));
+
+        std::string in("configuration_file = 1");
+        std::string::const_iterator first = in.begin();
+        BOOST_TEST((boost::spirit::x3::parse(first, in.cend(), lit("configuration_file"))));
+        BOOST_TEST((first == in.begin() + 18));
+        first = in.begin();
+        BOOST_TEST((!boost::spirit::x3::parse(first, in.cend(), lit("configuration_file = 12"))));
+        BOOST_TEST((first == in.begin()));
+
+        std::vector<char> v(in.begin(), in.end());
+        std::vector<char>::const_iterator vfirst = v.begin();
+        BOOST_TEST((boost::spirit::x3::parse(vfirst, v.cend(), lit(s))));
+        BOOST_TEST((vfirst == v.begin() + 18));
+    }
+
     return boost::report_errors();
 }
@@ -0,0 +1,147 @@
+/*=============================================================================
+    Copyright (c) 2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/variant.hpp>
+#include <string>
+#include <cstring>
+#include <functional>
+#include "test.hpp"
+
+namespace x3 = boost::spirit::x3;
+
+namespace
+{
+    int calls = 0;
+
+    x3::rule<class number, int> const number = "number";
+    auto const number_def =
+        x3::int_[([](auto& ctx) { ++calls; x3::_val(ctx) = x3::_attr(ctx); })];
+    BOOST_SPIRIT_DEFINE(number);
+
+    template <typename Parser, typename Attribute>
+    bool memo_parse(char const* in, Parser const& p, Attribute& attr
+      , x3::memo_table<char const*>& memo)
+    {
+        char const* first = in;
+        char const* const last = in + std::strlen(in);
+        return x3::parse(first, last
+            , x3::with<x3::memo_tag>(std::ref(memo))[p], attr)
+          && first == last;
+    }
+}
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+
+    using x3::memoize;
+    using x3::memo_table;
+    using x3::char_;
+    using x3::int_;
+    using x3::lit;
+    using x3::alpha;
+    using x3::unused_type;
+
+    {   // without a memo table, memoize[] just parses
+        int n = 0;
+        BOOST_TEST((test("x", memoize[char_])));
+        BOOST_TEST((test_attr("123", memoize[int_], n)));
+        BOOST_TEST(n == 123);
+        BOOST_TEST((!test("x", memoize[int_])));
+    }
+
+    {   // a rule, backtracked over, is parsed once
+        char const* in = "123b";
+        memo_table<char const*> memo(in);
+        auto const g = (memoize[number] >> 'a') | (memoize[number] >> 'b');
+
+        calls = 0;
+        int n = 0;
+        BOOST_TEST((memo_parse(in, g, n, memo)));
+        BOOST_TEST(n == 123);
+        BOOST_TEST(calls == 1);
+        BOOST_TEST(memo.stats().lookups == 2);
+        BOOST_TEST(memo.stats().hits == 1);
+        BOOST_TEST(memo.stats().stores == 1);
+
+        // without the table, it is parsed twice
+        calls = 0;
+        BOOST_TEST((test_attr("123b", g, n)));
+        BOOST_TEST(calls == 2);
+    }
+
+    {   // a copied memoize[] shares its results
+        char const* in = "abc?";
+        memo_table<char const*> memo(in);
+        auto const word = memoize[+alpha];
+        auto const g = (word >> '!') | (word >> '?') | (word >> '.');
+
+        std::string s;
+        BOOST_TEST((memo_parse(in, g, s, memo)));
+        BOOST_TEST(s == "abcabc"); // like without memoization
+        BOOST_TEST(memo.stats().hits == 1);
+
+        std::string t;
+        BOOST_TEST((test_attr("abc?", g, t)));
+        BOOST_TEST(s == t);
+    }
+
+    {   // failures are recorded too
+        char const* in = "xyz";
+        memo_table<char const*> memo(in);
+        auto const g = (memoize[number] >> 'a') | (memoize[number] >> 'b') | lit("xyz");
+
+        calls = 0;
+        unused_type u;
+        BOOST_TEST((memo_parse(in, g, u, memo)));
+        BOOST_TEST(memo.stats().hits == 1);
+        BOOST_TEST(!memo.stats().evictions);
+    }
+
+    {   // different memoize[] do not share results
+        char const* in = "12";
+        memo_table<char const*> memo(in);
+        auto const g = (memoize[lit('1')] >> 'x') | (memoize[int_] >> 'x') | (memoize[int_]);
+
+        int n = 0;
+        BOOST_TEST((memo_parse(in, g, n, memo)));
+        BOOST_TEST(n == 12);
+        BOOST_TEST(memo.stats().hits == 0);
+    }
+
+    {   // a full table evicts, results stay right
+        char const* in = "1,2,3,4,5,6,7,8,9;";
+        memo_table<char const*> memo(in, 2);
+        BOOST_TEST(memo.capacity() == 2);
+
+        auto const list = memoize[number] % ',';
+        auto const g = (list >> '.') | (list >> ';');
+
+        std::vector<int> v;
+        BOOST_TEST((memo_parse(in, g, v, memo)));
+        BOOST_TEST(v.size() == 18); // like without memoization
+        BOOST_TEST(memo.stats().evictions != 0);
+
+        memo.clear();
+        BOOST_TEST(memo.stats().lookups == 0);
+    }
+
+    {   // variant attributes
+        char const* in = "42";
+        memo_table<char const*> memo(in);
+        auto const g = (memoize[int_] >> '!') | memoize[int_] | memoize[char_];
+
+        boost::variant<int, char> v;
+        BOOST_TEST((memo_parse(in, g, v, memo)));
+        BOOST_TEST(boost::get<int>(v) == 42);
+    }
+
+    return boost::report_errors();
+}
@@ -143,5 +143,32 @@ main()
         BOOST_TEST(test("Bochi Bochi", no_case[s]));
     }
 
+    {   // literals longer than a machine word
+        using namespace boost::spirit::x3::ascii;
+        BOOST_TEST(test("Configuration_File", no_case[lit("configuration_file")]));
+        BOOST_TEST(test("CONFIGURATION_FILE", no_case[lit("configuration_file")]));
+        BOOST_TEST(test("configuration_file", no_case[lit("CONFIGURATION_FILE")]));
+        BOOST_TEST(!test("CONFIGURATION_FILA", no_case[lit("configuration_file")]));
+        BOOST_TEST(!test("CONFIGURATION_FIL", no_case[lit("configuration_file")]));
+        BOOST_TEST(!test("CONFIGURATIONXFILE", no_case[lit("configuration_file")]));
+        BOOST_TEST(!test("[@^_]{`~\x7f", no_case[lit("{`~\x7f[@^_]")]));
+        BOOST_TEST(!test("{`~\x7f[@^_]", no_case[lit("[@^_]{`~\x7f")]));
+        BOOST_TEST(test("{`~\x7f[@^_]", no_case[lit("{`~\x7f[@^_]")]));
+    }
+
+    {
+        using namespace boost::spirit::x3::iso8859_1;
+        BOOST_TEST(test("BOCHI \xc4\xe4 BOCHI", no_case[lit("bochi \xe4\xe4 bochi")]));
+        BOOST_TEST(!test("BOCHI \xc4\xe5 BOCHI", no_case[lit("bochi \xe4\xe4 bochi")]));
+    }
+
+    {
+        using namespace boost::spirit::x3::standard;
+        BOOST_TEST(test("Select_Distinct", no_case[lit("select_distinct")]));
+        BOOST_TEST(test("SELECT_DISTINCT", no_case["select_distinct"]));
+        BOOST_TEST(!test("SELECT_DISTINCX", no_case["select_distinct"]));
+        BOOST_TEST(!test("select_distinc", no_case["select_distinct"]));
+    }
+
     return boost::report_errors();
 }
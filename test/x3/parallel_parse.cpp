@@ -0,0 +1,164 @@
+/*=============================================================================
+    Copyright (c) 2001-2015 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/core/parallel_parse.hpp>
+#include <boost/spirit/home/x3/support/utility/error_reporting.hpp>
+#include <boost/fusion/include/adapt_struct.hpp>
+#include <boost/fusion/include/std_pair.hpp>
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace x3 = boost::spirit::x3;
+
+typedef std::pair<std::string, int> entry;
+
+struct error_handler_base
+{
+    template <typename Iterator, typename Exception, typename Context>
+    x3::error_handler_result on_error(
+        Iterator& /*first*/, Iterator const& /*last*/
+      , Exception const& x, Context const& context) const
+    {
+        std::string message = "Error! Expecting: " + x.which() + " here:";
+        auto& error_handler = x3::get<x3::error_handler_tag>(context).get();
+        error_handler(x.where(), message);
+        return x3::error_handler_result::fail;
+    }
+};
+
+struct entry_class : error_handler_base {};
+
+x3::rule<entry_class, entry> const entry_ = "entry";
+auto const entry__def = x3::lexeme[+x3::alpha] > '=' > x3::int_;
+BOOST_SPIRIT_DEFINE(entry_);
+
+auto const plain_entry = x3::lexeme[+x3::alpha] >> '=' >> x3::int_;
+
+std::string make_input(int lines)
+{
+    std::string input;
+    for (int i = 0; i < lines; ++i)
+    {
+        input += std::string(1 + i % 7, char('a' + i % 26));
+        input += " = " + std::to_string(i) + "\n";
+    }
+    return input;
+}
+
+int main()
+{
+    int const lines = 20000;
+    std::string const input = make_input(lines);
+
+    {   // the same as a sequential parse, whatever the number of threads
+        std::vector<entry> expected;
+        auto f = input.cbegin();
+        BOOST_TEST(x3::phrase_parse(f, input.cend()
+          , *(plain_entry >> x3::eol), x3::blank, expected));
+        BOOST_TEST(expected.size() == std::size_t(lines));
+
+        for (std::size_t threads : {1, 2, 3, 8})
+        {
+            std::vector<entry> entries;
+            auto first = input.cbegin();
+            BOOST_TEST(x3::parallel_phrase_parse(first, input.cend()
+              , plain_entry, x3::eol, x3::blank, entries, threads));
+            BOOST_TEST(first == input.cend());
+            BOOST_TEST(entries == expected);
+        }
+    }
+
+    {   // no skipper, no final delimiter
+        std::string in;
+        for (int i = 0; i < lines; ++i)
+            in += std::to_string(i) + ';';
+        in.pop_back();
+
+        std::vector<int> values;
+        auto first = in.cbegin();
+        BOOST_TEST(x3::parallel_parse(first, in.cend()
+          , x3::int_, ';', values, 4));
+        BOOST_TEST(first == in.cend());
+        BOOST_TEST(values.size() == std::size_t(lines));
+        BOOST_TEST(values.back() == lines - 1);
+
+        // small inputs are parsed on the calling thread
+        std::string small = "1;2;3";
+        first = small.cbegin();
+        values.clear();
+        BOOST_TEST(x3::parallel_parse(first, small.cend()
+          , x3::int_, ';', values, 4));
+        BOOST_TEST(values.size() == 3);
+    }
+
+    {   // failures stop at the first bad record
+        std::string in = input;
+        std::size_t const bad = in.find("\n", in.size() / 3) + 1;
+        in.insert(bad, "oops\n");
+        std::size_t const worse = in.find("\n", 2 * in.size() / 3) + 1;
+        in.insert(worse, "=\n");
+
+        std::vector<entry> entries;
+        auto first = in.cbegin();
+        BOOST_TEST(!x3::parallel_phrase_parse(first, in.cend()
+          , plain_entry, x3::eol, x3::blank, entries, 4));
+        BOOST_TEST(std::size_t(first - in.cbegin()) == bad);
+        BOOST_TEST(entries.size() == std::size_t(
+            std::count(in.cbegin(), in.cbegin() + bad, '\n')));
+    }
+
+    {   // error handlers report absolute positions
+        std::string in = input;
+        std::size_t const bad = in.find("\n", in.size() / 2) + 1;
+        in.insert(bad, "oops = x\n");
+
+        std::stringstream out;
+        x3::concurrent_error_handler<std::string::const_iterator>
+            error_handler{in.cbegin(), in.cend(), out};
+        auto const parser =
+            x3::with<x3::error_handler_tag>(std::ref(error_handler))[entry_];
+
+        std::vector<entry> entries;
+        auto first = in.cbegin();
+        BOOST_TEST(!x3::parallel_phrase_parse(first, in.cend()
+          , parser, x3::eol, x3::blank, entries, 4));
+
+        std::string const line = std::to_string(
+            std::count(in.cbegin(), in.cbegin() + bad, '\n') + 1);
+        BOOST_TEST_EQ(out.str().substr(0, out.str().find('\n'))
+          , "In line " + line + ":");
+    }
+
+    {   // exceptions are passed on to the caller
+        std::string in = input;
+        std::size_t const bad = in.find("\n", in.size() / 2) + 1;
+        in.insert(bad, "oops\n");
+
+        std::vector<entry> entries;
+        auto first = in.cbegin();
+        bool thrown = false;
+        try
+        {
+            x3::parallel_phrase_parse(first, in.cend()
+              , x3::lexeme[+x3::alpha] > '=' > x3::int_
+              , x3::eol, x3::blank, entries, 4);
+        }
+        catch (x3::expectation_failure<std::string::const_iterator> const& x)
+        {
+            thrown = true;
+            BOOST_TEST(std::size_t(x.where() - in.cbegin()) == bad + 4);
+        }
+        BOOST_TEST(thrown);
+    }
+
+    return boost::report_errors();
+}
@@ -98,5 +98,37 @@ main()
             FP_NAN == fpclassify(d) && signbit(d));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  correctly rounded conversions (results must match the compiler's)
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        using boost::spirit::x3::double_;
+        using boost::spirit::x3::float_;
+        double d;
+        float f;
+
+        BOOST_TEST(test_attr("9.528960577e-238", double_, d));
+        BOOST_TEST(d == 9.528960577e-238);
+        BOOST_TEST(test_attr("-7.02644e-106", double_, d));
+        BOOST_TEST(d == -7.02644e-106);
+        BOOST_TEST(test_attr("5.679e+162", double_, d));
+        BOOST_TEST(d == 5.679e+162);
+        BOOST_TEST(test_attr("7726.278911993e-118", double_, d));
+        BOOST_TEST(d == 7726.278911993e-118);
+        BOOST_TEST(test_attr("5990e29", double_, d));
+        BOOST_TEST(d == 5990e29);
+        BOOST_TEST(test_attr("2.2250738585072011e-308", double_, d));
+        BOOST_TEST(d == 2.2250738585072011e-308);
+        BOOST_TEST(test_attr("4.9406564584124654e-324", double_, d));
+        BOOST_TEST(d == 4.9406564584124654e-324);
+        BOOST_TEST(test_attr("1.7976931348623157e308", double_, d));
+        BOOST_TEST(d == 1.7976931348623157e308);
+
+        BOOST_TEST(test_attr("9.521e-24", float_, f));
+        BOOST_TEST(f == 9.521e-24f);
+        BOOST_TEST(test_attr("-6.052669e+17", float_, f));
+        BOOST_TEST(f == -6.052669e+17f);
+    }
+
     return boost::report_errors();
 }
@@ -44,5 +44,42 @@ main()
         BOOST_TEST(!(test("a bcd", lexeme[lexeme[lit('a') >> 'b' >> skip[lit('c') >> 'd']]], space)));
     }
 
+    { // runs of white space (skipped in bulk from contiguous input)
+        using boost::spirit::x3::standard::space;
+        using boost::spirit::x3::standard::char_;
+        using boost::spirit::x3::phrase_parse;
+
+        std::string blanks;
+        for (int i = 0; i < 37; ++i)
+            blanks += " \t\n\v\f\r"[i % 6];
+
+        for (std::size_t n = 0; n <= blanks.size(); ++n)
+        {
+            std::string const input = blanks.substr(0, n) + "a"
+                + blanks.substr(n) + "b" + blanks.substr(0, n);
+
+            std::string s;
+            BOOST_TEST((test_attr(input.c_str(), *char_, s, space)));
+            BOOST_TEST(s == "ab");
+
+            std::string::const_iterator first = input.begin();
+            s.clear();
+            BOOST_TEST((phrase_parse(first, input.end(), *char_, space, s)));
+            BOOST_TEST(first == input.end());
+            BOOST_TEST(s == "ab");
+        }
+    }
+
+    { // white space and comments
+        auto const comment = lit('#') >> *(char_ - '\n') >> '\n';
+        auto const skipper = space | comment;
+
+        std::string s;
+        BOOST_TEST((test_attr("  a # one\n\t\t b#two\n#three\n          c  "
+          , *alpha, s, skipper)));
+        BOOST_TEST(s == "abc");
+        BOOST_TEST(!(test("a # unterminated", *alpha, skipper)));
+    }
+
     return boost::report_errors();
 }
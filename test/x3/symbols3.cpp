@@ -8,6 +8,8 @@
 
 #include <boost/detail/lightweight_test.hpp>
 #include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/string/perfect_hash.hpp>
+#include <boost/spirit/home/x3/string/tst_map.hpp>
 #include <boost/fusion/include/at.hpp>
 #include <boost/fusion/include/vector.hpp>
 #include <boost/fusion/include/adapt_struct.hpp>
@@ -82,5 +84,81 @@ main()
         BOOST_TEST((test("a3", foo)));
     }
 
+    { // frozen symbols
+        using boost::spirit::x3::symbols_parser;
+        using boost::spirit::x3::perfect_hash;
+        using boost::spirit::x3::no_case;
+        namespace char_encoding = boost::spirit::char_encoding;
+
+        symbols_parser<char_encoding::ascii, int, perfect_hash<char, int>> sym
+        {
+            {"Joel", 1}, {"Ruby", 2}, {"Tenji", 3}, {"Tutit", 4},
+            {"Kim", 5}, {"Joey", 6}, {"Joeyboy", 7}
+        };
+        sym.freeze();
+
+        int i;
+        BOOST_TEST((test_attr("Tutit", sym, i)));
+        BOOST_TEST(i == 4);
+        BOOST_TEST((test_attr("Joeyboy", sym, i)));
+        BOOST_TEST(i == 7);
+        BOOST_TEST((!test("XXX", sym)));
+        BOOST_TEST((test_attr("KIM", no_case[sym], i)));
+        BOOST_TEST(i == 5);
+
+        sym.add("Joeyboyz", 8); // thaws
+        BOOST_TEST((test_attr("Joeyboyz", sym, i)));
+        BOOST_TEST(i == 8);
+        sym.freeze();
+        BOOST_TEST((test_attr("Joeyboyz", sym, i)));
+        BOOST_TEST(i == 8);
+        BOOST_TEST((test_attr("Joeyboy", sym, i, false)));
+        BOOST_TEST(i == 7);
+    }
+
+    { // symbols in a tst_map
+        using boost::spirit::x3::symbols_parser;
+        using boost::spirit::x3::tst_map;
+        using boost::spirit::x3::no_case;
+        namespace char_encoding = boost::spirit::char_encoding;
+
+        symbols_parser<char_encoding::ascii, int, tst_map<char, int>> sym
+        {
+            {"Joel", 1}, {"Ruby", 2}, {"Kim", 3}, {"joeyboy", 4}
+        };
+
+        int i;
+        BOOST_TEST((test_attr("Ruby", sym, i)));
+        BOOST_TEST(i == 2);
+        BOOST_TEST((test_attr("Joelx", sym, i, false)));
+        BOOST_TEST(i == 1);
+        BOOST_TEST((!test("kim", sym)));
+        BOOST_TEST((test_attr("kim", no_case[sym], i)));
+        BOOST_TEST(i == 3);
+        BOOST_TEST((test_attr("JOEYBOY", no_case[sym], i)));
+        BOOST_TEST(i == 4);
+    }
+
+    { // symbols hashed at compile time
+        using boost::spirit::x3::symbols_parser;
+        using boost::spirit::x3::make_perfect_hash;
+        namespace char_encoding = boost::spirit::char_encoding;
+
+        static constexpr std::pair<char const*, int> keywords[] = {
+            {"if", 1}, {"else", 2}, {"while", 3}, {"return", 4}
+        };
+        constexpr auto table = make_perfect_hash(keywords);
+
+        symbols_parser<char_encoding::standard, int
+          , std::remove_const_t<decltype(table)>> const sym(table);
+
+        int i;
+        BOOST_TEST((test_attr("while", sym, i)));
+        BOOST_TEST(i == 3);
+        BOOST_TEST((test_attr("return", sym, i)));
+        BOOST_TEST(i == 4);
+        BOOST_TEST((!test("for", sym)));
+    }
+
     return boost::report_errors();
 }
@@ -0,0 +1,85 @@
+/*=============================================================================
+    Copyright (c) 2015 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+// no displacement is ever found: the frozen lookups scan their keys
+#define BOOST_SPIRIT_PERFECT_HASH_MAX_DISPLACEMENT 0
+
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/string/perfect_hash.hpp>
+
+#include <utility>
+#include "test.hpp"
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+    using boost::spirit::x3::symbols_parser;
+    namespace char_encoding = boost::spirit::char_encoding;
+
+    {   // the hash and displace search gives up
+        using boost::spirit::detail::perfect_hash_index;
+
+        boost::uint64_t const hashes[] = { 1, 2, 3 };
+        perfect_hash_index order[3] = {}, slots[4] = {}, scratch[20] = {};
+        boost::uint32_t disp[3] = {};
+        boost::spirit::detail::perfect_hash_shape const shape =
+            boost::spirit::detail::build_perfect_hash(
+                hashes, 3, order, slots, disp, scratch);
+        BOOST_TEST(shape.slots == 0 && shape.buckets == 0);
+    }
+
+    { // frozen symbols
+        using boost::spirit::x3::perfect_hash;
+        using boost::spirit::x3::no_case;
+
+        symbols_parser<char_encoding::ascii, int, perfect_hash<char, int>> sym
+        {
+            {"Joel", 1}, {"Ruby", 2}, {"Tenji", 3}, {"Tutit", 4},
+            {"Kim", 5}, {"Joey", 6}, {"Joeyboy", 7}
+        };
+        sym.freeze();
+
+        int i;
+        BOOST_TEST((test_attr("Tutit", sym, i)));
+        BOOST_TEST(i == 4);
+        BOOST_TEST((test_attr("Joeyboy", sym, i)));
+        BOOST_TEST(i == 7);
+        BOOST_TEST((test_attr("Joeyboyz", sym, i, false)));
+        BOOST_TEST(i == 7);
+        BOOST_TEST((!test("XXX", sym)));
+        BOOST_TEST((test_attr("KIM", no_case[sym], i)));
+        BOOST_TEST(i == 5);
+
+        int count = 0;
+        sym.for_each([&](std::string const&, int) { ++count; });
+        BOOST_TEST(count == 7);
+    }
+
+    { // symbols hashed at compile time
+        using boost::spirit::x3::make_perfect_hash;
+
+        static constexpr std::pair<char const*, int> keywords[] = {
+            {"if", 1}, {"else", 2}, {"while", 3}, {"return", 4}
+        };
+        constexpr auto table = make_perfect_hash(keywords);
+
+        symbols_parser<char_encoding::standard, int
+          , std::remove_const_t<decltype(table)>> const sym(table);
+
+        int i;
+        BOOST_TEST((test_attr("while", sym, i)));
+        BOOST_TEST(i == 3);
+        BOOST_TEST((test_attr("if", sym, i)));
+        BOOST_TEST(i == 1);
+        BOOST_TEST((!test("for", sym)));
+    }
+
+    return boost::report_errors();
+}
@@ -7,9 +7,13 @@
 #include <boost/detail/lightweight_test.hpp>
 #include <boost/spirit/home/x3/string/tst.hpp>
 #include <boost/spirit/home/x3/string/tst_map.hpp>
+#include <boost/spirit/home/x3/string/flat_trie.hpp>
+#include <boost/spirit/home/x3/string/perfect_hash.hpp>
 #include <boost/spirit/home/x3/support/no_case.hpp>
 #include <boost/spirit/home/support/char_encoding/standard.hpp>
 #include <boost/spirit/home/support/char_encoding/standard_wide.hpp>
+#include <boost/spirit/home/support/char_encoding/ascii.hpp>
+#include <boost/spirit/home/support/char_encoding/iso8859_1.hpp>
 #include <string>
 #include <cctype>
 #include <iostream>
@@ -66,6 +70,25 @@ namespace
         std::cout << ']' << std::endl;
     }
 
+    // a Lookup frozen after each change
+    template <typename Lookup>
+    struct frozen : Lookup
+    {
+        template <typename Iterator>
+        void add(Iterator first, Iterator last, int data)
+        {
+            Lookup::add(first, last, data);
+            this->freeze();
+        }
+
+        template <typename Iterator>
+        void remove(Iterator first, Iterator last)
+        {
+            Lookup::remove(first, last);
+            this->freeze();
+        }
+    };
+
 }
 
 boost::spirit::x3::case_compare<boost::spirit::char_encoding::standard> ncomp;
@@ -325,13 +348,127 @@ void tests()
     }
 }
 
+void perfect_hash_tests()
+{
+    using boost::spirit::x3::perfect_hash;
+    namespace x3 = boost::spirit::x3;
+    namespace char_encoding = boost::spirit::char_encoding;
+
+    x3::no_case_compare<char_encoding::ascii> nc_acomp;
+    x3::no_case_compare<char_encoding::iso8859_1> nc_icomp;
+
+    { // case insensitive lookup by hash
+        frozen<perfect_hash<char, int> > lookup;
+        add(lookup, "pineapple", 1);
+        add(lookup, "Orange", 2);
+        add(lookup, "BANANA", 3);
+        add(lookup, "applepie", 4);
+        add(lookup, "apple", 5);
+
+        docheck(lookup, nc_acomp, "PineApple", true, 9, 1);
+        docheck(lookup, nc_acomp, "orange", true, 6, 2);
+        docheck(lookup, nc_acomp, "Bananarama", true, 6, 3);
+        docheck(lookup, nc_acomp, "APPLEPI", true, 5, 5);
+        docheck(lookup, nc_acomp, "ApplePiez", true, 8, 4);
+        docheck(lookup, nc_acomp, "appl", false);
+        docheck(lookup, ncomp, "Orange", true, 6, 2);
+        docheck(lookup, ncomp, "orange", false);
+        docheck(lookup, nc_icomp, "bAnAnA", true, 6, 3);
+    }
+
+    { // keys differing in case only share a slot
+        frozen<perfect_hash<char, int> > lookup;
+        add(lookup, "if", 1);
+        add(lookup, "IF", 2);
+        add(lookup, "If", 3);
+        add(lookup, "ifdef", 4);
+
+        docheck(lookup, ncomp, "if", true, 2, 1);
+        docheck(lookup, ncomp, "IF", true, 2, 2);
+        docheck(lookup, ncomp, "If", true, 2, 3);
+        docheck(lookup, ncomp, "iF", false);
+        docheck(lookup, ncomp, "ifdef", true, 5, 4);
+        docheck(lookup, ncomp, "IFdef", true, 2, 2);
+        docheck(lookup, nc_acomp, "IFDEF", true, 5, 4);
+    }
+
+    { // long keys
+        frozen<perfect_hash<char, int> > lookup;
+        std::string const key(100, 'x');
+        add(lookup, key.c_str(), 1);
+        add(lookup, (key + "yy").c_str(), 2);
+        add(lookup, "x", 3);
+
+        docheck(lookup, ncomp, (key + "y").c_str(), true, 100, 1);
+        docheck(lookup, ncomp, (key + "yyy").c_str(), true, 102, 2);
+        docheck(lookup, ncomp, key.substr(0, 99).c_str(), true, 1, 3);
+    }
+
+    { // many keys, thawed and frozen again
+        perfect_hash<char, int> lookup;
+        for (int i = 0; i != 1000; ++i)
+        {
+            std::string const key = "key" + std::to_string(i * 7919);
+            add(lookup, key.c_str(), i);
+        }
+        lookup.freeze();
+        BOOST_TEST(lookup.is_frozen());
+        for (int i = 0; i != 1000; ++i)
+        {
+            std::string const key = "key" + std::to_string(i * 7919);
+            docheck(lookup, ncomp, (key + " ").c_str(), true, int(key.size()), i);
+        }
+        docheck(lookup, ncomp, "key1", false);
+
+        remove(lookup, "key0");
+        BOOST_TEST(!lookup.is_frozen());
+        docheck(lookup, ncomp, "key0", false);
+        docheck(lookup, ncomp, "key7919", true, 7, 1);
+        lookup.freeze();
+        docheck(lookup, ncomp, "key0", false);
+        docheck(lookup, ncomp, "key7919", true, 7, 1);
+
+        int n = 0;
+        lookup.for_each([&](std::string const&, int) { ++n; });
+        BOOST_TEST(n == 999);
+    }
+
+    { // built at compile time
+        static constexpr std::pair<char const*, int> keywords[] = {
+            { "if", 1 }, { "else", 2 }, { "elseif", 3 }, { "while", 4 }
+          , { "for", 5 }, { "return", 6 }, { "IF", 7 }, { "if", 8 }
+        };
+        constexpr auto lookup = x3::make_perfect_hash(keywords);
+        static_assert(lookup.entries() == 8, "");
+        static_assert(lookup.base() == 2, "");    // "if", "for" -> "fo"
+        static_assert(lookup.levels() == 2, "");  // "elseif" -> "else"
+        static_assert(lookup.slots() == 8, "");   // "el", "wh" and "re" too
+
+        docheck(lookup, ncomp, "if", true, 2, 1); // the first "if" wins
+        docheck(lookup, ncomp, "IF", true, 2, 7);
+        docheck(lookup, ncomp, "elsewhere", true, 4, 2);
+        docheck(lookup, ncomp, "elseif", true, 6, 3);
+        docheck(lookup, ncomp, "whiles", true, 5, 4);
+        docheck(lookup, ncomp, "fo", false);
+        docheck(lookup, ncomp, "", false);
+        docheck(lookup, nc_acomp, "RETURN", true, 6, 6);
+        docheck(lookup, nc_acomp, "If", true, 2, 1);
+        docheck(lookup, nc_ncomp, "ElseIf", true, 6, 3);
+    }
+}
+
 int main()
 {
     using boost::spirit::x3::tst;
     using boost::spirit::x3::tst_map;
+    using boost::spirit::x3::perfect_hash;
+    using boost::spirit::x3::flat_trie;
 
     tests<tst<char, int>, tst<wchar_t, int> >();
-//~    tests<tst_map<char, int>, tst_map<wchar_t, int> >();
+    tests<tst_map<char, int>, tst_map<wchar_t, int> >();
+    tests<flat_trie<char, int>, flat_trie<wchar_t, int> >();
+    tests<frozen<perfect_hash<char, int> >, frozen<perfect_hash<wchar_t, int> > >();
+    perfect_hash_tests();
 
     return boost::report_errors();
 }
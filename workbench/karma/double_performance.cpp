@@ -7,7 +7,10 @@
 #include <boost/config/warning_disable.hpp>
 #include <boost/spirit/include/karma.hpp>
 #include <boost/format.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
 
+#include <cstring>
 #include <iostream>
 
 #include "../high_resolution_timer.hpp"
@@ -105,6 +108,96 @@ void format_performance_string()
 //     std::cout << generated << std::endl;
 }
 
+void format_performance_shortest()
+{
+    using boost::spirit::karma::generate;
+    using boost::spirit::karma::real_generator;
+    using boost::spirit::karma::shortest_real_policies;
+
+    //[karma_double_performance_shortest
+    typedef real_generator<double, shortest_real_policies<double> > 
+        shortest_type;
+    shortest_type const shortest = shortest_type();
+    char buffer[256];
+    //<-
+    util::high_resolution_timer t;
+    //->
+    for (int i = 0; i < NUMITERATIONS; ++i) {
+        char *p = buffer;
+        generate(p, shortest, 12345.12345);
+        *p = '\0';
+    }
+    //]
+
+    std::cout << "karma (shortest):\t" << t.elapsed() << std::endl;
+//     std::cout << buffer << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Generating all digits needed to read back the same number, the current 
+// conversion can't do that as it is limited to 16 digits.
+#define NUMVALUES 1000
+
+void format_performance_shortest_values(double const* values)
+{
+    using boost::spirit::karma::generate;
+    using boost::spirit::karma::real_generator;
+    using boost::spirit::karma::shortest_real_policies;
+
+    typedef real_generator<double, shortest_real_policies<double> > 
+        shortest_type;
+    shortest_type const shortest = shortest_type();
+    char buffer[256];
+    util::high_resolution_timer t;
+    for (int i = 0; i < NUMITERATIONS; ++i) {
+        char *p = buffer;
+        generate(p, shortest, values[i % NUMVALUES]);
+        *p = '\0';
+    }
+
+    std::cout << "karma (shortest, values):\t" << t.elapsed() << std::endl;
+}
+
+template <typename T>
+struct precision16_policy : boost::spirit::karma::real_policies<T>
+{
+    static int floatfield(T) 
+    { 
+        return boost::spirit::karma::real_policies<T>::fmtflags::scientific; 
+    }
+    static unsigned precision(T) { return 16; }
+};
+
+void format_performance_precision16_values(double const* values)
+{
+    using boost::spirit::karma::generate;
+    using boost::spirit::karma::real_generator;
+
+    typedef real_generator<double, precision16_policy<double> > 
+        precision16_type;
+    precision16_type const precision16 = precision16_type();
+    char buffer[256];
+    util::high_resolution_timer t;
+    for (int i = 0; i < NUMITERATIONS; ++i) {
+        char *p = buffer;
+        generate(p, precision16, values[i % NUMVALUES]);
+        *p = '\0';
+    }
+
+    std::cout << "karma (16 digits, values):\t" << t.elapsed() << std::endl;
+}
+
+void format_performance_sprintf_values(double const* values)
+{
+    char buffer[256];
+    util::high_resolution_timer t;
+    for (int i = 0; i < NUMITERATIONS; ++i) {
+        sprintf(buffer, "%.17g", values[i % NUMVALUES]);
+    }
+
+    std::cout << "sprintf (%.17g, values):\t" << t.elapsed() << std::endl;
+}
+
 // Boost.Format  
 void format_performance_boost_format()
 {
@@ -164,6 +257,21 @@ int main()
     format_performance_string();
     format_performance_rule();
     format_performance_direct();
+    format_performance_shortest();
+
+    // values with random bits spread over the whole range
+    double values[NUMVALUES];
+    boost::uint64_t bits = 0x123456789abcdefULL;
+    for (int i = 0; i < NUMVALUES; /**/) {
+        bits = bits * 6364136223846793005ULL + 1442695040888963407ULL;
+        std::memcpy(&values[i], &bits, sizeof(double));
+        if ((boost::math::isfinite)(values[i]))
+            ++i;
+    }
+
+    format_performance_sprintf_values(values);
+    format_performance_precision16_values(values);
+    format_performance_shortest_values(values);
     return 0;
 }
 
@@ -4,6 +4,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <climits>
+#include <cstdio>
 #include <cstdlib>
 
 #include <iostream> 
@@ -124,6 +125,93 @@ int main()
         cout << "int_:\t\t" << t.elapsed() << " [s]" << flush << endl;
     }
 
+    // test the int_inserter directly
+    {
+        std::string str;
+        util::high_resolution_timer t;
+
+        char buffer[65]; // we don't expect more than 64 bytes to be generated here
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            char *ptr = buffer;
+            unsigned int n = traits::get_absolute_value(v[i]);
+            karma::sign_inserter::call(ptr, 0 == n, v[i] < 0, false);
+            karma::int_inserter<10>::call(ptr, n);
+            *ptr = '\0';
+            str = buffer;      // compensate for string ops in other benchmarks
+        }
+
+        cout << "int_inserter:\t" << t.elapsed() << " [s]" << flush << endl;
+    }
+
+    // test the generic digit loop, which is used for types other than the 
+    // built-in integers
+    {
+        std::string str;
+        util::high_resolution_timer t;
+
+        char buffer[65]; // we don't expect more than 64 bytes to be generated here
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            char *ptr = buffer;
+            unsigned int n = traits::get_absolute_value(v[i]);
+            karma::sign_inserter::call(ptr, 0 == n, v[i] < 0, false);
+            karma::int_inserter<10>::call(ptr, n, n, 0);
+            *ptr = '\0';
+            str = buffer;      // compensate for string ops in other benchmarks
+        }
+
+        cout << "digit loop:\t" << t.elapsed() << " [s]" << flush << endl;
+    }
+
+    // test hexadecimal output
+    {
+        std::string str;
+        util::high_resolution_timer t;
+
+        char buffer[65]; // we don't expect more than 64 bytes to be generated here
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            sprintf(buffer, "%x", unsigned(v[i]));
+            str = buffer;      // compensate for string ops in other benchmarks
+        }
+
+        cout << "sprintf (hex):\t" << t.elapsed() << " [s]" << flush << endl;
+    }
+
+    {
+        std::string str;
+        util::high_resolution_timer t;
+
+        char buffer[65]; // we don't expect more than 64 bytes to be generated here
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            char *ptr = buffer;
+            karma::generate(ptr, karma::hex, unsigned(v[i]));
+            *ptr = '\0';
+            str = buffer;      // compensate for string ops in other benchmarks
+        }
+
+        cout << "hex:\t\t" << t.elapsed() << " [s]" << flush << endl;
+    }
+
+    {
+        std::string str;
+        util::high_resolution_timer t;
+
+        char buffer[65]; // we don't expect more than 64 bytes to be generated here
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            char *ptr = buffer;
+            unsigned int n = unsigned(v[i]);
+            karma::int_inserter<16>::call(ptr, n, n, 0);
+            *ptr = '\0';
+            str = buffer;      // compensate for string ops in other benchmarks
+        }
+
+        cout << "digit loop (hex):\t" << t.elapsed() << " [s]" << flush << endl;
+    }
+
     return 0;
 }
 
@@ -0,0 +1,198 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Measure the time needed to build (and minimise) the DFAs of a lexer, on
+//  one thread and on all cores, and report the memory footprint of the
+//  resulting tables: the state machine built by the generator, the compact
+//  tables used by lexertl::lexer, and the tables a lazy DFA starts with.
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/home/support/detail/lexer/generator.hpp>
+#include <boost/spirit/home/support/detail/lexer/lazy_state_machine.hpp>
+#include <boost/spirit/home/support/detail/lexer/rules.hpp>
+#include <boost/spirit/home/support/detail/lexer/state_machine.hpp>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "../high_resolution_timer.hpp"
+#include "word_count_tokens.hpp"
+
+namespace lex = boost::spirit::lex;
+
+typedef boost::lexer::generator generator;
+
+#define MAX_ITERATION 10
+
+///////////////////////////////////////////////////////////////////////////////
+//  A larger rule set: several lexer states, each with a couple of hundred
+//  keywords next to identifiers, numbers, strings and comments.
+void keyword_rules(boost::lexer::rules& rules)
+{
+    static char const* const states[] = { "INITIAL", "A", "B", "C" };
+    std::size_t const state_count = sizeof(states) / sizeof(states[0]);
+
+    for (std::size_t s = 1; s != state_count; ++s)
+        rules.add_state(states[s]);
+
+    std::srand(0);
+    std::size_t id = 1;
+    for (std::size_t s = 0; s != state_count; ++s)
+    {
+        for (std::size_t k = 0; k != 200; ++k)
+        {
+            std::string keyword;
+            std::size_t length = 3 + std::rand() % 8;
+            for (std::size_t i = 0; i != length; ++i)
+                keyword += static_cast<char>('a' + std::rand() % 26);
+            rules.add(states[s], keyword.c_str(), id++, ".");
+        }
+        rules.add(states[s], "[a-zA-Z_][a-zA-Z0-9_]*", id++, ".");
+        rules.add(states[s], "[0-9]+(\\.[0-9]*)?([eE][-+]?[0-9]+)?", id++, ".");
+        rules.add(states[s], "\\\"([^\\\"\\\\]|\\\\.)*\\\"", id++, ".");
+        rules.add(states[s], "\\/\\*([^*]|\\*+[^*/])*\\*+\\/", id++, ".");
+        rules.add(states[s], "[ \\t\\n]+", id++, ".");
+        rules.add(states[s], "[-+*/=<>!&|^~%]=?", id++
+          , states[(s + 1) % state_count]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the number of DFA states and the size in bytes of the state machine tables
+void footprint(boost::lexer::state_machine const& sm, std::size_t& states
+  , std::size_t& bytes)
+{
+    boost::lexer::detail::internals const& internals = sm.data();
+
+    states = bytes = 0;
+    for (std::size_t i = 0; i != internals._dfa->size(); ++i)
+    {
+        // the first row of every DFA is the jam state
+        states += internals._dfa[i]->size() / internals._dfa_alphabet[i] - 1;
+        bytes += (internals._lookup[i]->size() + internals._dfa[i]->size())
+            * sizeof(std::size_t);
+    }
+}
+
+std::size_t footprint(
+    lex::lexertl::basic_compact_state_machine<char> const& sm)
+{
+    std::size_t bytes = 0;
+    for (std::size_t i = 0; i != sm.size(); ++i)
+        bytes += sm[i].size();
+    return bytes;
+}
+
+void report(char const* name, double elapsed)
+{
+    std::cout << "  " << std::left << std::setw(28) << name
+              << (elapsed * 1000.) / MAX_ITERATION << " [ms]" << std::endl;
+}
+
+void report(char const* name, std::size_t states, std::size_t bytes)
+{
+    std::cout << "  " << std::left << std::setw(28) << name
+              << states << " states\t" << bytes << " [bytes]" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void measure(char const* name, boost::lexer::rules const& rules)
+{
+    std::cout << name << ":" << std::endl;
+
+    {
+        util::high_resolution_timer t;
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            boost::lexer::state_machine sm;
+            generator::build(rules, sm, 1);
+        }
+        report("build (1 thread)", t.elapsed());
+    }
+    {
+        util::high_resolution_timer t;
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            boost::lexer::state_machine sm;
+            generator::build(rules, sm, 0);
+        }
+        report("build (all cores)", t.elapsed());
+    }
+    {
+        double elapsed = 0;
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            boost::lexer::state_machine sm;
+            generator::build(rules, sm, 1);
+            util::high_resolution_timer t;
+            generator::minimise(sm, 1);
+            elapsed += t.elapsed();
+        }
+        report("minimise (1 thread)", elapsed);
+    }
+    {
+        double elapsed = 0;
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            boost::lexer::state_machine sm;
+            generator::build(rules, sm, 1);
+            util::high_resolution_timer t;
+            generator::minimise(sm, 0);
+            elapsed += t.elapsed();
+        }
+        report("minimise (all cores)", elapsed);
+    }
+    {
+        util::high_resolution_timer t;
+        for (int i = 0; i < MAX_ITERATION; ++i)
+        {
+            boost::lexer::basic_lazy_state_machine<char> sm;
+            sm.build(rules);
+        }
+        report("lazy dfa (start states)", t.elapsed());
+    }
+
+    boost::lexer::state_machine built;
+    generator::build(rules, built, 1);
+
+    std::size_t states = 0, bytes = 0;
+    footprint(built, states, bytes);
+    report("state machine", states, bytes);
+
+    boost::lexer::state_machine minimised;
+    generator::build(rules, minimised, 1);
+    generator::minimise(minimised, 1);
+    footprint(minimised, states, bytes);
+    report("minimised state machine", states, bytes);
+
+    // the dynamic lexer doesn't minimise its DFAs
+    footprint(built, states, bytes);
+    lex::lexertl::basic_compact_state_machine<char> compact(built);
+    report("compact tables", states, footprint(compact));
+
+    boost::lexer::basic_lazy_state_machine<char> lazy;
+    lazy.build(rules);
+    states = 0;
+    for (std::size_t i = 0; i != lazy.size(); ++i)
+        states += lazy.states(i);
+    std::cout << "  " << std::left << std::setw(28) << "lazy dfa (start states)"
+              << states << " states" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    word_count_tokens<lex::lexertl::lexer<> > word_count;
+    measure("word count", word_count.get_rules());
+
+    boost::lexer::rules rules;
+    keyword_rules(rules);
+    measure("keywords", rules);
+
+    return 0;
+}
@@ -0,0 +1,240 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Measure the number of tokens and bytes per second the lexertl based lexers
+//  recognize: the dynamic lexer using the different token types, the batch
+//  tokenizer, and the static table, switch and threaded lexers generated by
+//  word_count_generate.cpp. The stored token runs keep all tokens of the
+//  input (as a multi_pass iterator buffering them for backtracking does)
+//  and access their values afterwards.
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_lexertl_position_token.hpp>
+#include <boost/spirit/include/lex_lexertl_compact_token.hpp>
+#include <boost/spirit/include/lex_static_lexertl.hpp>
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../high_resolution_timer.hpp"
+#include "word_count_tokens.hpp"
+#include "word_count_static.hpp"
+#include "word_count_switch.hpp"
+#include "word_count_threaded.hpp"
+
+namespace lex = boost::spirit::lex;
+namespace mpl = boost::mpl;
+
+#define INPUT_SIZE 4000000
+#define MAX_ITERATION 10
+
+typedef char const* base_iterator;
+
+///////////////////////////////////////////////////////////////////////////////
+void report(char const* name, double elapsed, std::size_t tokens
+  , std::size_t bytes)
+{
+    std::cout << std::left << std::setw(32) << name << elapsed << " [s]\t"
+              << (tokens / elapsed) / 1e6 << " [Mtokens/s]\t"
+              << (bytes / elapsed) / (1024 * 1024) << " [MB/s]"
+              << std::endl;
+}
+
+// the number of tokens recognized by the token iterator of the given lexer
+template <typename Lexer>
+std::size_t tokenize(Lexer const& lexer, std::string const& input)
+{
+    std::size_t count = 0;
+    base_iterator first = input.c_str();
+    typename Lexer::iterator_type end = lexer.end();
+    for (typename Lexer::iterator_type it =
+            lexer.begin(first, first + input.size());
+         it != end && token_is_valid(*it); ++it)
+    {
+        ++count;
+    }
+    return count;
+}
+
+// the same, using the batch tokenizer
+template <typename Lexer>
+std::size_t tokenize_batch(Lexer const& lexer, std::string const& input)
+{
+    typedef typename Lexer::batch_tokenizer_type tokenizer_type;
+    typedef typename tokenizer_type::token_type token_type;
+
+    std::size_t const batch_size = 256;
+    token_type tokens[batch_size];
+
+    std::size_t count = 0;
+    base_iterator first = input.c_str();
+    tokenizer_type tokenizer = lexer.batch(first, first + input.size());
+    for (;;)
+    {
+        std::size_t n = tokenizer.next(tokens, batch_size);
+        if (n != 0 && !token_is_valid(tokens[n-1]))
+            return count + n - 1;
+        count += n;
+        if (n < batch_size)
+            break;
+    }
+    return count;
+}
+
+// store all tokens, then access the values of the stored tokens
+template <typename Lexer>
+std::size_t tokenize_stored(Lexer const& lexer, std::string const& input)
+{
+    typedef typename Lexer::token_type token_type;
+
+    std::vector<token_type> tokens;
+    base_iterator first = input.c_str();
+    typename Lexer::iterator_type end = lexer.end();
+    for (typename Lexer::iterator_type it =
+            lexer.begin(first, first + input.size());
+         it != end && token_is_valid(*it); ++it)
+    {
+        tokens.push_back(*it);
+    }
+
+    std::size_t length = 0;
+    for (std::size_t i = 0; i != tokens.size(); ++i)
+    {
+        boost::iterator_range<base_iterator> value;
+        boost::spirit::traits::assign_to(tokens[i], value);
+        length += value.size();
+    }
+    if (length > input.size())
+    {
+        std::cerr << "unexpected length of the token values" << std::endl;
+        std::exit(-1);
+    }
+    return tokens.size();
+}
+
+template <typename Lexer>
+void run(char const* name, Lexer const& lexer, std::string const& input
+  , std::size_t (*f)(Lexer const&, std::string const&))
+{
+    // the first run builds the DFA (if any) and warms up the caches
+    std::size_t tokens = f(lexer, input);
+
+    util::high_resolution_timer t;
+    for (int i = 0; i < MAX_ITERATION; ++i)
+    {
+        if (f(lexer, input) != tokens)
+        {
+            std::cerr << name << ": unexpected number of tokens" << std::endl;
+            std::exit(-1);
+        }
+    }
+    report(name, t.elapsed(), tokens * MAX_ITERATION
+      , input.size() * MAX_ITERATION);
+}
+
+template <typename Lexer>
+void measure(char const* name, std::string const& input
+  , unsigned int flags = 0)
+{
+    typedef word_count_tokens<Lexer> tokens_type;
+    run(name, tokens_type(flags), input, &tokenize<tokens_type>);
+}
+
+template <typename Lexer>
+void measure_batch(char const* name, std::string const& input)
+{
+    typedef word_count_tokens<Lexer> tokens_type;
+    run(name, tokens_type(), input, &tokenize_batch<tokens_type>);
+}
+
+template <typename Lexer>
+void measure_stored(char const* name, std::string const& input)
+{
+    typedef word_count_tokens<Lexer> tokens_type;
+    tokens_type lexer;
+    run(name, lexer, input, &tokenize_stored<tokens_type>);
+
+    std::size_t tokens = tokenize<tokens_type>(lexer, input);
+    std::cout << std::left << std::setw(32) << ""
+              << (tokens * sizeof(typename tokens_type::token_type))
+                    / (1024 * 1024)
+              << " [MB] for " << tokens << " stored tokens" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::string const input = generate_input(INPUT_SIZE);
+
+    std::cout << "Tokenizing " << input.size() << " bytes of input "
+              << MAX_ITERATION << " times." << std::endl;
+
+    typedef lex::lexertl::token<
+        base_iterator, mpl::vector<>, mpl::false_
+    > token_type;
+    typedef lex::lexertl::position_token<
+        base_iterator, mpl::vector<>, mpl::false_
+    > position_token_type;
+    typedef lex::lexertl::compact_token<
+        base_iterator, mpl::false_
+    > compact_token_type;
+
+    std::cout << "sizeof(token):\t\t" << sizeof(token_type) << "\n"
+              << "sizeof(position_token):\t" << sizeof(position_token_type)
+              << "\n"
+              << "sizeof(compact_token):\t" << sizeof(compact_token_type)
+              << std::endl;
+
+    // the dynamic lexer, the DFA is built at runtime
+    measure<lex::lexertl::lexer<token_type> >("dynamic/token", input);
+    measure<lex::lexertl::lexer<position_token_type> >(
+        "dynamic/position_token", input);
+    {
+        lex::lexertl::compact_token_buffer<base_iterator> buffer(
+            input.c_str());
+        measure<lex::lexertl::lexer<compact_token_type> >(
+            "dynamic/compact_token", input);
+    }
+
+    // the tokens are kept in memory
+    measure_stored<lex::lexertl::lexer<token_type> >("stored/token", input);
+    measure_stored<lex::lexertl::lexer<position_token_type> >(
+        "stored/position_token", input);
+    {
+        lex::lexertl::compact_token_buffer<base_iterator> buffer(
+            input.c_str());
+        measure_stored<lex::lexertl::lexer<compact_token_type> >(
+            "stored/compact_token", input);
+    }
+    measure_batch<lex::lexertl::lexer<token_type> >("dynamic/batch", input);
+    measure<lex::lexertl::lexer<token_type> >(
+        "dynamic/lazy dfa", input, lex::match_flags::match_lazy_dfa);
+
+    // the static lexers generated by word_count_generate.cpp
+    measure<lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_wc>
+        >("static table/token", input);
+    measure<lex::lexertl::static_lexer<
+            position_token_type, lex::lexertl::static_::lexer_wc>
+        >("static table/position_token", input);
+    measure<lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_wcs>
+        >("static switch/token", input);
+    measure<lex::lexertl::static_lexer<
+            position_token_type, lex::lexertl::static_::lexer_wcs>
+        >("static switch/position_token", input);
+    measure<lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_wct>
+        >("static threaded/token", input);
+    measure<lex::lexertl::static_lexer<
+            position_token_type, lex::lexertl::static_::lexer_wct>
+        >("static threaded/position_token", input);
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Measure tokenize_and_parse() counting the characters, words and lines of
+//  the input (as example/lex/static_lexer/word_count_static.cpp does) using
+//  the dynamic and the static lexers, and compare it against the equivalent
+//  flex based scanner (see word_count_flex.cpp). The flex scanner reads its
+//  input from a file, the lexers from memory.
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/spirit/include/qi.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_static_lexertl.hpp>
+#include <boost/spirit/include/phoenix_operator.hpp>
+#include <boost/spirit/include/phoenix_container.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "../high_resolution_timer.hpp"
+#include "word_count_tokens.hpp"
+#include "word_count_static.hpp"
+#include "word_count_switch.hpp"
+#include "word_count_threaded.hpp"
+
+namespace lex = boost::spirit::lex;
+namespace qi = boost::spirit::qi;
+namespace mpl = boost::mpl;
+
+#define INPUT_SIZE 4000000
+#define MAX_ITERATION 10
+
+bool flex_word_count(char const* filename, int& c, int& w, int& l);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Iterator>
+struct word_count_grammar : qi::grammar<Iterator>
+{
+    template <typename TokenDef>
+    word_count_grammar(TokenDef const& tok)
+      : word_count_grammar::base_type(start)
+      , c(0), w(0), l(0)
+    {
+        using boost::phoenix::ref;
+        using boost::phoenix::size;
+
+        start =  *(   tok.word          [ ++ref(w), ref(c) += size(qi::_1) ]
+                  |   qi::lit('\n')     [ ++ref(l), ++ref(c) ]
+                  |   qi::token(IDANY)  [ ++ref(c) ]
+                  )
+              ;
+    }
+
+    std::size_t c, w, l;
+    qi::rule<Iterator> start;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void report(char const* name, double elapsed, std::size_t bytes
+  , std::size_t c, std::size_t w, std::size_t l)
+{
+    std::cout << std::left << std::setw(16) << name << elapsed << " [s]\t"
+              << (bytes / elapsed) / (1024 * 1024) << " [MB/s]\t"
+              << "lines: " << l << ", words: " << w
+              << ", characters: " << c << std::endl;
+}
+
+template <typename Lexer>
+void measure(char const* name, std::string const& input)
+{
+    typedef word_count_tokens<Lexer> tokens_type;
+    typedef typename tokens_type::iterator_type iterator_type;
+
+    tokens_type word_count;
+
+    // the first run builds the DFA (if any) and warms up the caches
+    {
+        word_count_grammar<iterator_type> g(word_count);
+        char const* first = input.c_str();
+        if (!lex::tokenize_and_parse(first, first + input.size(), word_count
+              , g))
+        {
+            std::cerr << name << ": parsing failed" << std::endl;
+            std::exit(-1);
+        }
+    }
+
+    std::size_t c = 0, w = 0, l = 0;
+    util::high_resolution_timer t;
+    for (int i = 0; i < MAX_ITERATION; ++i)
+    {
+        word_count_grammar<iterator_type> g(word_count);
+        char const* first = input.c_str();
+        lex::tokenize_and_parse(first, first + input.size(), word_count, g);
+        c = g.c; w = g.w; l = g.l;
+    }
+    report(name, t.elapsed(), input.size() * MAX_ITERATION, c, w, l);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::string const input = generate_input(INPUT_SIZE);
+
+    std::cout << "Counting the words in " << input.size() << " bytes of input "
+              << MAX_ITERATION << " times." << std::endl;
+
+    typedef lex::lexertl::token<
+        char const*, mpl::vector<std::string>, mpl::false_
+    > token_type;
+
+    measure<lex::lexertl::lexer<token_type> >("dynamic", input);
+    measure<lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_wc>
+        >("static table", input);
+    measure<lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_wcs>
+        >("static switch", input);
+    measure<lex::lexertl::static_lexer<
+            token_type, lex::lexertl::static_::lexer_wct>
+        >("static threaded", input);
+
+    // the flex scanner needs the input in a file
+    char const* filename = "word_count_benchmark.input";
+    {
+        std::ofstream out(filename, std::ios::binary);
+        out << input;
+    }
+
+    int c = 0, w = 0, l = 0;
+    if (!flex_word_count(filename, c, w, l))
+    {
+        std::cerr << "flex: couldn't open input file" << std::endl;
+        return -1;
+    }
+
+    util::high_resolution_timer t;
+    for (int i = 0; i < MAX_ITERATION; ++i)
+    {
+        c = w = l = 0;
+        flex_word_count(filename, c, w, l);
+    }
+    report("flex", t.elapsed(), input.size() * MAX_ITERATION, c, w, l);
+
+    std::remove(filename);
+    return 0;
+}
@@ -0,0 +1,34 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  The flex based word counter from example/lex/word_count_functor_flex.cpp,
+//  used as the baseline by word_count.cpp. The scanner is compiled as is,
+//  only its main() is renamed.
+
+#define main word_count_functor_flex_main
+#include "../../example/lex/word_count_functor_flex.cpp"
+#undef main
+
+///////////////////////////////////////////////////////////////////////////////
+//  Count the characters, words and lines in the given file, returns false if
+//  the file can't be opened.
+bool flex_word_count(char const* filename, int& c, int& w, int& l)
+{
+    yyin = fopen(filename, "r");
+    if (NULL == yyin)
+        return false;
+
+    yyrestart(yyin);
+
+    int tok = EOF;
+    do {
+        tok = yylex();
+        if (!count(tok, &c, &w, &l))
+            break;
+    } while (EOF != tok);
+
+    fclose(yyin);
+    return true;
+}
@@ -0,0 +1,52 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  Generate the static lexers used by the lexer benchmarks: a table driven
+//  one (word_count_static.hpp), a switch based one (word_count_switch.hpp),
+//  and a direct threaded one laid out using the state profile of the
+//  benchmark input (word_count_threaded.hpp).
+//  The generated files are checked in, this needs to be rerun only if the
+//  token definition in word_count_tokens.hpp or the code generator changes.
+
+#include <boost/config/warning_disable.hpp>
+#include <boost/spirit/include/lex_lexertl.hpp>
+#include <boost/spirit/include/lex_generate_static_lexertl.hpp>
+
+#include <fstream>
+#include <string>
+
+#include "word_count_tokens.hpp"
+
+using namespace boost::spirit;
+
+int main(int argc, char* argv[])
+{
+    word_count_tokens<lex::lexertl::lexer<> > word_count;
+
+    std::ofstream table_out(argc < 2 ? "word_count_static.hpp" : argv[1]);
+    if (!lex::lexertl::generate_static_dfa(word_count, table_out, "wc"))
+        return -1;
+
+    std::ofstream switch_out(argc < 3 ? "word_count_switch.hpp" : argv[2]);
+    if (!lex::lexertl::generate_static_switch(word_count, switch_out, "wcs"))
+        return -1;
+
+    std::string const input(generate_input(1000000));
+    lex::lexertl::state_profile profile;
+    if (!lex::lexertl::record_state_profile(word_count, input.begin()
+          , input.end(), profile))
+    {
+        return -1;
+    }
+
+    std::ofstream threaded_out(argc < 4 ? "word_count_threaded.hpp" : argv[3]);
+    if (!lex::lexertl::generate_static_threaded(word_count, threaded_out
+          , "wct", &profile))
+    {
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+//  Copyright (c) 2001-2011 Hartmut Kaiser
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(SPIRIT_LEX_BENCHMARK_WORD_COUNT_TOKENS_OCT_17_2026_0930AM)
+#define SPIRIT_LEX_BENCHMARK_WORD_COUNT_TOKENS_OCT_17_2026_0930AM
+
+#include <cstdlib>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+//  The token definition used by all lexer benchmarks. These are the same
+//  tokens as recognized by the flex based scanner in
+//  example/lex/word_count_functor_flex.cpp.
+///////////////////////////////////////////////////////////////////////////////
+enum tokenids
+{
+    IDANY = boost::spirit::lex::min_token_id + 1
+};
+
+template <typename BaseLexer>
+struct word_count_tokens : boost::spirit::lex::lexer<BaseLexer>
+{
+    // additional match_flags may be passed (such as match_lazy_dfa)
+    word_count_tokens(unsigned int flags = 0)
+      : word_count_tokens::base_type(
+          boost::spirit::lex::match_flags::match_not_dot_newline | flags)
+    {
+        word = "[^ \t\n]+";
+        this->self = word | '\n' | boost::spirit::lex::token_def<>(".", IDANY);
+    }
+
+    boost::spirit::lex::token_def<std::string> word;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+//  Generate about size bytes of text: lines of words of up to 12 characters,
+//  separated by one or more blanks and tabs. The result is the same for every
+//  run.
+inline std::string generate_input(std::size_t size)
+{
+    static char const letters[] =
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.,;:!?";
+
+    std::string result;
+    result.reserve(size + 80);
+
+    std::srand(0);
+    while (result.size() < size)
+    {
+        std::size_t words = std::rand() % 14;
+        for (std::size_t i = 0; i != words; ++i)
+        {
+            if (i != 0 || std::rand() % 4 == 0)
+                result += (std::rand() % 8 == 0) ? "\t " : " ";
+
+            std::size_t length = 1 + std::rand() % 12;
+            for (std::size_t j = 0; j != length; ++j)
+                result += letters[std::rand() % (sizeof(letters) - 1)];
+        }
+        result += '\n';
+    }
+    return result;
+}
+
+#endif
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <boost/cstdint.hpp>
 #include <boost/spirit/include/qi.hpp>
 
 namespace
@@ -26,11 +27,34 @@ namespace
             result += '0' + (rand()%10);
         return result;
     }
-    
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Generate a random hexadecimal number string with N digits
+    std::string
+    gen_hex(int digits)
+    {
+        char const* xdigits = "0123456789abcdefABCDEF";
+        std::string result;
+        result += xdigits[1 + rand()%21];   // The first digit cannot be '0'
+
+        for (int i = 1; i < digits; ++i)    // Generate the remaining digits
+            result += xdigits[rand()%22];
+        return result;
+    }
+
     std::string numbers[9];
     char const* first[9];
     char const* last[9];
 
+    // long digit strings: 10 .. 18 decimal digits, 8 .. 16 hex digits
+    std::string long_numbers[9];
+    char const* long_first[9];
+    char const* long_last[9];
+
+    std::string hex_numbers[9];
+    char const* hex_first[9];
+    char const* hex_last[9];
+
     ///////////////////////////////////////////////////////////////////////////
     struct atoi_test : test::base
     {
@@ -69,6 +93,66 @@ namespace
                 this->val += parse(first[i], last[i]);
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct strtoll_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < 9; ++i)
+                this->val += static_cast<int>(
+                    strtoll(long_first[i], const_cast<char**>(&long_last[i]), 10));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct spirit_long_long_test : test::base
+    {
+        static boost::long_long_type parse(char const* first, char const* last)
+        {
+            boost::long_long_type n;
+            namespace qi = boost::spirit::qi;
+            using qi::long_long;
+            qi::parse(first, last, long_long, n);
+            return n;
+        }
+
+        void benchmark()
+        {
+            for (int i = 0; i < 9; ++i)
+                this->val += static_cast<int>(parse(long_first[i], long_last[i]));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct strtoull_hex_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < 9; ++i)
+                this->val += static_cast<int>(
+                    strtoull(hex_first[i], const_cast<char**>(&hex_last[i]), 16));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct spirit_hex_test : test::base
+    {
+        static boost::ulong_long_type parse(char const* first, char const* last)
+        {
+            boost::ulong_long_type n;
+            namespace qi = boost::spirit::qi;
+            qi::uint_parser<boost::ulong_long_type, 16> hex64;
+            qi::parse(first, last, hex64, n);
+            return n;
+        }
+
+        void benchmark()
+        {
+            for (int i = 0; i < 9; ++i)
+                this->val += static_cast<int>(parse(hex_first[i], hex_last[i]));
+        }
+    };
 }
 
 int main()
@@ -89,6 +173,20 @@ int main()
             last[i]++;
         std::cout << i+1 << " digit number:" << numbers[i] << std::endl;
     }
+    for (int i = 0; i < 9; ++i)
+    {
+        long_numbers[i] = gen_int(i+10);
+        long_first[i] = long_numbers[i].c_str();
+        long_last[i] = long_first[i] + long_numbers[i].size();
+        std::cout << i+10 << " digit number:" << long_numbers[i] << std::endl;
+    }
+    for (int i = 0; i < 9; ++i)
+    {
+        hex_numbers[i] = gen_hex(i+8);
+        hex_first[i] = hex_numbers[i].c_str();
+        hex_last[i] = hex_first[i] + hex_numbers[i].size();
+        std::cout << i+8 << " digit hex number:" << hex_numbers[i] << std::endl;
+    }
     std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
 
     BOOST_SPIRIT_TEST_BENCHMARK(
@@ -96,6 +194,10 @@ int main()
         (atoi_test)
         (strtol_test)
         (spirit_int_test)
+        (strtoll_test)
+        (spirit_long_long_test)
+        (strtoull_hex_test)
+        (spirit_hex_test)
     )
     
     // This is ultimately responsible for preventing all the test code
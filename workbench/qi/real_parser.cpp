@@ -8,11 +8,12 @@
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <cstring>
 #include <boost/spirit/include/qi.hpp>
 
 namespace
 {   
-    int const ndigits = 9; 
+    int const ndigits = 16;
     std::string numbers[ndigits] =
     {
         "1234",
@@ -23,7 +24,14 @@ namespace
         "-2e6",
         "1.2345e5",
         "-5.7222349715140557e+307",
-        "2.0332938517515416e-308"
+        "2.0332938517515416e-308",
+        "3.141592653589793",
+        "0.30000000000000004",
+        "9007199254740993",
+        "2.2250738585072011e-308",
+        "4.9406564584124654e-324",
+        "1.7976931348623157e308",
+        "8.98846567431158e307"
     };
 
     char const* first[ndigits];
@@ -76,6 +84,12 @@ namespace
             }
         }
     };
+
+    // 'ok' if the result is bit for bit the one strtod gives
+    char const* exact(double d, double ref)
+    {
+        return std::memcmp(&d, &ref, sizeof(double)) == 0 ? "ok" : "INEXACT";
+    }
 }
 
 int main()
@@ -95,10 +109,12 @@ int main()
     std::cout << "atof/strtod/qi.double results:" << std::endl;
     for (int i = 0; i < ndigits; ++i)
     {
+        double const ref = strtod(first[i], const_cast<char**>(&last[i]));
+        double const qi_d = spirit_double_test::parse(first[i], last[i]);
         std::cout 
             << atof(first[i]) << ','
-            << strtod(first[i], const_cast<char**>(&last[i])) << ','
-            << spirit_double_test::parse(first[i], last[i]) << ','
+            << ref << ','
+            << qi_d << " (" << exact(qi_d, ref) << ")"
             << std::endl;
     }
     std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
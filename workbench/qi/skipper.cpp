@@ -0,0 +1,120 @@
+/*=============================================================================
+    Copyright (c) 2001-2010 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <boost/spirit/include/qi.hpp>
+
+namespace
+{
+    namespace qi = boost::spirit::qi;
+    namespace ascii = boost::spirit::ascii;
+    namespace standard = boost::spirit::standard;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A pretty printed list of numbers: indented lines, blanks around the
+    // commas, about a third of the input is white space
+    std::string
+    gen_input(int lines)
+    {
+        std::string result;
+        for (int i = 0; i < lines; ++i)
+        {
+            result.append(4 * (1 + rand() % 3), ' ');
+            for (int j = 0; j < 4; ++j)
+            {
+                result += '1' + rand() % 9;
+                for (int k = rand() % 6; k != 0; --k)
+                    result += '0' + rand() % 10;
+                result += (j == 3) ? "," : " , ";
+                if (j != 3 && rand() % 4 == 0)
+                    result += '\t';
+            }
+            result += '\n';
+        }
+        result += "0\n";
+        return result;
+    }
+
+    std::string input;
+
+    template <typename Skipper>
+    int parse_all(Skipper const& skipper)
+    {
+        std::string::const_iterator first = input.begin();
+        std::string::const_iterator last = input.end();
+        std::vector<int> v;
+        qi::phrase_parse(first, last, qi::int_ % ',', skipper, v);
+        return first == last ? int(v.size()) : 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The skipper is invoked for every blank
+    struct char_set_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_all(standard::char_(" \t\n\r"));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct space_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_all(standard::space);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct ascii_space_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_all(ascii::space);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct space_or_comment_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_all(standard::space
+              | ('#' >> *(standard::char_ - '\n') >> '\n'));
+        }
+    };
+}
+
+int main()
+{
+    srand(0);
+    input = gen_input(100);
+
+    std::size_t blanks = 0;
+    for (std::size_t i = 0; i < input.size(); ++i)
+        blanks += (input[i] == ' ' || input[i] == '\t' || input[i] == '\n');
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << input.size() << " chars, " << blanks << " of them white space" << std::endl;
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10,           // This is the maximum repetitions to execute
+        (char_set_test)
+        (space_test)
+        (ascii_space_test)
+        (space_or_comment_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
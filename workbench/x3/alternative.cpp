@@ -0,0 +1,141 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <cstdlib>
+#include <boost/spirit/home/x3.hpp>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Statements of a toy language, each led by a keyword (or an
+    // identifier, for assignments), one per line
+    char const* keywords[] =
+    {
+        "break", "case", "continue", "default", "do", "else", "for", "goto",
+        "if", "let", "print", "read", "return", "switch", "until", "while"
+    };
+    int const nkeywords = sizeof(keywords) / sizeof(keywords[0]);
+
+    std::string
+    gen_input(int lines)
+    {
+        std::string result;
+        for (int i = 0; i < lines; ++i)
+        {
+            int const k = rand() % (nkeywords + 4);
+            if (k < nkeywords)
+                result += keywords[k];
+            else
+                result += "x" + std::to_string(k) + " =";
+            result += ' ' + std::to_string(rand() % 1000) + ";\n";
+        }
+        return result;
+    }
+
+    std::string input;
+
+    auto const identifier = x3::omit[x3::lexeme[x3::alpha >> *x3::alnum]];
+
+    auto const statement =
+            (x3::lit("break") >> x3::int_)
+        |   (x3::lit("case") >> x3::int_)
+        |   (x3::lit("continue") >> x3::int_)
+        |   (x3::lit("default") >> x3::int_)
+        |   (x3::lit("do") >> x3::int_)
+        |   (x3::lit("else") >> x3::int_)
+        |   (x3::lit("for") >> x3::int_)
+        |   (x3::lit("goto") >> x3::int_)
+        |   (x3::lit("if") >> x3::int_)
+        |   (x3::lit("let") >> x3::int_)
+        |   (x3::lit("print") >> x3::int_)
+        |   (x3::lit("read") >> x3::int_)
+        |   (x3::lit("return") >> x3::int_)
+        |   (x3::lit("switch") >> x3::int_)
+        |   (x3::lit("until") >> x3::int_)
+        |   (x3::lit("while") >> x3::int_)
+        |   (identifier >> '=' >> x3::int_)
+        ;
+
+    // the same, with the assignments hidden behind a rule (whose FIRST set
+    // is unknown)
+    x3::rule<class assignment> const assignment = "assignment";
+    auto const assignment_def = identifier >> '=' >> x3::int_;
+    BOOST_SPIRIT_DEFINE(assignment);
+
+    auto const statement_or_rule =
+            (x3::lit("break") >> x3::int_)
+        |   (x3::lit("case") >> x3::int_)
+        |   (x3::lit("continue") >> x3::int_)
+        |   (x3::lit("default") >> x3::int_)
+        |   (x3::lit("do") >> x3::int_)
+        |   (x3::lit("else") >> x3::int_)
+        |   (x3::lit("for") >> x3::int_)
+        |   (x3::lit("goto") >> x3::int_)
+        |   (x3::lit("if") >> x3::int_)
+        |   (x3::lit("let") >> x3::int_)
+        |   (x3::lit("print") >> x3::int_)
+        |   (x3::lit("read") >> x3::int_)
+        |   (x3::lit("return") >> x3::int_)
+        |   (x3::lit("switch") >> x3::int_)
+        |   (x3::lit("until") >> x3::int_)
+        |   (x3::lit("while") >> x3::int_)
+        |   assignment
+        ;
+
+    template <typename Statement>
+    int parse_all(Statement const& stmt)
+    {
+        char const* first = input.c_str();
+        char const* last = first + input.size();
+        int n = 0;
+        x3::phrase_parse(first, last
+          , *(stmt >> ';')[([&](auto&) { ++n; })], x3::space);
+        return first == last ? n : 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct statement_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_all(statement);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct statement_or_rule_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_all(statement_or_rule);
+        }
+    };
+}
+
+int main()
+{
+    srand(0);
+    input = gen_input(100);
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << input.size() << " chars, " << nkeywords << " keywords" << std::endl;
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10,           // This is the maximum repetitions to execute
+        (statement_test)
+        (statement_or_rule_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,110 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <functional>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/support/utility/arena.hpp>
+#include <boost/fusion/include/adapt_struct.hpp>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Lines of long identifiers (longer than the small string buffer),
+    // parsed into a list of lists of strings
+    std::string
+    gen_input(int lines)
+    {
+        std::string result;
+        for (int i = 0; i < lines; ++i)
+        {
+            for (int j = 0, n = 1 + rand() % 8; j < n; ++j)
+            {
+                result += "identifier_";
+                for (int k = 8 + rand() % 16; k != 0; --k)
+                    result += 'a' + rand() % 26;
+                result += ' ';
+            }
+            result += ";\n";
+        }
+        return result;
+    }
+
+    std::string input;
+
+    template <typename String>
+    auto lines()
+    {
+        auto const identifier = x3::rule<class identifier, String>() =
+            x3::lexeme[+(x3::alnum | x3::char_('_'))];
+        return *(*identifier >> ';');
+    }
+
+    template <typename Lines>
+    int count(Lines const& ls)
+    {
+        int n = 0;
+        for (auto const& l : ls)
+            n += int(l.size());
+        return n;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct heap_test : test::base
+    {
+        void benchmark()
+        {
+            char const* first = input.c_str();
+            char const* last = first + input.size();
+            std::vector<std::vector<std::string>> ls;
+            x3::phrase_parse(first, last, lines<std::string>(), x3::space, ls);
+            this->val += count(ls);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct arena_test : test::base
+    {
+        void benchmark()
+        {
+            char const* first = input.c_str();
+            char const* last = first + input.size();
+            x3::arena arena(16384);
+            x3::arena_vector<x3::arena_vector<x3::arena_string>> ls{
+                x3::arena_allocator<int>(arena)};
+            x3::phrase_parse(first, last
+              , x3::with<x3::arena_tag>(std::ref(arena))[lines<x3::arena_string>()]
+              , x3::space, ls);
+            this->val += count(ls);
+        }
+    };
+}
+
+int main()
+{
+    srand(0);
+    input = gen_input(100);
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << input.size() << " chars" << std::endl;
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10,           // This is the maximum repetitions to execute
+        (heap_test)
+        (arena_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,140 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <list>
+#include <cstring>
+#include <boost/spirit/home/x3.hpp>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keywords of various lengths, as found in typical config grammars
+    int const nkeywords = 8;
+    char const* keywords[nkeywords] =
+    {
+        "if",
+        "else",
+        "return",
+        "include",
+        "namespace",
+        "configuration",
+        "max_connections_per_host",
+        "enable_transparent_compression"
+    };
+
+    // The input: each keyword, in mixed case for the no_case tests
+    std::string input[nkeywords];
+    std::string mixed_input[nkeywords];
+    std::list<char> list_input[nkeywords];
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct strncmp_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < nkeywords; ++i)
+            {
+                std::size_t len = std::strlen(keywords[i]);
+                this->val += len <= input[i].size()
+                    && std::strncmp(input[i].c_str(), keywords[i], len) == 0;
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct x3_lit_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < nkeywords; ++i)
+            {
+                char const* first = input[i].c_str();
+                char const* last = first + input[i].size();
+                this->val += x3::parse(first, last, x3::lit(keywords[i]));
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Same as above, but through a non-contiguous iterator (generic path)
+    struct x3_lit_list_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < nkeywords; ++i)
+            {
+                std::list<char>::const_iterator first = list_input[i].begin();
+                this->val += x3::parse(first, list_input[i].cend(), x3::lit(keywords[i]));
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct x3_no_case_lit_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < nkeywords; ++i)
+            {
+                char const* first = mixed_input[i].c_str();
+                char const* last = first + mixed_input[i].size();
+                this->val += x3::parse(first, last
+                  , x3::no_case[x3::ascii::lit(keywords[i])]);
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct x3_no_case_standard_lit_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < nkeywords; ++i)
+            {
+                char const* first = mixed_input[i].c_str();
+                char const* last = first + mixed_input[i].size();
+                this->val += x3::parse(first, last
+                  , x3::no_case[x3::standard::lit(keywords[i])]);
+            }
+        }
+    };
+}
+
+int main()
+{
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << "Keywords to test:" << std::endl;
+    for (int i = 0; i < nkeywords; ++i)
+    {
+        input[i] = keywords[i];
+        input[i] += " = 1;";
+        list_input[i].assign(input[i].begin(), input[i].end());
+
+        mixed_input[i] = input[i];
+        for (std::size_t j = 0; j < mixed_input[i].size(); j += 2)
+            mixed_input[i][j] = std::toupper(mixed_input[i][j]);
+        std::cout << mixed_input[i] << std::endl;
+    }
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10000000,     // This is the maximum repetitions to execute
+        (strncmp_test)
+        (x3_lit_test)
+        (x3_lit_list_test)
+        (x3_no_case_lit_test)
+        (x3_no_case_standard_lit_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,203 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/spirit/home/x3/string/tst_map.hpp>
+#include <boost/spirit/home/x3/string/flat_trie.hpp>
+#include <boost/spirit/home/x3/string/perfect_hash.hpp>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+    typedef boost::spirit::char_encoding::standard encoding;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A large symbol table of random identifiers (sharing a good deal of
+    // prefixes, as identifiers do) and a shuffled list of them to look up
+    int const nsymbols = 200000;
+    int const nlookups = 1000;
+
+    std::vector<std::string> symbols;
+    std::vector<std::string> lookups;
+
+    std::string
+    gen_symbol()
+    {
+        static char const* prefixes[] = { "get_", "set_", "is_", "on_", "", "", "" };
+        std::string result = prefixes[rand() % 7];
+        int const len = 3 + rand() % 10;
+        for (int i = 0; i < len; ++i)
+            result += 'a' + rand() % 26;
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A small, read-only table: the C++ keywords, looked up in a mix of
+    // keywords and identifiers
+    char const* keywords[] =
+    {
+        "alignas", "alignof", "asm", "auto", "bool", "break", "case", "catch",
+        "char", "char16_t", "char32_t", "class", "const", "constexpr",
+        "const_cast", "continue", "decltype", "default", "delete", "do",
+        "double", "dynamic_cast", "else", "enum", "explicit", "export",
+        "extern", "false", "float", "for", "friend", "goto", "if", "inline",
+        "int", "long", "mutable", "namespace", "new", "noexcept", "nullptr",
+        "operator", "private", "protected", "public", "register",
+        "reinterpret_cast", "return", "short", "signed", "sizeof", "static",
+        "static_assert", "static_cast", "struct", "switch", "template",
+        "this", "thread_local", "throw", "true", "try", "typedef", "typeid",
+        "typename", "union", "unsigned", "using", "virtual", "void",
+        "volatile", "wchar_t", "while"
+    };
+    int const nkeywords = sizeof(keywords) / sizeof(keywords[0]);
+
+    std::vector<std::string> words;
+
+    x3::symbols_parser<encoding, int, x3::tst<char, int> > tst_keywords;
+    x3::symbols_parser<encoding, int, x3::flat_trie<char, int> > flat_trie_keywords;
+    x3::symbols_parser<encoding, int, x3::perfect_hash<char, int> > perfect_hash_keywords;
+
+    x3::symbols_parser<encoding, int, x3::tst<char, int> > tst_symbols;
+    x3::symbols_parser<encoding, int, x3::tst_map<char, int> > tst_map_symbols;
+    x3::symbols_parser<encoding, int, x3::flat_trie<char, int> > flat_trie_symbols;
+    x3::symbols_parser<encoding, int, x3::perfect_hash<char, int> > perfect_hash_symbols;
+
+    template <typename Symbols>
+    int lookup_all(Symbols const& sym, std::vector<std::string> const& input)
+    {
+        int val = 0;
+        for (std::size_t i = 0; i < input.size(); ++i)
+        {
+            char const* first = input[i].c_str();
+            char const* last = first + input[i].size();
+            int n = 0;
+            if (x3::parse(first, last, sym, n))
+                val += n;
+        }
+        return val;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct tst_keywords_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(tst_keywords, words);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct flat_trie_keywords_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(flat_trie_keywords, words);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct perfect_hash_keywords_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(perfect_hash_keywords, words);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct tst_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(tst_symbols, lookups);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct tst_map_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(tst_map_symbols, lookups);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct flat_trie_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(flat_trie_symbols, lookups);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct perfect_hash_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(perfect_hash_symbols, lookups);
+        }
+    };
+}
+
+int main()
+{
+    srand(0);
+    for (int i = 0; i < nkeywords; ++i)
+    {
+        tst_keywords.add(keywords[i], i);
+        flat_trie_keywords.add(keywords[i], i);
+        perfect_hash_keywords.add(keywords[i], i);
+    }
+    perfect_hash_keywords.freeze();
+
+    for (int i = 0; i < nlookups; ++i)
+    {
+        // about a third of the words are keywords
+        if (rand() % 3 == 0)
+            words.push_back(std::string(keywords[rand() % nkeywords]) + " x;");
+        else
+            words.push_back(gen_symbol() + "(x);");
+    }
+
+    for (int i = 0; i < nsymbols; ++i)
+    {
+        symbols.push_back(gen_symbol());
+        tst_symbols.add(symbols.back(), i);
+        tst_map_symbols.add(symbols.back(), i);
+        flat_trie_symbols.add(symbols.back(), i);
+        perfect_hash_symbols.add(symbols.back(), i);
+    }
+    perfect_hash_symbols.freeze();
+    for (int i = 0; i < nlookups; ++i)
+        lookups.push_back(symbols[rand() % nsymbols] + " = 1;");
+
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+    std::cout << nkeywords << " keywords or " << nsymbols << " symbols, "
+        << nlookups << " lookups per run" << std::endl;
+    std::cout << "///////////////////////////////////////////////////////////////////////////" << std::endl;
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        1,            // This is the maximum repetitions to execute
+        (tst_keywords_test)
+        (flat_trie_keywords_test)
+        (perfect_hash_keywords_test)
+        (tst_test)
+        (tst_map_test)
+        (flat_trie_test)
+        (perfect_hash_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}